@@ -0,0 +1,174 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef BASE_INCLUDE_CONCURRENT_HASH_MAP_H_
+#define BASE_INCLUDE_CONCURRENT_HASH_MAP_H_
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace lynx {
+namespace base {
+
+/*
+  Thread safe hash map for caches shared across threads. Keys are distributed
+  to kShardCount shards by hash, and each shard is an unordered_map guarded by
+  its own mutex, so threads working on different keys rarely contend on the
+  same lock. kShardCount must be a power of two.
+
+  No iterator or reference to the stored values is handed out because they may
+  be invalidated by other threads. Use Visit() to access a value in place
+  while its shard is locked, Find() to copy it out or Extract() to move it out.
+  The callback of Visit() and ForEach() must not access the same map again,
+  otherwise it deadlocks.
+*/
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>, size_t kShardCount = 16>
+class ConcurrentHashMap {
+  static_assert(kShardCount > 0 && (kShardCount & (kShardCount - 1)) == 0,
+                "kShardCount must be a power of two");
+
+ public:
+  using Map = std::unordered_map<Key, Value, Hash, KeyEqual>;
+
+  ConcurrentHashMap() = default;
+  ~ConcurrentHashMap() = default;
+
+  ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+  ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+  // Returns true if the value is inserted, false if the key already exists.
+  template <typename... Args>
+  bool Emplace(const Key& key, Args&&... args) {
+    auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.map.try_emplace(key, std::forward<Args>(args)...).second;
+  }
+
+  // Returns true if the value is inserted, false if it is assigned.
+  template <typename V>
+  bool InsertOrAssign(const Key& key, V&& value) {
+    auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.map.insert_or_assign(key, std::forward<V>(value)).second;
+  }
+
+  // Returns the number of erased values.
+  size_t Erase(const Key& key) {
+    auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.map.erase(key);
+  }
+
+  // Move the value out of the map.
+  std::optional<Value> Extract(const Key& key) {
+    auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) {
+      return std::nullopt;
+    }
+    std::optional<Value> result(std::move(it->second));
+    shard.map.erase(it);
+    return result;
+  }
+
+  // Copy the value out of the map.
+  std::optional<Value> Find(const Key& key) const {
+    const auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  bool Contains(const Key& key) const {
+    const auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.map.find(key) != shard.map.end();
+  }
+
+  // Call visitor(Value&) if the key exists, returns whether it is called.
+  template <typename Visitor>
+  bool Visit(const Key& key, Visitor&& visitor) {
+    auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) {
+      return false;
+    }
+    visitor(it->second);
+    return true;
+  }
+
+  // Call visitor(const Key&, Value&) for each entry. Shards are locked one by
+  // one, so it is not a snapshot if other threads are modifying the map.
+  template <typename Visitor>
+  void ForEach(Visitor&& visitor) {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      for (auto& pair : shard.map) {
+        visitor(pair.first, pair.second);
+      }
+    }
+  }
+
+  size_t Size() const {
+    size_t result = 0;
+    for (const auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      result += shard.map.size();
+    }
+    return result;
+  }
+
+  bool Empty() const { return Size() == 0; }
+
+  void Clear() {
+    for (auto& shard : shards_) {
+      Map map;
+      {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        map.swap(shard.map);
+      }
+      // Destruct values out of the lock.
+    }
+  }
+
+ private:
+  // Keep shards on different cache lines to avoid false sharing of mutexes.
+  struct alignas(64) Shard {
+    mutable std::mutex mutex;
+    Map map;
+  };
+
+  size_t ShardIndex(const Key& key) const {
+    size_t h = Hash()(key);
+    // std::hash of integers is identity on most platforms, mix the high bits
+    // so that sequential ids spread over shards.
+    h ^= h >> 16;
+    h *= 0x45d9f3b;
+    h ^= h >> 16;
+    return h & (kShardCount - 1);
+  }
+
+  Shard& GetShard(const Key& key) { return shards_[ShardIndex(key)]; }
+  const Shard& GetShard(const Key& key) const {
+    return shards_[ShardIndex(key)];
+  }
+
+  std::array<Shard, kShardCount> shards_;
+};
+
+}  // namespace base
+}  // namespace lynx
+
+#endif  // BASE_INCLUDE_CONCURRENT_HASH_MAP_H_
@@ -0,0 +1,242 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef BASE_INCLUDE_DENSE_ID_MAP_H_
+#define BASE_INCLUDE_DENSE_ID_MAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lynx {
+namespace base {
+
+/**
+ DenseIdMap maps int32 ids to values for ids that are allocated densely and
+ monotonically, such as element ids generated by ElementManager.
+
+ Ids in [0, kMaxDenseId) are stored directly in pages of kPageSize slots, so
+ finding an id costs one index into the page table and one into the page, and
+ inserting does not allocate except for the first id of a page. A page is
+ released when its last value is erased. Other ids, such as negative ones, are
+ kept in a fallback unordered_map.
+
+ Values are never moved once inserted, so pointers to them stay valid until
+ they are erased, which is the same guarantee as std::unordered_map gives.
+
+ DenseIdMap is not thread safe. ForEach() must not modify the map.
+ */
+template <typename T, size_t kPageSize = 256, int32_t kMaxDenseId = (1 << 22)>
+class DenseIdMap {
+  static_assert(kPageSize > 0 && kPageSize % 64 == 0,
+                "kPageSize must be a multiple of 64");
+  static_assert(kMaxDenseId > 0, "kMaxDenseId must be positive");
+
+ public:
+  DenseIdMap() = default;
+  ~DenseIdMap() { Clear(); }
+
+  DenseIdMap(const DenseIdMap&) = delete;
+  DenseIdMap& operator=(const DenseIdMap&) = delete;
+  DenseIdMap(DenseIdMap&& other)
+      : pages_(std::move(other.pages_)),
+        overflow_(std::move(other.overflow_)),
+        size_(other.size_) {
+    other.size_ = 0;
+  }
+  DenseIdMap& operator=(DenseIdMap&& other) {
+    if (this != &other) {
+      Clear();
+      pages_ = std::move(other.pages_);
+      overflow_ = std::move(other.overflow_);
+      size_ = other.size_;
+      other.size_ = 0;
+    }
+    return *this;
+  }
+
+  T* Find(int32_t id) {
+    if (!IsDense(id)) {
+      auto it = overflow_.find(id);
+      return it != overflow_.end() ? &it->second : nullptr;
+    }
+    size_t page_index = static_cast<size_t>(id) / kPageSize;
+    if (page_index >= pages_.size() || !pages_[page_index]) {
+      return nullptr;
+    }
+    Page* page = pages_[page_index].get();
+    size_t slot = static_cast<size_t>(id) % kPageSize;
+    return page->Has(slot) ? page->At(slot) : nullptr;
+  }
+
+  const T* Find(int32_t id) const {
+    return const_cast<DenseIdMap*>(this)->Find(id);
+  }
+
+  bool Contains(int32_t id) const { return Find(id) != nullptr; }
+
+  /// Constructs the value in place if the id does not exist. Returns the
+  /// value of the id and whether it is inserted.
+  template <typename... Args>
+  std::pair<T*, bool> Emplace(int32_t id, Args&&... args) {
+    if (!IsDense(id)) {
+      auto result = overflow_.try_emplace(id, std::forward<Args>(args)...);
+      if (result.second) {
+        ++size_;
+      }
+      return {&result.first->second, result.second};
+    }
+    size_t page_index = static_cast<size_t>(id) / kPageSize;
+    if (page_index >= pages_.size()) {
+      pages_.resize(page_index + 1);
+    }
+    if (!pages_[page_index]) {
+      // Default-initialized, the storage of slots is left uninitialized.
+      pages_[page_index] = std::unique_ptr<Page>(new Page);
+    }
+    Page* page = pages_[page_index].get();
+    size_t slot = static_cast<size_t>(id) % kPageSize;
+    if (page->Has(slot)) {
+      return {page->At(slot), false};
+    }
+    T* value = new (page->At(slot)) T(std::forward<Args>(args)...);
+    page->Set(slot);
+    ++page->count;
+    ++size_;
+    return {value, true};
+  }
+
+  T& operator[](int32_t id) { return *Emplace(id).first; }
+
+  /// Returns whether the id existed.
+  bool Erase(int32_t id) {
+    if (!IsDense(id)) {
+      if (overflow_.erase(id) == 0) {
+        return false;
+      }
+      --size_;
+      return true;
+    }
+    size_t page_index = static_cast<size_t>(id) / kPageSize;
+    if (page_index >= pages_.size() || !pages_[page_index]) {
+      return false;
+    }
+    Page* page = pages_[page_index].get();
+    size_t slot = static_cast<size_t>(id) % kPageSize;
+    if (!page->Has(slot)) {
+      return false;
+    }
+    page->Reset(slot);
+    --page->count;
+    --size_;
+    page->At(slot)->~T();
+    if (page->count == 0) {
+      pages_[page_index].reset();
+    }
+    return true;
+  }
+
+  void Clear() {
+    for (auto& page : pages_) {
+      if (page) {
+        page->DestroyAll();
+      }
+    }
+    pages_.clear();
+    overflow_.clear();
+    size_ = 0;
+  }
+
+  size_t Size() const { return size_; }
+  bool Empty() const { return size_ == 0; }
+
+  /// Calls visitor(int32_t id, T& value) for each value, dense ids are visited
+  /// in ascending order before the others.
+  template <typename Visitor>
+  void ForEach(Visitor&& visitor) {
+    for (size_t page_index = 0; page_index < pages_.size(); ++page_index) {
+      Page* page = pages_[page_index].get();
+      if (page == nullptr) {
+        continue;
+      }
+      for (size_t word = 0; word < kWordCount; ++word) {
+        uint64_t bits = page->occupied[word];
+        while (bits != 0) {
+          size_t bit = CountTrailingZeros(bits);
+          bits &= bits - 1;
+          size_t slot = word * 64 + bit;
+          visitor(static_cast<int32_t>(page_index * kPageSize + slot),
+                  *page->At(slot));
+        }
+      }
+    }
+    for (auto& pair : overflow_) {
+      visitor(pair.first, pair.second);
+    }
+  }
+
+ private:
+  static constexpr size_t kWordCount = kPageSize / 64;
+
+  struct Page {
+    uint64_t occupied[kWordCount] = {};
+    size_t count = 0;
+    alignas(T) unsigned char storage[sizeof(T) * kPageSize];
+
+    Page() = default;
+    ~Page() = default;
+
+    T* At(size_t slot) {
+      return std::launder(reinterpret_cast<T*>(storage) + slot);
+    }
+    bool Has(size_t slot) const {
+      return (occupied[slot / 64] >> (slot % 64)) & 1u;
+    }
+    void Set(size_t slot) {
+      occupied[slot / 64] |= uint64_t(1) << (slot % 64);
+    }
+    void Reset(size_t slot) {
+      occupied[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+    }
+
+    void DestroyAll() {
+      for (size_t slot = 0; slot < kPageSize && count > 0; ++slot) {
+        if (Has(slot)) {
+          Reset(slot);
+          --count;
+          At(slot)->~T();
+        }
+      }
+    }
+  };
+
+  static bool IsDense(int32_t id) { return id >= 0 && id < kMaxDenseId; }
+
+  static size_t CountTrailingZeros(uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_ctzll(bits));
+#else
+    size_t result = 0;
+    while ((bits & 1u) == 0) {
+      bits >>= 1;
+      ++result;
+    }
+    return result;
+#endif
+  }
+
+  std::vector<std::unique_ptr<Page>> pages_;
+  std::unordered_map<int32_t, T> overflow_;
+  size_t size_ = 0;
+};
+
+}  // namespace base
+}  // namespace lynx
+
+#endif  // BASE_INCLUDE_DENSE_ID_MAP_H_
@@ -11,19 +11,28 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <string>
 #include <vector>
 
 #include "base/include/closure.h"
 #include "base/include/fml/thread.h"
+#include "base/include/work_stealing_deque.h"
 
 namespace lynx {
 namespace fml {
 
 class ConcurrentTaskRunner;
 
+// Each worker owns a work stealing deque. Tasks posted from a worker go to its
+// own deque and are run by it in LIFO order, or stolen by idle workers in FIFO
+// order. Tasks posted from other threads go to a shared queue, from which
+// workers take them in batches. Idle workers park on a condition variable and
+// are woken up by PostTask, so they cost no CPU time. Tasks are not guaranteed
+// to run in the order they are posted.
 class ConcurrentMessageLoop
     : public std::enable_shared_from_this<ConcurrentMessageLoop> {
  public:
@@ -46,6 +55,11 @@ class ConcurrentMessageLoop
 
   void PostTask(base::closure task);
 
+  // Runs body(i) for each i in [0, count) on the workers and the calling
+  // thread, and returns after all of them finish. It is safe to be called
+  // from a task of this loop.
+  void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+
   size_t GetWorkerCount() const;
 
   std::shared_ptr<ConcurrentTaskRunner> GetTaskRunner();
@@ -56,13 +70,20 @@ class ConcurrentMessageLoop
   std::mutex notify_mutex_;
   std::condition_variable notify_condition_;
   std::vector<std::thread> workers_;
-  std::atomic<std::uint32_t> worker_count_ = 0;
+  std::vector<std::unique_ptr<base::WorkStealingDeque<base::closure*>>>
+      worker_queues_;
+  std::atomic<std::uint32_t> parked_worker_count_ = 0;
   std::mutex tasks_mutex_;
   std::queue<base::closure> tasks_;
+  std::atomic<std::uint32_t> injected_task_count_ = 0;
+  // Tasks posted but not taken by any worker yet.
   std::atomic<std::uint32_t> task_count_ = 0;
   std::atomic_bool shutdown_ = false;
 
   void WorkerMain(uint32_t index);
+  base::closure* TakeTask(uint32_t index);
+  base::closure* TakeInjectedTasks(uint32_t index);
+  void WakeUpWorker();
 };
 
 class ConcurrentTaskRunner : public BasicTaskRunner {
@@ -81,11 +102,39 @@ class ConcurrentTaskRunner : public BasicTaskRunner {
   BASE_DISALLOW_COPY_AND_ASSIGN(ConcurrentTaskRunner);
 };
 
+// Fork/join helper on a ConcurrentMessageLoop. Wait() runs the tasks not
+// started by workers yet on the calling thread, and then blocks until the
+// others finish, so it never waits for a task queued behind other work. The
+// group must be used on one thread, and it waits for its tasks on destruction.
+class ConcurrentTaskGroup {
+ public:
+  explicit ConcurrentTaskGroup(ConcurrentMessageLoop& loop);
+  ~ConcurrentTaskGroup();
+
+  void PostTask(base::closure task);
+
+  void Wait();
+
+ private:
+  struct Task;
+
+  void RunTask(Task& task);
+
+  ConcurrentMessageLoop& loop_;
+  std::vector<std::shared_ptr<Task>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable finish_condition_;
+  size_t unfinished_count_ = 0;
+
+  BASE_DISALLOW_COPY_AND_ASSIGN(ConcurrentTaskGroup);
+};
+
 }  // namespace fml
 }  // namespace lynx
 
 namespace fml {
 using lynx::fml::ConcurrentMessageLoop;
+using lynx::fml::ConcurrentTaskGroup;
 using lynx::fml::ConcurrentTaskRunner;
 }  // namespace fml
 
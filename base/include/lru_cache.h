@@ -5,58 +5,466 @@
 #ifndef BASE_INCLUDE_LRU_CACHE_H_
 #define BASE_INCLUDE_LRU_CACHE_H_
 #include <stddef.h>
+#include <stdint.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <functional>
-#include <list>
-#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <utility>
+#include <vector>
+
+#include "base/include/boost/unordered.h"
 
 namespace lynx {
 namespace base {
 
 #define DEFAULT_CAPACITY 500
 
-template <typename Key, typename Value>
+/// Default weigher of LRUCache, every entry weighs 1 so that the capacity is
+/// the max count of entries.
+template <typename Value>
+struct LRUUnitWeigher {
+  size_t operator()(const Value&) const { return 1; }
+};
+
+struct LRUCacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+
+  LRUCacheStats& operator+=(const LRUCacheStats& other) {
+    hits += other.hits;
+    misses += other.misses;
+    evictions += other.evictions;
+    return *this;
+  }
+};
+
+/**
+ LRUCache keeps the most recently used entries whose total weight does not
+ exceed the capacity. The weight of an entry is given by Weigher, which is 1
+ for every entry by default. Use a weigher returning the byte size of the value
+ to make the capacity a byte budget.
+
+ Entries are nodes of an intrusive doubly-linked list, ordered from the most
+ recently used to the least. Nodes are allocated from blocks owned by the
+ cache and are recycled through a free list, so Put() after warming up does
+ not allocate memory except for the hash table and the value itself. Get(),
+ Put() and Erase() are O(1).
+
+ LRUCache is not thread safe, use ConcurrentLRUCache if needed.
+ */
+template <typename Key, typename Value,
+          typename Weigher = LRUUnitWeigher<Value>,
+          typename Hash = std::hash<Key>, typename Pred = std::equal_to<Key>>
 class LRUCache {
  public:
-  LRUCache() : capacity_(DEFAULT_CAPACITY) {}
-  explicit LRUCache(size_t capacity) : capacity_(capacity) {}
+  LRUCache() : LRUCache(DEFAULT_CAPACITY) {}
+  explicit LRUCache(size_t capacity, Weigher weigher = Weigher())
+      : capacity_(capacity), weigher_(std::move(weigher)) {
+    head_.prev = head_.next = Sentinel();
+  }
 
+  ~LRUCache() { Clear(); }
+
+  LRUCache(const LRUCache&) = delete;
+  LRUCache& operator=(const LRUCache&) = delete;
+
+  /// Returns nullptr if not found. The returned pointer is valid until the
+  /// entry is evicted or erased.
   Value* Get(const Key& key) {
     auto it = cache_map_.find(key);
     if (it == cache_map_.end()) {
+      ++stats_.misses;
       return nullptr;
     }
-    cache_list_.splice(cache_list_.begin(), cache_list_, it->second);
-    return &(it->second->second);
+    ++stats_.hits;
+    Node* node = it->second;
+    MoveToFront(node);
+    return &node->value;
   }
 
-  void Put(const Key& key, Value value) {
+  /// Returns false if the weight of the value alone exceeds the capacity, in
+  /// which case the value is not cached and any old value of the key is
+  /// erased.
+  bool Put(const Key& key, Value value) {
+    size_t weight = weigher_(value);
     auto it = cache_map_.find(key);
+    if (weight > capacity_) {
+      if (it != cache_map_.end()) {
+        RemoveNode(it->second);
+        cache_map_.erase(it);
+      }
+      return false;
+    }
+    Node* node;
     if (it != cache_map_.end()) {
-      it->second->second = std::move(value);
-      cache_list_.splice(cache_list_.begin(), cache_list_, it->second);
-      return;
+      node = it->second;
+      node->value = std::move(value);
+      weight_ = weight_ - node->weight + weight;
+      node->weight = weight;
+      MoveToFront(node);
+    } else {
+      node = arena_.New(key, std::move(value), weight);
+      LinkFront(node);
+      weight_ += weight;
+      cache_map_.emplace(key, node);
     }
-    if (cache_map_.size() == capacity_) {
-      auto last = cache_list_.back();
-      cache_map_.erase(last.first);
-      cache_list_.pop_back();
+    EvictIfNeeded(node);
+    return true;
+  }
+
+  bool Erase(const Key& key) {
+    auto it = cache_map_.find(key);
+    if (it == cache_map_.end()) {
+      return false;
     }
-    cache_list_.emplace_front(key, std::move(value));
-    cache_map_[key] = cache_list_.begin();
+    RemoveNode(it->second);
+    cache_map_.erase(it);
+    return true;
   }
 
   void Clear() {
-    cache_list_.clear();
+    Node* node = head_.next;
+    while (node != Sentinel()) {
+      Node* next = node->next;
+      arena_.Delete(node);
+      node = next;
+    }
+    head_.prev = head_.next = Sentinel();
     cache_map_.clear();
+    weight_ = 0;
+  }
+
+  /// Entries are evicted immediately if the new capacity is smaller than the
+  /// current total weight.
+  void SetCapacity(size_t capacity) {
+    capacity_ = capacity;
+    EvictIfNeeded(nullptr);
+  }
+
+  /// Evicts the least recently used entry and returns the number of evicted
+  /// entries, i.e. 0 if the cache is empty. The weight of the evicted entry,
+  /// which may be 0, is stored in `weight` if it is not null.
+  size_t EvictLeastRecentlyUsed(size_t* weight = nullptr) {
+    Node* last = head_.prev;
+    if (last == Sentinel()) {
+      return 0;
+    }
+    if (weight != nullptr) {
+      *weight = last->weight;
+    }
+    cache_map_.erase(last->key);
+    RemoveNode(last);
+    ++stats_.evictions;
+    return 1;
   }
 
+  size_t Capacity() const { return capacity_; }
+  size_t Size() const { return cache_map_.size(); }
+  size_t Weight() const { return weight_; }
+  bool Empty() const { return cache_map_.empty(); }
+
+  const LRUCacheStats& GetStats() const { return stats_; }
+  void ResetStats() { stats_ = LRUCacheStats(); }
+
  private:
+  struct Node;
+  struct NodeBase {
+    Node* prev = nullptr;
+    Node* next = nullptr;
+  };
+
+  struct Node : public NodeBase {
+    Key key;
+    Value value;
+    size_t weight;
+
+    Node(const Key& key, Value&& value, size_t weight)
+        : key(key), value(std::move(value)), weight(weight) {}
+  };
+
+  // Allocates nodes from blocks of growing size. Freed nodes are kept in a
+  // free list for reuse, and memory is returned only when the cache is
+  // destroyed.
+  class NodeArena {
+   public:
+    NodeArena() = default;
+    ~NodeArena() = default;
+
+    template <typename... Args>
+    Node* New(Args&&... args) {
+      void* memory = Allocate();
+      return new (memory) Node(std::forward<Args>(args)...);
+    }
+
+    void Delete(Node* node) {
+      node->~Node();
+      auto* slot = reinterpret_cast<Slot*>(node);
+      slot->next_free = free_list_;
+      free_list_ = slot;
+    }
+
+   private:
+    union Slot {
+      Slot* next_free;
+      alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+    static constexpr size_t kInitialBlockSize = 8;
+    static constexpr size_t kMaxBlockSize = 256;
+
+    void* Allocate() {
+      if (free_list_ != nullptr) {
+        Slot* slot = free_list_;
+        free_list_ = slot->next_free;
+        return slot->storage;
+      }
+      if (blocks_.empty() || block_used_ == block_size_) {
+        block_size_ = blocks_.empty()
+                          ? kInitialBlockSize
+                          : std::min(block_size_ * 2, kMaxBlockSize);
+        blocks_.emplace_back(new Slot[block_size_]);
+        block_used_ = 0;
+      }
+      return blocks_.back()[block_used_++].storage;
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> blocks_;
+    size_t block_size_ = 0;
+    size_t block_used_ = 0;
+    Slot* free_list_ = nullptr;
+  };
+
+  Node* Sentinel() { return static_cast<Node*>(&head_); }
+
+  void Unlink(Node* node) {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+  }
+
+  void LinkFront(Node* node) {
+    node->prev = Sentinel();
+    node->next = head_.next;
+    head_.next->prev = node;
+    head_.next = node;
+  }
+
+  void MoveToFront(Node* node) {
+    if (head_.next != node) {
+      Unlink(node);
+      LinkFront(node);
+    }
+  }
+
+  // Unlinks and destroys the node, the caller erases it from cache_map_.
+  void RemoveNode(Node* node) {
+    Unlink(node);
+    weight_ -= node->weight;
+    arena_.Delete(node);
+  }
+
+  // Evicts from the least recently used until the total weight fits, but
+  // never evicts `keep`.
+  void EvictIfNeeded(Node* keep) {
+    while (weight_ > capacity_) {
+      Node* last = head_.prev;
+      if (last == Sentinel() || last == keep) {
+        break;
+      }
+      cache_map_.erase(last->key);
+      RemoveNode(last);
+      ++stats_.evictions;
+    }
+  }
+
   size_t capacity_;
-  std::list<std::pair<Key, Value>> cache_list_;
-  std::unordered_map<Key, typename std::list<std::pair<Key, Value>>::iterator>
-      cache_map_;
+  size_t weight_ = 0;
+  Weigher weigher_;
+  LRUCacheStats stats_;
+  // head_.next is the most recently used and head_.prev is the least.
+  NodeBase head_;
+  NodeArena arena_;
+  boost::unordered_flat_map<Key, Node*, Hash, Pred> cache_map_;
+};
+
+/**
+ ConcurrentLRUCache distributes the entries to kShardCount LRUCaches by the
+ hash of the keys, each guarded by its own mutex. The capacity is shared by all
+ the shards, so an entry as heavy as the whole capacity can be cached. When the
+ total weight exceeds the capacity, the least recently used entries of the
+ shards are evicted in turn, so the eviction order is only approximately LRU
+ across the whole cache.
+
+ Get() copies the value out since the entry may be evicted by other threads at
+ any time, so Value is usually a shared_ptr or another cheap copyable type.
+ */
+template <typename Key, typename Value,
+          typename Weigher = LRUUnitWeigher<Value>,
+          typename Hash = std::hash<Key>, typename Pred = std::equal_to<Key>,
+          size_t kShardCount = 8>
+class ConcurrentLRUCache {
+  static_assert(kShardCount > 0 && (kShardCount & (kShardCount - 1)) == 0,
+                "kShardCount must be a power of two");
+
+ public:
+  using Cache = LRUCache<Key, Value, Weigher, Hash, Pred>;
+
+  ConcurrentLRUCache() : ConcurrentLRUCache(DEFAULT_CAPACITY) {}
+  explicit ConcurrentLRUCache(size_t capacity, Weigher weigher = Weigher())
+      : capacity_(capacity) {
+    // Every shard may hold up to the whole capacity, which is enforced across
+    // the shards by EvictIfNeeded().
+    for (auto& shard : shards_) {
+      shard.cache = std::make_unique<Cache>(capacity, weigher);
+    }
+  }
+
+  ConcurrentLRUCache(const ConcurrentLRUCache&) = delete;
+  ConcurrentLRUCache& operator=(const ConcurrentLRUCache&) = delete;
+
+  std::optional<Value> Get(const Key& key) {
+    auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    Value* value = shard.cache->Get(key);
+    if (value == nullptr) {
+      return std::nullopt;
+    }
+    return *value;
+  }
+
+  bool Put(const Key& key, Value value) {
+    auto& shard = GetShard(key);
+    bool result;
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      size_t old_weight = shard.cache->Weight();
+      result = shard.cache->Put(key, std::move(value));
+      UpdateWeight(old_weight, shard.cache->Weight());
+    }
+    EvictIfNeeded(shard);
+    return result;
+  }
+
+  bool Erase(const Key& key) {
+    auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    size_t old_weight = shard.cache->Weight();
+    bool result = shard.cache->Erase(key);
+    UpdateWeight(old_weight, shard.cache->Weight());
+    return result;
+  }
+
+  void Clear() {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      size_t old_weight = shard.cache->Weight();
+      shard.cache->Clear();
+      UpdateWeight(old_weight, 0);
+    }
+  }
+
+  void SetCapacity(size_t capacity) {
+    capacity_.store(capacity, std::memory_order_relaxed);
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      size_t old_weight = shard.cache->Weight();
+      shard.cache->SetCapacity(capacity);
+      UpdateWeight(old_weight, shard.cache->Weight());
+    }
+    EvictIfNeeded(shards_[0]);
+  }
+
+  size_t Capacity() const { return capacity_.load(std::memory_order_relaxed); }
+
+  size_t Size() const {
+    size_t result = 0;
+    for (const auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      result += shard.cache->Size();
+    }
+    return result;
+  }
+
+  size_t Weight() const { return weight_.load(std::memory_order_relaxed); }
+
+  LRUCacheStats GetStats() const {
+    LRUCacheStats result;
+    for (const auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      result += shard.cache->GetStats();
+    }
+    return result;
+  }
+
+  void ResetStats() {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.cache->ResetStats();
+    }
+  }
+
+ private:
+  struct alignas(64) Shard {
+    mutable std::mutex mutex;
+    std::unique_ptr<Cache> cache;
+  };
+
+  Shard& GetShard(const Key& key) {
+    size_t h = Hash()(key);
+    h ^= h >> 16;
+    h *= 0x45d9f3b;
+    h ^= h >> 16;
+    return shards_[h & (kShardCount - 1)];
+  }
+
+  // Called with the lock of the shard whose weight changed.
+  void UpdateWeight(size_t old_weight, size_t new_weight) {
+    if (new_weight >= old_weight) {
+      weight_.fetch_add(new_weight - old_weight, std::memory_order_relaxed);
+    } else {
+      weight_.fetch_sub(old_weight - new_weight, std::memory_order_relaxed);
+    }
+  }
+
+  // Evicts the least recently used entries of the shards in turn, starting
+  // from the one after `current`, until the total weight fits. The most
+  // recently used entry of `current`, e.g. the one just put, is kept. Only
+  // one shard is locked at a time.
+  void EvictIfNeeded(Shard& current) {
+    const size_t start = &current - shards_.data();
+    size_t index = start;
+    bool evicted_in_round = false;
+    while (Weight() > Capacity()) {
+      index = (index + 1) & (kShardCount - 1);
+      Shard& shard = shards_[index];
+      {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (&shard != &current || shard.cache->Size() > 1) {
+          size_t weight = 0;
+          if (shard.cache->EvictLeastRecentlyUsed(&weight) > 0) {
+            weight_.fetch_sub(weight, std::memory_order_relaxed);
+            evicted_in_round = true;
+          }
+        }
+      }
+      if (index == start) {
+        // Stop if a whole round evicts nothing, i.e. only the kept entry is
+        // left.
+        if (!evicted_in_round) {
+          break;
+        }
+        evicted_in_round = false;
+      }
+    }
+  }
+
+  std::atomic<size_t> capacity_;
+  std::atomic<size_t> weight_{0};
+  std::array<Shard, kShardCount> shards_;
 };
 
 }  // namespace base
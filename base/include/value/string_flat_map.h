@@ -0,0 +1,510 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef BASE_INCLUDE_VALUE_STRING_FLAT_MAP_H_
+#define BASE_INCLUDE_VALUE_STRING_FLAT_MAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "base/include/value/base_string.h"
+
+namespace lynx {
+namespace base {
+
+/**
+ StringFlatMap is a hash map from base::String to T which stores entries
+ inline in a single buffer instead of one heap node per entry.
+
+ - Maps with no more than kSmallCapacity entries keep them packed at the front
+   of an exactly sized buffer and find keys by linear search. This is the
+   typical size of objects in data of pages, and costs one allocation in
+   total.
+ - Larger maps use open addressing with linear probing. A control byte per
+   slot stores 7 bits of the hash so that most probes are rejected without
+   touching the key.
+
+ The hash of base::String is precomputed by RefCountedStringImpl, and keys
+ sharing the same RefCountedStringImpl are equal without comparing contents.
+
+ Unlike std::unordered_map, inserting may relocate entries, and erasing may
+ relocate entries of small maps. Pointers and iterators to entries are
+ invalidated by insertion and erasure. Iteration order is unspecified.
+ */
+template <typename T>
+class StringFlatMap {
+ public:
+  using key_type = String;
+  using mapped_type = T;
+  using value_type = std::pair<String, T>;
+  using size_type = size_t;
+
+  static constexpr size_t kSmallCapacity = 8;
+
+ private:
+  static constexpr uint8_t kEmpty = 0x80;
+  static constexpr uint8_t kDeleted = 0xFE;
+  static constexpr size_t kNotFound = static_cast<size_t>(-1);
+
+  static bool IsFull(uint8_t ctrl) { return (ctrl & 0x80) == 0; }
+
+ public:
+  template <bool kConst>
+  class IteratorImpl {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = StringFlatMap::value_type;
+    using difference_type = ptrdiff_t;
+    using pointer =
+        std::conditional_t<kConst, const value_type*, value_type*>;
+    using reference =
+        std::conditional_t<kConst, const value_type&, value_type&>;
+
+    IteratorImpl() = default;
+
+    // Allows iterator to const_iterator conversion.
+    template <bool kOtherConst,
+              typename = std::enable_if_t<kConst && !kOtherConst>>
+    IteratorImpl(const IteratorImpl<kOtherConst>& other)  // NOLINT
+        : ctrl_(other.ctrl_),
+          ctrl_end_(other.ctrl_end_),
+          slot_(other.slot_) {}
+
+    reference operator*() const { return *slot_; }
+    pointer operator->() const { return slot_; }
+
+    IteratorImpl& operator++() {
+      ++ctrl_;
+      ++slot_;
+      SkipEmptySlots();
+      return *this;
+    }
+
+    IteratorImpl operator++(int) {
+      IteratorImpl result = *this;
+      ++*this;
+      return result;
+    }
+
+    template <bool kOtherConst>
+    bool operator==(const IteratorImpl<kOtherConst>& other) const {
+      return ctrl_ == other.ctrl_;
+    }
+
+    template <bool kOtherConst>
+    bool operator!=(const IteratorImpl<kOtherConst>& other) const {
+      return ctrl_ != other.ctrl_;
+    }
+
+   private:
+    friend class StringFlatMap;
+    friend class IteratorImpl<!kConst>;
+
+    IteratorImpl(const uint8_t* ctrl, const uint8_t* ctrl_end, pointer slot)
+        : ctrl_(ctrl), ctrl_end_(ctrl_end), slot_(slot) {}
+
+    void SkipEmptySlots() {
+      while (ctrl_ != ctrl_end_ && !IsFull(*ctrl_)) {
+        ++ctrl_;
+        ++slot_;
+      }
+    }
+
+    const uint8_t* ctrl_ = nullptr;
+    const uint8_t* ctrl_end_ = nullptr;
+    pointer slot_ = nullptr;
+  };
+
+  using iterator = IteratorImpl<false>;
+  using const_iterator = IteratorImpl<true>;
+
+  StringFlatMap() = default;
+
+  StringFlatMap(std::initializer_list<value_type> init) {
+    reserve(init.size());
+    for (const auto& pair : init) {
+      try_emplace(pair.first, pair.second);
+    }
+  }
+
+  StringFlatMap(const StringFlatMap& other) {
+    if (other.size_ == 0) {
+      return;
+    }
+    // Copy with the same layout so that nothing needs to be rehashed.
+    Allocate(other.capacity_);
+    std::memcpy(ctrl_, other.ctrl_, capacity_);
+    for (size_t i = 0; i < capacity_; ++i) {
+      if (IsFull(ctrl_[i])) {
+        new (&slots_[i]) value_type(other.slots_[i]);
+      }
+    }
+    size_ = other.size_;
+    deleted_ = other.deleted_;
+  }
+
+  StringFlatMap(StringFlatMap&& other) noexcept { swap(other); }
+
+  StringFlatMap& operator=(const StringFlatMap& other) {
+    if (this != &other) {
+      StringFlatMap(other).swap(*this);
+    }
+    return *this;
+  }
+
+  StringFlatMap& operator=(StringFlatMap&& other) noexcept {
+    if (this != &other) {
+      StringFlatMap(std::move(other)).swap(*this);
+    }
+    return *this;
+  }
+
+  ~StringFlatMap() {
+    DestroySlots();
+    Deallocate();
+  }
+
+  void swap(StringFlatMap& other) noexcept {
+    std::swap(slots_, other.slots_);
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(deleted_, other.deleted_);
+  }
+
+  iterator begin() {
+    iterator it(ctrl_, ctrl_ + capacity_, slots_);
+    it.SkipEmptySlots();
+    return it;
+  }
+  iterator end() { return IteratorAt(capacity_); }
+  const_iterator begin() const {
+    return const_cast<StringFlatMap*>(this)->begin();
+  }
+  const_iterator end() const {
+    return const_cast<StringFlatMap*>(this)->end();
+  }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  size_t capacity() const { return capacity_; }
+
+  iterator find(const String& key) {
+    size_t index = FindIndex(key, Mix(key.hash()));
+    return index == kNotFound ? end() : IteratorAt(index);
+  }
+
+  const_iterator find(const String& key) const {
+    return const_cast<StringFlatMap*>(this)->find(key);
+  }
+
+  size_t count(const String& key) const {
+    return FindIndex(key, Mix(key.hash())) == kNotFound ? 0 : 1;
+  }
+
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+    auto [index, inserted] = PrepareInsertIndex(std::forward<K>(key));
+    if (inserted) {
+      new (&slots_[index].second) T(std::forward<Args>(args)...);
+    }
+    return {IteratorAt(index), inserted};
+  }
+
+  T& operator[](const String& key) { return try_emplace(key).first->second; }
+  T& operator[](String&& key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  size_t erase(const String& key) {
+    size_t index = FindIndex(key, Mix(key.hash()));
+    if (index == kNotFound) {
+      return 0;
+    }
+    EraseAt(index);
+    return 1;
+  }
+
+  void clear() {
+    DestroySlots();
+    if (capacity_ > 0) {
+      std::memset(ctrl_, kEmpty, capacity_);
+    }
+    size_ = 0;
+    deleted_ = 0;
+  }
+
+  void reserve(size_t count) {
+    if (count > size_ && NeedsRehash(count - size_)) {
+      Rehash(CapacityFor(count));
+    }
+  }
+
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  /// Returns the slot of the key, or npos. The slot of a key does not change
+  /// until the map is modified, and maps having the same keys inserted in the
+  /// same order keep them in the same slots. So a slot can be kept as a hint
+  /// for finding the same key later, see FindInSlot().
+  size_t FindSlot(const String& key) const {
+    return FindIndex(key, Mix(key.hash()));
+  }
+
+  /// Returns the mapped value if the slot holds the key, or nullptr. Any slot
+  /// is accepted, so stale hints are simply missed.
+  T* FindInSlot(size_t slot, const String& key) {
+    if (slot < capacity_ && IsFull(ctrl_[slot]) &&
+        KeyEqual(slots_[slot].first, key)) {
+      return &slots_[slot].second;
+    }
+    return nullptr;
+  }
+
+  /// Whether the next insertion keeps all the existing entries in place.
+  bool HasRoomForInsert() const { return !NeedsRehash(1); }
+
+  /// Finds the key, or inserts the key with its mapped value left
+  /// uninitialized. Returns the mapped value and whether the key is inserted.
+  /// If inserted, the caller must construct T at the returned address with
+  /// placement new before any other operation on the map.
+  ///
+  /// This is for callers who want to construct T in place without
+  /// instantiating try_emplace() for every argument list.
+  template <typename K>
+  std::pair<T*, bool> PrepareInsert(K&& key) {
+    auto [index, inserted] = PrepareInsertIndex(std::forward<K>(key));
+    return {&slots_[index].second, inserted};
+  }
+
+  friend bool operator==(const StringFlatMap& left,
+                         const StringFlatMap& right) {
+    if (left.size_ != right.size_) {
+      return false;
+    }
+    for (const auto& [key, value] : left) {
+      auto it = right.find(key);
+      if (it == right.end() || !(it->second == value)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  friend bool operator!=(const StringFlatMap& left,
+                         const StringFlatMap& right) {
+    return !(left == right);
+  }
+
+ private:
+  // Has the same layout as value_type but constructing it does not construct
+  // T. See Dictionary::SetValue() for the reason.
+  struct alignas(T) NoOpCtor {
+    [[maybe_unused]] uint8_t buffer_[sizeof(T)];
+  };
+  using UninitializedSlot = std::pair<String, NoOpCtor>;
+  static_assert(sizeof(UninitializedSlot) == sizeof(value_type) &&
+                    alignof(UninitializedSlot) == alignof(value_type),
+                "UninitializedSlot must have the same layout as value_type");
+
+  // RefCountedStringImpl hashes are std::hash results which are not well
+  // distributed in low bits on every platform, mix them before use.
+  static size_t Mix(size_t hash) {
+    uint64_t result = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(result ^ (result >> 32));
+  }
+
+  static uint8_t H2(size_t hash) { return static_cast<uint8_t>(hash & 0x7F); }
+  static size_t H1(size_t hash) { return hash >> 7; }
+
+  static bool KeyEqual(const String& left, const String& right) {
+    return left.c_str() == right.c_str() || left == right;
+  }
+
+  bool IsSmall() const { return capacity_ <= kSmallCapacity; }
+
+  // Small maps grow as 1, 2, 4, 8 and large maps are kept under 7/8 full
+  // including deleted slots.
+  static size_t CapacityFor(size_t count) {
+    if (count <= kSmallCapacity) {
+      size_t capacity = 1;
+      while (capacity < count) {
+        capacity <<= 1;
+      }
+      return capacity;
+    }
+    size_t capacity = kSmallCapacity * 2;
+    while (count * 8 > capacity * 7) {
+      capacity <<= 1;
+    }
+    return capacity;
+  }
+
+  bool NeedsRehash(size_t additional) const {
+    if (IsSmall()) {
+      return size_ + additional > capacity_;
+    }
+    return (size_ + deleted_ + additional) * 8 > capacity_ * 7;
+  }
+
+  iterator IteratorAt(size_t index) {
+    return iterator(ctrl_ + index, ctrl_ + capacity_, slots_ + index);
+  }
+
+  template <typename K>
+  std::pair<size_t, bool> PrepareInsertIndex(K&& key) {
+    size_t hash = Mix(key.hash());
+    size_t index = FindIndex(key, hash);
+    if (index != kNotFound) {
+      return {index, false};
+    }
+    if (NeedsRehash(1)) {
+      Rehash(CapacityFor(size_ + 1));
+    }
+    index = ClaimSlot(hash);
+    auto* slot = reinterpret_cast<UninitializedSlot*>(&slots_[index]);
+    new (slot) UninitializedSlot(std::piecewise_construct,
+                                 std::forward_as_tuple(std::forward<K>(key)),
+                                 std::forward_as_tuple());
+    ++size_;
+    return {index, true};
+  }
+
+  size_t FindIndex(const String& key, size_t hash) const {
+    if (capacity_ == 0) {
+      return kNotFound;
+    }
+    uint8_t h2 = H2(hash);
+    if (IsSmall()) {
+      for (size_t i = 0; i < size_; ++i) {
+        if (ctrl_[i] == h2 && KeyEqual(slots_[i].first, key)) {
+          return i;
+        }
+      }
+      return kNotFound;
+    }
+    size_t mask = capacity_ - 1;
+    for (size_t index = H1(hash) & mask;; index = (index + 1) & mask) {
+      uint8_t ctrl = ctrl_[index];
+      if (ctrl == kEmpty) {
+        return kNotFound;
+      }
+      if (ctrl == h2 && KeyEqual(slots_[index].first, key)) {
+        return index;
+      }
+    }
+  }
+
+  // Marks a free slot for the hash as full and returns it. The key must not
+  // exist and there must be room for it.
+  size_t ClaimSlot(size_t hash) {
+    size_t index;
+    if (IsSmall()) {
+      index = size_;
+    } else {
+      size_t mask = capacity_ - 1;
+      index = H1(hash) & mask;
+      while (IsFull(ctrl_[index])) {
+        index = (index + 1) & mask;
+      }
+      if (ctrl_[index] == kDeleted) {
+        --deleted_;
+      }
+    }
+    ctrl_[index] = H2(hash);
+    return index;
+  }
+
+  void EraseAt(size_t index) {
+    slots_[index].~value_type();
+    --size_;
+    if (IsSmall()) {
+      // Keep entries packed at front.
+      if (index != size_) {
+        new (&slots_[index]) value_type(std::move(slots_[size_]));
+        slots_[size_].~value_type();
+        ctrl_[index] = ctrl_[size_];
+      }
+      ctrl_[size_] = kEmpty;
+      return;
+    }
+    // The next slot being empty means no probe sequence passes this slot.
+    if (ctrl_[(index + 1) & (capacity_ - 1)] == kEmpty) {
+      ctrl_[index] = kEmpty;
+    } else {
+      ctrl_[index] = kDeleted;
+      ++deleted_;
+    }
+  }
+
+  void Rehash(size_t new_capacity) {
+    value_type* old_slots = slots_;
+    uint8_t* old_ctrl = ctrl_;
+    size_t old_capacity = capacity_;
+
+    Allocate(new_capacity);
+    // ClaimSlot() of small maps appends at size_, so count the entries again
+    // while moving them.
+    size_ = 0;
+    deleted_ = 0;
+    for (size_t i = 0; i < old_capacity; ++i) {
+      if (IsFull(old_ctrl[i])) {
+        size_t index = ClaimSlot(Mix(old_slots[i].first.hash()));
+        new (&slots_[index]) value_type(std::move(old_slots[i]));
+        old_slots[i].~value_type();
+        ++size_;
+      }
+    }
+    std::free(old_slots);
+  }
+
+  // Slots and control bytes share one allocation, slots first.
+  void Allocate(size_t capacity) {
+    void* memory = std::malloc(capacity * (sizeof(value_type) + 1));
+    if (memory == nullptr) {
+      std::abort();
+    }
+    slots_ = static_cast<value_type*>(memory);
+    ctrl_ = reinterpret_cast<uint8_t*>(slots_ + capacity);
+    capacity_ = capacity;
+    std::memset(ctrl_, kEmpty, capacity_);
+  }
+
+  void DestroySlots() {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (size_t i = 0; i < capacity_; ++i) {
+        if (IsFull(ctrl_[i])) {
+          slots_[i].~value_type();
+        }
+      }
+    }
+  }
+
+  void Deallocate() {
+    std::free(slots_);
+    slots_ = nullptr;
+    ctrl_ = nullptr;
+    capacity_ = 0;
+  }
+
+  value_type* slots_ = nullptr;
+  uint8_t* ctrl_ = nullptr;
+  size_t capacity_ = 0;
+  size_t size_ = 0;
+  size_t deleted_ = 0;
+};
+
+}  // namespace base
+}  // namespace lynx
+
+#endif  // BASE_INCLUDE_VALUE_STRING_FLAT_MAP_H_
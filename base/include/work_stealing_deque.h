@@ -0,0 +1,157 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef BASE_INCLUDE_WORK_STEALING_DEQUE_H_
+#define BASE_INCLUDE_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lynx {
+namespace base {
+
+/*
+  Chase-Lev work stealing deque, with the memory orderings from "Correct and
+  Efficient Work-Stealing for Weak Memory Models" (Le et al., PPoPP 2013).
+
+  Only the owner thread may Push and Pop, which work on the bottom end in LIFO
+  order. Any thread may Steal, which takes from the top end in FIFO order. The
+  ring buffer grows on demand and never shrinks. Replaced buffers are kept
+  until the deque is destroyed because a stealer may still be reading them.
+
+  T must be trivially copyable, typically a pointer to the real item.
+*/
+template <typename T>
+class WorkStealingDeque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "WorkStealingDeque only holds trivially copyable items");
+
+ public:
+  explicit WorkStealingDeque(int64_t capacity = 64) {
+    int64_t rounded = 1;
+    while (rounded < capacity) {
+      rounded <<= 1;
+    }
+    buffers_.emplace_back(std::make_unique<Buffer>(rounded));
+    buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+  }
+
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  // Owner thread only.
+  void Push(T item) {
+    int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    int64_t top = top_.load(std::memory_order_acquire);
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    if (bottom - top > buffer->capacity - 1) {
+      buffer = Grow(buffer, top, bottom);
+    }
+    buffer->Put(bottom, item);
+    // A release store instead of the release fence of the paper, which is
+    // equivalent here and understood by thread sanitizer.
+    bottom_.store(bottom + 1, std::memory_order_release);
+  }
+
+  // Owner thread only. Returns false if the deque is empty or the last item
+  // was taken by a stealer.
+  bool Pop(T& item) {
+    int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return false;
+    }
+    item = buffer->Get(bottom);
+    if (top == bottom) {
+      // The last item, race with stealers for it.
+      bool won = top_.compare_exchange_strong(top, top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return won;
+    }
+    return true;
+  }
+
+  // Any thread. Returns false if the deque is empty or another thread took
+  // the top item first.
+  bool Steal(T& item) {
+    int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+      return false;
+    }
+    Buffer* buffer = buffer_.load(std::memory_order_acquire);
+    T result = buffer->Get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    item = result;
+    return true;
+  }
+
+  // Any thread. The result is only a hint while other threads are working on
+  // the deque.
+  bool Empty() const { return Size() <= 0; }
+
+  int64_t Size() const {
+    int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    int64_t top = top_.load(std::memory_order_relaxed);
+    return bottom - top;
+  }
+
+ private:
+  struct Buffer {
+    explicit Buffer(int64_t capacity)
+        : capacity(capacity),
+          mask(capacity - 1),
+          items(std::make_unique<std::atomic<T>[]>(capacity)) {}
+
+    T Get(int64_t index) const {
+      return items[index & mask].load(std::memory_order_relaxed);
+    }
+
+    void Put(int64_t index, T item) {
+      items[index & mask].store(item, std::memory_order_relaxed);
+    }
+
+    const int64_t capacity;
+    const int64_t mask;
+    std::unique_ptr<std::atomic<T>[]> items;
+  };
+
+  Buffer* Grow(Buffer* buffer, int64_t top, int64_t bottom) {
+    auto grown = std::make_unique<Buffer>(buffer->capacity * 2);
+    for (int64_t i = top; i < bottom; ++i) {
+      grown->Put(i, buffer->Get(i));
+    }
+    Buffer* result = grown.get();
+    buffers_.emplace_back(std::move(grown));
+    buffer_.store(result, std::memory_order_release);
+    return result;
+  }
+
+  // Keep the indexes on separate cache lines since the owner writes bottom_
+  // and stealers write top_.
+  alignas(64) std::atomic<int64_t> top_{0};
+  alignas(64) std::atomic<int64_t> bottom_{0};
+  std::atomic<Buffer*> buffer_{nullptr};
+  // Owned by the owner thread.
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+}  // namespace base
+}  // namespace lynx
+
+#endif  // BASE_INCLUDE_WORK_STEALING_DEQUE_H_
@@ -0,0 +1,104 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "base/include/concurrent_hash_map.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace base {
+namespace {
+
+TEST(ConcurrentHashMapTest, EmplaceAndFind) {
+  ConcurrentHashMap<std::string, int32_t> map;
+  EXPECT_TRUE(map.Empty());
+  EXPECT_TRUE(map.Emplace("a", 1));
+  EXPECT_FALSE(map.Emplace("a", 2));
+  EXPECT_TRUE(map.Emplace("b", 3));
+  EXPECT_EQ(map.Size(), 2u);
+  EXPECT_TRUE(map.Contains("a"));
+  EXPECT_FALSE(map.Contains("c"));
+  EXPECT_EQ(*map.Find("a"), 1);
+  EXPECT_EQ(*map.Find("b"), 3);
+  EXPECT_FALSE(map.Find("c").has_value());
+}
+
+TEST(ConcurrentHashMapTest, InsertOrAssign) {
+  ConcurrentHashMap<int32_t, int32_t> map;
+  EXPECT_TRUE(map.InsertOrAssign(1, 1));
+  EXPECT_FALSE(map.InsertOrAssign(1, 2));
+  EXPECT_EQ(*map.Find(1), 2);
+  EXPECT_EQ(map.Size(), 1u);
+}
+
+TEST(ConcurrentHashMapTest, EraseAndExtract) {
+  ConcurrentHashMap<int32_t, std::unique_ptr<int32_t>> map;
+  map.Emplace(1, std::make_unique<int32_t>(10));
+  map.Emplace(2, std::make_unique<int32_t>(20));
+  EXPECT_EQ(map.Erase(1), 1u);
+  EXPECT_EQ(map.Erase(1), 0u);
+
+  auto value = map.Extract(2);
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(**value, 20);
+  EXPECT_FALSE(map.Extract(2).has_value());
+  EXPECT_TRUE(map.Empty());
+}
+
+TEST(ConcurrentHashMapTest, VisitAndForEach) {
+  ConcurrentHashMap<int32_t, int32_t> map;
+  for (int32_t i = 0; i < 100; ++i) {
+    map.Emplace(i, i);
+  }
+  EXPECT_TRUE(map.Visit(5, [](int32_t& value) { value = 50; }));
+  EXPECT_FALSE(map.Visit(100, [](int32_t& value) { value = 0; }));
+  EXPECT_EQ(*map.Find(5), 50);
+
+  int32_t count = 0;
+  int32_t sum = 0;
+  map.ForEach([&](int32_t key, int32_t& value) {
+    ++count;
+    sum += value - key;
+  });
+  EXPECT_EQ(count, 100);
+  EXPECT_EQ(sum, 45);
+
+  map.Clear();
+  EXPECT_TRUE(map.Empty());
+}
+
+TEST(ConcurrentHashMapTest, MultiThread) {
+  constexpr int32_t thread_num = 8;
+  constexpr int32_t insert_num = 1000;
+  ConcurrentHashMap<int32_t, int32_t> map;
+  std::vector<std::thread> threads;
+
+  for (auto i = 0; i < thread_num; ++i) {
+    threads.emplace_back([&map, i] {
+      for (auto j = i * insert_num; j < (i + 1) * insert_num; ++j) {
+        map.Emplace(j, j);
+        // Every thread also touches the keys of the others.
+        map.Contains((j + insert_num) % (thread_num * insert_num));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(map.Size(), static_cast<size_t>(thread_num * insert_num));
+  for (auto i = 0; i < thread_num * insert_num; ++i) {
+    EXPECT_EQ(*map.Find(i), i);
+  }
+}
+
+}  // namespace
+}  // namespace base
+}  // namespace lynx
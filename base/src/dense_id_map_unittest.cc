@@ -0,0 +1,119 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "base/include/dense_id_map.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace base {
+namespace {
+
+struct Counted {
+  static int alive;
+  int value;
+  explicit Counted(int value) : value(value) { ++alive; }
+  ~Counted() { --alive; }
+};
+int Counted::alive = 0;
+
+TEST(DenseIdMapTest, EmplaceFindErase) {
+  DenseIdMap<std::string> map;
+  EXPECT_TRUE(map.Empty());
+  EXPECT_EQ(map.Find(10), nullptr);
+
+  auto result = map.Emplace(10, "a");
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*result.first, "a");
+  result = map.Emplace(10, "b");
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(*result.first, "a");
+
+  map[11] = "c";
+  EXPECT_EQ(*map.Find(11), "c");
+  EXPECT_EQ(map.Size(), 2u);
+  EXPECT_TRUE(map.Contains(10));
+  EXPECT_FALSE(map.Contains(12));
+
+  EXPECT_TRUE(map.Erase(10));
+  EXPECT_FALSE(map.Erase(10));
+  EXPECT_EQ(map.Find(10), nullptr);
+  EXPECT_EQ(map.Size(), 1u);
+}
+
+TEST(DenseIdMapTest, OverflowIds) {
+  DenseIdMap<int, 64, 128> map;
+  map[-1] = 1;
+  map[127] = 2;
+  map[128] = 3;
+  map[1 << 30] = 4;
+  EXPECT_EQ(map.Size(), 4u);
+  EXPECT_EQ(*map.Find(-1), 1);
+  EXPECT_EQ(*map.Find(127), 2);
+  EXPECT_EQ(*map.Find(128), 3);
+  EXPECT_EQ(*map.Find(1 << 30), 4);
+  EXPECT_TRUE(map.Erase(-1));
+  EXPECT_TRUE(map.Erase(128));
+  EXPECT_EQ(map.Find(-1), nullptr);
+  EXPECT_EQ(map.Size(), 2u);
+}
+
+TEST(DenseIdMapTest, PointerStability) {
+  DenseIdMap<int, 64> map;
+  int* first = map.Emplace(0, 0).first;
+  for (int i = 1; i < 10000; ++i) {
+    map.Emplace(i, i);
+  }
+  EXPECT_EQ(first, map.Find(0));
+  EXPECT_EQ(*first, 0);
+}
+
+TEST(DenseIdMapTest, ForEach) {
+  DenseIdMap<int, 64> map;
+  std::vector<int> ids = {-5, 3, 64, 65, 1000, 63};
+  for (int id : ids) {
+    map[id] = id * 2;
+  }
+  std::vector<int> visited;
+  map.ForEach([&visited](int32_t id, int& value) {
+    EXPECT_EQ(value, id * 2);
+    visited.push_back(id);
+  });
+  // Dense ids are visited in ascending order before the others.
+  std::vector<int> expected = {3, 63, 64, 65, 1000, -5};
+  EXPECT_EQ(visited, expected);
+}
+
+TEST(DenseIdMapTest, Lifetime) {
+  Counted::alive = 0;
+  {
+    DenseIdMap<Counted, 64> map;
+    for (int i = 0; i < 200; ++i) {
+      map.Emplace(i, i);
+    }
+    map.Emplace(-1, -1);
+    EXPECT_EQ(Counted::alive, 201);
+    // Release the whole first page.
+    for (int i = 0; i < 64; ++i) {
+      map.Erase(i);
+    }
+    EXPECT_EQ(Counted::alive, 137);
+    map.Emplace(0, 0);
+    EXPECT_EQ(map.Find(0)->value, 0);
+
+    DenseIdMap<Counted, 64> other(std::move(map));
+    EXPECT_EQ(map.Size(), 0u);
+    EXPECT_EQ(other.Size(), 138u);
+    EXPECT_EQ(Counted::alive, 138);
+  }
+  EXPECT_EQ(Counted::alive, 0);
+}
+
+}  // namespace
+}  // namespace base
+}  // namespace lynx
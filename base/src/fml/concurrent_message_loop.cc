@@ -7,6 +7,7 @@
 
 #include "base/include/fml/concurrent_message_loop.h"
 
+#include <algorithm>
 #include <thread>
 
 #include "base/include/fml/platform/thread_config_setter.h"
@@ -21,8 +22,38 @@ extern "C" void objc_autoreleasePoolPop(void*);
 namespace lynx {
 namespace fml {
 
-static constexpr uint32_t kWorkerSleepMultipleMicroseconds = 340;
-static constexpr uint32_t kWorkerMaxIdleMicroseconds = 34000;
+// Rounds of stealing before an idle worker parks. Tasks posted in bursts, e.g.
+// by parallel flush of elements, are mostly found within these rounds, which
+// saves the cost of parking and waking up workers.
+static constexpr uint32_t kWorkerSpinCount = 64;
+// Max count of tasks moved from the shared queue to a worker at a time.
+static constexpr size_t kMaxInjectedTaskBatch = 16;
+static constexpr uint32_t kNotWorker = UINT32_MAX;
+
+namespace {
+
+struct CurrentWorker {
+  const ConcurrentMessageLoop* loop;
+  uint32_t index;
+};
+
+CurrentWorker& GetCurrentWorker() {
+  static thread_local CurrentWorker current_worker = {nullptr, kNotWorker};
+  return current_worker;
+}
+
+void RunAndDeleteTask(base::closure* task) {
+  std::unique_ptr<base::closure> holder(task);
+#if defined(OS_IOS)
+  void* pool = objc_autoreleasePoolPush();
+#endif
+  (*holder)();
+#if defined(OS_IOS)
+  objc_autoreleasePoolPop(pool);
+#endif
+}
+
+}  // namespace
 
 std::shared_ptr<ConcurrentMessageLoop> ConcurrentMessageLoop::Create(
     size_t worker_count) {
@@ -53,7 +84,12 @@ ConcurrentMessageLoop::ConcurrentMessageLoop(
     Thread::ThreadPriority priority, size_t worker_count) {
   uint32_t max_worker_count =
       std::max<uint32_t>(static_cast<uint32_t>(worker_count), 1u);
-  worker_count_.store(max_worker_count);
+  // All the queues must be ready before any worker starts to steal.
+  worker_queues_.reserve(max_worker_count);
+  for (uint32_t i = 0; i < max_worker_count; ++i) {
+    worker_queues_.emplace_back(
+        std::make_unique<base::WorkStealingDeque<base::closure*>>());
+  }
   workers_.reserve(max_worker_count);
   for (uint32_t i = 0; i < max_worker_count; ++i) {
     base::closure setup_thread = [name_prefix, i, priority, setter, this]() {
@@ -71,6 +107,14 @@ ConcurrentMessageLoop::~ConcurrentMessageLoop() {
   for (auto& worker : workers_) {
     worker.join();
   }
+  // Workers drain all the tasks before exiting, delete the ones posted after
+  // that if any.
+  for (auto& queue : worker_queues_) {
+    base::closure* task = nullptr;
+    while (queue->Steal(task)) {
+      delete task;
+    }
+  }
 }
 
 size_t ConcurrentMessageLoop::GetWorkerCount() const { return workers_.size(); }
@@ -90,55 +134,120 @@ void ConcurrentMessageLoop::PostTask(base::closure task) {
     return;
   }
 
-  std::unique_lock lock(tasks_mutex_);
-  tasks_.push(std::move(task));
-  lock.unlock();
-
+  // Count the task before it is visible to workers, so that the count never
+  // goes below the number of tasks which can be taken.
   task_count_.fetch_add(1);
 
-  if (worker_count_.load() <= 0) {
-    notify_condition_.notify_all();
+  const auto& current_worker = GetCurrentWorker();
+  if (current_worker.loop == this) {
+    worker_queues_[current_worker.index]->Push(
+        new base::closure(std::move(task)));
+  } else {
+    std::unique_lock lock(tasks_mutex_);
+    tasks_.push(std::move(task));
+    lock.unlock();
+    injected_task_count_.fetch_add(1);
   }
 
-  return;
+  if (parked_worker_count_.load() > 0) {
+    WakeUpWorker();
+  }
 }
 
-void ConcurrentMessageLoop::WorkerMain(uint32_t index) {
-  const uint32_t sleep_microseconds =
-      kWorkerSleepMultipleMicroseconds * (index + 1);
-  const uint32_t max_sleep_count =
-      kWorkerMaxIdleMicroseconds / sleep_microseconds;
-  uint32_t sleep_count_down = 0;
-  while (true) {
-    uint32_t task_count = task_count_.load();
-    while (task_count > 0 &&
-           !task_count_.compare_exchange_weak(task_count, task_count - 1)) {
+void ConcurrentMessageLoop::ParallelFor(
+    size_t count, const std::function<void(size_t)>& body) {
+  if (count == 0) {
+    return;
+  }
+  // Every participant takes the next index until all are taken, which
+  // balances bodies with different costs.
+  std::atomic<size_t> next_index = 0;
+  auto run = [&next_index, &body, count]() {
+    for (size_t i = next_index.fetch_add(1); i < count;
+         i = next_index.fetch_add(1)) {
+      body(i);
     }
+  };
+  ConcurrentTaskGroup group(*this);
+  const size_t helper_count = std::min(count - 1, GetWorkerCount());
+  for (size_t i = 0; i < helper_count; ++i) {
+    group.PostTask([&run]() { run(); });
+  }
+  run();
+  group.Wait();
+}
 
-    if (task_count > 0) {
-      base::closure task;
+void ConcurrentMessageLoop::WakeUpWorker() {
+  // Lock to make sure a worker checking task_count_ before parking either sees
+  // the new task or gets notified.
+  { std::lock_guard lock(notify_mutex_); }
+  notify_condition_.notify_one();
+}
 
-      std::unique_lock lock(tasks_mutex_);
-      if (tasks_.size() != 0) {
-        task = std::move(tasks_.front());
-        tasks_.pop();
-      }
-      lock.unlock();
+base::closure* ConcurrentMessageLoop::TakeInjectedTasks(uint32_t index) {
+  if (injected_task_count_.load(std::memory_order_relaxed) == 0) {
+    return nullptr;
+  }
+  std::unique_lock lock(tasks_mutex_);
+  if (tasks_.empty()) {
+    return nullptr;
+  }
+  // Take a fair share of the queued tasks, so that the others are taken
+  // without locking again, and can be stolen by idle workers.
+  const size_t batch =
+      std::clamp<size_t>(tasks_.size() / workers_.size(), 1,
+                         kMaxInjectedTaskBatch);
+  base::closure* taken[kMaxInjectedTaskBatch];
+  for (size_t i = 0; i < batch; ++i) {
+    taken[i] = new base::closure(std::move(tasks_.front()));
+    tasks_.pop();
+  }
+  lock.unlock();
+  injected_task_count_.fetch_sub(static_cast<uint32_t>(batch));
 
-      if (task) {
-#if defined(OS_IOS)
-        void* pool = objc_autoreleasePoolPush();
-#endif
-        task();
-#if defined(OS_IOS)
-        objc_autoreleasePoolPop(pool);
-#endif
-      }
+  // Push in reverse order, so that the worker pops them in posted order.
+  auto& queue = *worker_queues_[index];
+  for (size_t i = batch - 1; i > 0; --i) {
+    queue.Push(taken[i]);
+  }
+  if (batch > 1 && parked_worker_count_.load() > 0) {
+    WakeUpWorker();
+  }
+  return taken[0];
+}
+
+base::closure* ConcurrentMessageLoop::TakeTask(uint32_t index) {
+  base::closure* task = nullptr;
+  if (worker_queues_[index]->Pop(task)) {
+    return task;
+  }
+  if ((task = TakeInjectedTasks(index)) != nullptr) {
+    return task;
+  }
+  const uint32_t queue_count = static_cast<uint32_t>(worker_queues_.size());
+  for (uint32_t i = 1; i < queue_count; ++i) {
+    if (worker_queues_[(index + i) % queue_count]->Steal(task)) {
+      return task;
+    }
+  }
+  return nullptr;
+}
 
-      std::uint32_t worker_count = worker_count_.load();
-      if (worker_count < workers_.size() && worker_count < (task_count - 1)) {
-        notify_condition_.notify_all();
-      }
+void ConcurrentMessageLoop::WorkerMain(uint32_t index) {
+  GetCurrentWorker() = {this, index};
+  uint32_t spin_count = 0;
+  while (true) {
+    if (base::closure* task = TakeTask(index)) {
+      task_count_.fetch_sub(1);
+      RunAndDeleteTask(task);
+      spin_count = 0;
+      continue;
+    }
+
+    if (task_count_.load() > 0 || spin_count < kWorkerSpinCount) {
+      // Lost the race for a task, or a task may come soon.
+      ++spin_count;
+      std::this_thread::yield();
       continue;
     }
 
@@ -146,21 +255,16 @@ void ConcurrentMessageLoop::WorkerMain(uint32_t index) {
       break;
     }
 
-    if (sleep_count_down == 0) {
-      --worker_count_;
-      std::unique_lock lock(notify_mutex_);
-      notify_condition_.wait(
-          lock, [&]() { return task_count_.load() > 0 || shutdown_; });
-      lock.unlock();
-      ++worker_count_;
-      sleep_count_down = max_sleep_count;
-      TRACE_EVENT("lynx", "ConcurrentWorker AWoke");
-    } else {
-      --sleep_count_down;
-      std::this_thread::sleep_for(
-          std::chrono::microseconds(sleep_microseconds));
-    }
+    ++parked_worker_count_;
+    std::unique_lock lock(notify_mutex_);
+    notify_condition_.wait(
+        lock, [&]() { return task_count_.load() > 0 || shutdown_; });
+    lock.unlock();
+    --parked_worker_count_;
+    spin_count = 0;
+    TRACE_EVENT("lynx", "ConcurrentWorker AWoke");
   }
+  GetCurrentWorker() = {nullptr, kNotWorker};
 }
 
 std::shared_ptr<ConcurrentTaskRunner> ConcurrentMessageLoop::GetTaskRunner() {
@@ -169,6 +273,7 @@ std::shared_ptr<ConcurrentTaskRunner> ConcurrentMessageLoop::GetTaskRunner() {
 
 void ConcurrentMessageLoop::Terminate() {
   shutdown_ = true;
+  { std::lock_guard lock(notify_mutex_); }
   notify_condition_.notify_all();
 }
 
@@ -191,5 +296,60 @@ void ConcurrentTaskRunner::PostTask(lynx::base::closure task) {
   task();
 }
 
+struct ConcurrentTaskGroup::Task {
+  explicit Task(base::closure closure) : closure(std::move(closure)) {}
+
+  bool TryStart() { return !started.exchange(true); }
+
+  std::atomic_bool started = false;
+  base::closure closure;
+};
+
+ConcurrentTaskGroup::ConcurrentTaskGroup(ConcurrentMessageLoop& loop)
+    : loop_(loop) {}
+
+ConcurrentTaskGroup::~ConcurrentTaskGroup() { Wait(); }
+
+void ConcurrentTaskGroup::PostTask(base::closure task) {
+  if (!task) {
+    return;
+  }
+  auto group_task = std::make_shared<Task>(std::move(task));
+  {
+    std::lock_guard lock(mutex_);
+    ++unfinished_count_;
+  }
+  tasks_.emplace_back(group_task);
+  // The group is only touched by the one who starts the task, and Wait() makes
+  // sure the group outlives the started tasks.
+  loop_.PostTask([this, group_task]() {
+    if (group_task->TryStart()) {
+      RunTask(*group_task);
+    }
+  });
+}
+
+void ConcurrentTaskGroup::RunTask(Task& task) {
+  task.closure();
+  task.closure = nullptr;
+  std::lock_guard lock(mutex_);
+  if (--unfinished_count_ == 0) {
+    finish_condition_.notify_all();
+  }
+}
+
+void ConcurrentTaskGroup::Wait() {
+  // Workers take the tasks from the front, so start from the back to avoid
+  // racing with them.
+  for (auto it = tasks_.rbegin(); it != tasks_.rend(); ++it) {
+    if ((*it)->TryStart()) {
+      RunTask(**it);
+    }
+  }
+  tasks_.clear();
+  std::unique_lock lock(mutex_);
+  finish_condition_.wait(lock, [this]() { return unfinished_count_ == 0; });
+}
+
 }  // namespace fml
 }  // namespace lynx
@@ -7,8 +7,10 @@
 
 #define FML_USED_ON_EMBEDDER
 
+#include <atomic>
 #include <iostream>
 #include <thread>
+#include <vector>
 
 #include "base/include/fml/concurrent_message_loop.h"
 #include "base/include/fml/message_loop.h"
@@ -324,6 +326,88 @@ TEST(MessageLoop, CanCreateConcurrentMessageLoop) {
   ASSERT_GE(thread_ids.size(), 1u);
 }
 
+TEST(MessageLoop, ConcurrentMessageLoopRunsTasksPostedFromWorkers) {
+  auto loop = fml::ConcurrentMessageLoop(
+      "", fml::Thread::ThreadPriority::NORMAL, 4);
+  constexpr size_t kCount = 100;
+  fml::CountDownLatch latch(kCount * kCount);
+  std::atomic<size_t> run_count = 0;
+  for (size_t i = 0; i < kCount; ++i) {
+    loop.PostTask([&]() {
+      // Posted to the deque of the worker, and may be stolen by the others.
+      for (size_t j = 0; j < kCount; ++j) {
+        loop.PostTask([&]() {
+          run_count.fetch_add(1);
+          latch.CountDown();
+        });
+      }
+    });
+  }
+  latch.Wait();
+  ASSERT_EQ(run_count.load(), kCount * kCount);
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopRunsTasksBeforeDestruction) {
+  std::atomic<size_t> run_count = 0;
+  {
+    auto loop = fml::ConcurrentMessageLoop(
+        "", fml::Thread::ThreadPriority::NORMAL, 2);
+    for (size_t i = 0; i < 1000; ++i) {
+      loop.PostTask([&]() { run_count.fetch_add(1); });
+    }
+  }
+  ASSERT_EQ(run_count.load(), 1000u);
+}
+
+TEST(MessageLoop, ConcurrentTaskGroupWaitsForAllTasks) {
+  auto loop = fml::ConcurrentMessageLoop(
+      "", fml::Thread::ThreadPriority::NORMAL, 2);
+  std::atomic<size_t> run_count = 0;
+  fml::ConcurrentTaskGroup group(loop);
+  for (size_t i = 0; i < 100; ++i) {
+    group.PostTask([&]() {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+      run_count.fetch_add(1);
+    });
+  }
+  group.Wait();
+  ASSERT_EQ(run_count.load(), 100u);
+
+  // Waiting on a worker does not dead lock even if all the workers wait.
+  fml::CountDownLatch latch(2);
+  for (size_t i = 0; i < 2; ++i) {
+    loop.PostTask([&]() {
+      fml::ConcurrentTaskGroup nested_group(loop);
+      for (size_t j = 0; j < 10; ++j) {
+        nested_group.PostTask([&]() { run_count.fetch_add(1); });
+      }
+      nested_group.Wait();
+      latch.CountDown();
+    });
+  }
+  latch.Wait();
+  ASSERT_EQ(run_count.load(), 120u);
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopParallelFor) {
+  auto loop = fml::ConcurrentMessageLoop(
+      "", fml::Thread::ThreadPriority::NORMAL, 4);
+  std::vector<std::atomic<size_t>> counts(1000);
+  std::atomic<size_t> nested_count = 0;
+  loop.ParallelFor(counts.size(), [&](size_t i) {
+    counts[i].fetch_add(1);
+    // Nested parallel loops run on the workers.
+    if (i % 100 == 0) {
+      loop.ParallelFor(10, [&](size_t j) { nested_count.fetch_add(1); });
+    }
+  });
+  for (const auto& count : counts) {
+    ASSERT_EQ(count.load(), 1u);
+  }
+  ASSERT_EQ(nested_count.load(), 100u);
+  loop.ParallelFor(0, [](size_t i) { FAIL(); });
+}
+
 #if !defined(OS_WIN)
 static void MockThreadConfigSetter(const fml::Thread::ThreadConfig& config) {
   // set thread name
@@ -0,0 +1,182 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "base/include/lru_cache.h"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace base {
+namespace {
+
+struct StringWeigher {
+  size_t operator()(const std::string& value) const { return value.size(); }
+};
+
+TEST(LRUCacheTest, GetAndPut) {
+  LRUCache<int, std::string> cache(2);
+  EXPECT_EQ(cache.Get(1), nullptr);
+  EXPECT_TRUE(cache.Put(1, "a"));
+  EXPECT_TRUE(cache.Put(2, "b"));
+  EXPECT_EQ(*cache.Get(1), "a");
+  // 2 is the least recently used.
+  EXPECT_TRUE(cache.Put(3, "c"));
+  EXPECT_EQ(cache.Get(2), nullptr);
+  EXPECT_EQ(*cache.Get(1), "a");
+  EXPECT_EQ(*cache.Get(3), "c");
+  EXPECT_EQ(cache.Size(), 2u);
+
+  // Put an existing key updates the value and makes it the most recent.
+  EXPECT_TRUE(cache.Put(1, "aa"));
+  EXPECT_TRUE(cache.Put(4, "d"));
+  EXPECT_EQ(*cache.Get(1), "aa");
+  EXPECT_EQ(cache.Get(3), nullptr);
+
+  auto& stats = cache.GetStats();
+  EXPECT_EQ(stats.hits, 4u);
+  EXPECT_EQ(stats.misses, 3u);
+  EXPECT_EQ(stats.evictions, 2u);
+  cache.ResetStats();
+  EXPECT_EQ(cache.GetStats().hits, 0u);
+}
+
+TEST(LRUCacheTest, Weight) {
+  LRUCache<int, std::string, StringWeigher> cache(10);
+  EXPECT_TRUE(cache.Put(1, "aaaa"));
+  EXPECT_TRUE(cache.Put(2, "bbbb"));
+  EXPECT_EQ(cache.Weight(), 8u);
+  EXPECT_TRUE(cache.Put(3, "cc"));
+  EXPECT_EQ(cache.Weight(), 10u);
+  // Evicts 1 only, the rest fit in the capacity.
+  EXPECT_TRUE(cache.Put(4, "d"));
+  EXPECT_EQ(cache.Get(1), nullptr);
+  EXPECT_EQ(*cache.Get(2), "bbbb");
+  EXPECT_EQ(cache.Weight(), 7u);
+  EXPECT_EQ(cache.GetStats().evictions, 1u);
+
+  // Too heavy to be cached, and the old value is dropped.
+  EXPECT_FALSE(cache.Put(3, "ccccccccccc"));
+  EXPECT_EQ(cache.Get(3), nullptr);
+  EXPECT_EQ(cache.Weight(), 5u);
+
+  // Update the weight of an existing entry, which evicts 2.
+  EXPECT_TRUE(cache.Put(5, "eeee"));
+  EXPECT_TRUE(cache.Put(4, "dddddd"));
+  EXPECT_EQ(cache.Weight(), 10u);
+  EXPECT_EQ(cache.Get(2), nullptr);
+  EXPECT_EQ(*cache.Get(5), "eeee");
+
+  cache.SetCapacity(6);
+  EXPECT_EQ(cache.Get(4), nullptr);
+  EXPECT_EQ(cache.Weight(), 4u);
+}
+
+TEST(LRUCacheTest, EvictLeastRecentlyUsed) {
+  LRUCache<int, std::string, StringWeigher> cache(10);
+  size_t weight = 1;
+  EXPECT_EQ(cache.EvictLeastRecentlyUsed(&weight), 0u);
+  EXPECT_EQ(weight, 1u);
+
+  EXPECT_TRUE(cache.Put(1, ""));
+  EXPECT_TRUE(cache.Put(2, "bb"));
+  // An entry of zero weight is still counted as evicted.
+  EXPECT_EQ(cache.EvictLeastRecentlyUsed(&weight), 1u);
+  EXPECT_EQ(weight, 0u);
+  EXPECT_EQ(cache.Get(1), nullptr);
+  EXPECT_EQ(cache.EvictLeastRecentlyUsed(&weight), 1u);
+  EXPECT_EQ(weight, 2u);
+  EXPECT_TRUE(cache.Empty());
+  EXPECT_EQ(cache.Weight(), 0u);
+  EXPECT_EQ(cache.GetStats().evictions, 2u);
+}
+
+TEST(LRUCacheTest, EraseAndClear) {
+  LRUCache<std::string, std::unique_ptr<int>> cache;
+  EXPECT_EQ(cache.Capacity(), static_cast<size_t>(DEFAULT_CAPACITY));
+  for (int i = 0; i < 1000; ++i) {
+    cache.Put(std::to_string(i), std::make_unique<int>(i));
+  }
+  EXPECT_EQ(cache.Size(), static_cast<size_t>(DEFAULT_CAPACITY));
+  EXPECT_EQ(cache.Get("0"), nullptr);
+  EXPECT_EQ(**cache.Get("999"), 999);
+  EXPECT_TRUE(cache.Erase("999"));
+  EXPECT_FALSE(cache.Erase("999"));
+  EXPECT_EQ(cache.Size(), static_cast<size_t>(DEFAULT_CAPACITY - 1));
+
+  cache.Clear();
+  EXPECT_TRUE(cache.Empty());
+  EXPECT_EQ(cache.Weight(), 0u);
+  // Nodes are reused after clear.
+  cache.Put("a", std::make_unique<int>(1));
+  EXPECT_EQ(**cache.Get("a"), 1);
+}
+
+TEST(ConcurrentLRUCacheTest, MultiThread) {
+  constexpr int thread_num = 8;
+  constexpr int put_num = 1000;
+  ConcurrentLRUCache<int, std::shared_ptr<int>> cache(thread_num * put_num);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < thread_num; ++i) {
+    threads.emplace_back([&cache, i] {
+      for (int j = i * put_num; j < (i + 1) * put_num; ++j) {
+        cache.Put(j, std::make_shared<int>(j));
+        cache.Get(j);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto stats = cache.GetStats();
+  EXPECT_EQ(stats.hits + stats.misses,
+            static_cast<uint64_t>(thread_num * put_num));
+  EXPECT_EQ(cache.Size() + stats.evictions,
+            static_cast<size_t>(thread_num * put_num));
+
+  cache.Clear();
+  EXPECT_EQ(cache.Size(), 0u);
+  EXPECT_TRUE(cache.Put(1, std::make_shared<int>(1)));
+  EXPECT_EQ(**cache.Get(1), 1);
+  EXPECT_FALSE(cache.Get(2).has_value());
+}
+
+TEST(ConcurrentLRUCacheTest, HeavyEntry) {
+  ConcurrentLRUCache<int, std::string, StringWeigher> cache(80);
+  // Heavier than capacity / kShardCount, but fits in the whole capacity.
+  EXPECT_TRUE(cache.Put(1, std::string(50, 'a')));
+  EXPECT_EQ(cache.Get(1)->size(), 50u);
+  EXPECT_EQ(cache.Weight(), 50u);
+
+  // Other shards are evicted to make room for the entries.
+  for (int i = 2; i < 20; ++i) {
+    EXPECT_TRUE(cache.Put(i, std::string(10, 'b')));
+    EXPECT_LE(cache.Weight(), cache.Capacity());
+  }
+  EXPECT_EQ(*cache.Get(19), std::string(10, 'b'));
+
+  // An entry as heavy as the whole capacity evicts all the others.
+  EXPECT_TRUE(cache.Put(100, std::string(80, 'c')));
+  EXPECT_EQ(cache.Size(), 1u);
+  EXPECT_EQ(cache.Weight(), 80u);
+  EXPECT_EQ(cache.Get(100)->size(), 80u);
+  EXPECT_FALSE(cache.Put(101, std::string(81, 'd')));
+  EXPECT_EQ(cache.Weight(), 80u);
+
+  cache.SetCapacity(40);
+  EXPECT_EQ(cache.Size(), 0u);
+  EXPECT_EQ(cache.Weight(), 0u);
+  EXPECT_TRUE(cache.Put(1, std::string(40, 'a')));
+  cache.Erase(1);
+  EXPECT_EQ(cache.Weight(), 0u);
+}
+
+}  // namespace
+}  // namespace base
+}  // namespace lynx
@@ -0,0 +1,157 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "base/include/value/string_flat_map.h"
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace base {
+namespace {
+
+TEST(StringFlatMapTest, SmallMap) {
+  StringFlatMap<int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(String("a")), map.end());
+  EXPECT_EQ(map.begin(), map.end());
+
+  for (int i = 0; i < 8; ++i) {
+    auto result = map.try_emplace(String(std::to_string(i)), i);
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(result.first->second, i);
+  }
+  EXPECT_EQ(map.size(), 8u);
+  EXPECT_EQ(map.capacity(), 8u);
+  EXPECT_FALSE(map.try_emplace(String("3"), 30).second);
+  EXPECT_EQ(map.find(String("3"))->second, 3);
+
+  map[String("3")] = 33;
+  EXPECT_EQ(map.find(String("3"))->second, 33);
+  EXPECT_EQ(map.erase(String("0")), 1u);
+  EXPECT_EQ(map.erase(String("0")), 0u);
+  EXPECT_EQ(map.count(String("0")), 0u);
+  EXPECT_EQ(map.size(), 7u);
+  for (int i = 1; i < 8; ++i) {
+    EXPECT_EQ(map.count(String(std::to_string(i))), 1u);
+  }
+}
+
+TEST(StringFlatMapTest, LargeMap) {
+  StringFlatMap<std::string> map;
+  std::unordered_map<std::string, std::string> expected;
+  std::mt19937 random(7);
+  for (int i = 0; i < 20000; ++i) {
+    auto key = std::to_string(random() % 3000);
+    switch (random() % 3) {
+      case 0:
+        map[String(key)] = key + "_value";
+        expected[key] = key + "_value";
+        break;
+      case 1:
+        EXPECT_EQ(map.erase(String(key)), expected.erase(key));
+        break;
+      default: {
+        auto it = map.find(String(key));
+        auto expected_it = expected.find(key);
+        ASSERT_EQ(it == map.end(), expected_it == expected.end());
+        if (it != map.end()) {
+          EXPECT_EQ(it->second, expected_it->second);
+        }
+      }
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+
+  size_t count = 0;
+  for (const auto& [key, value] : map) {
+    EXPECT_EQ(expected[key.str()], value);
+    ++count;
+  }
+  EXPECT_EQ(count, expected.size());
+}
+
+TEST(StringFlatMapTest, CopyMoveAndEqual) {
+  StringFlatMap<std::shared_ptr<int>> map = {
+      {String("a"), std::make_shared<int>(1)},
+      {String("b"), std::make_shared<int>(2)},
+  };
+  for (int i = 0; i < 100; ++i) {
+    map[String(std::to_string(i))] = std::make_shared<int>(i);
+  }
+
+  auto copy = map;
+  EXPECT_EQ(copy.size(), map.size());
+  EXPECT_TRUE(copy == map);
+  EXPECT_EQ(copy.find(String("a"))->second.use_count(), 2);
+
+  copy[String("a")] = std::make_shared<int>(1);
+  EXPECT_FALSE(copy == map);
+
+  auto moved = std::move(copy);
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), map.size());
+
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(moved.begin(), moved.end());
+  EXPECT_EQ(map.find(String("a"))->second.use_count(), 1);
+}
+
+TEST(StringFlatMapTest, PrepareInsert) {
+  StringFlatMap<std::string> map;
+  auto [value, inserted] = map.PrepareInsert(String("key"));
+  EXPECT_TRUE(inserted);
+  new (value) std::string("value");
+
+  auto result = map.PrepareInsert(String("key"));
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(*result.first, "value");
+  EXPECT_TRUE(map.HasRoomForInsert() || map.size() == map.capacity());
+}
+
+TEST(StringFlatMapTest, SlotHint) {
+  for (int count : {4, 100}) {
+    StringFlatMap<int> map;
+    StringFlatMap<int> other;
+    for (int i = 0; i < count; ++i) {
+      map[String(std::to_string(i))] = i;
+      other[String(std::to_string(i))] = i * 2;
+    }
+    String key("3");
+    size_t slot = map.FindSlot(key);
+    ASSERT_NE(slot, StringFlatMap<int>::npos);
+    EXPECT_EQ(*map.FindInSlot(slot, key), 3);
+    // Maps built in the same order share slots.
+    ASSERT_NE(other.FindInSlot(slot, key), nullptr);
+    EXPECT_EQ(*other.FindInSlot(slot, key), 6);
+
+    EXPECT_EQ(map.FindInSlot(slot, String("4")), nullptr);
+    EXPECT_EQ(map.FindInSlot(StringFlatMap<int>::npos, key), nullptr);
+    EXPECT_EQ(map.FindInSlot(map.capacity(), key), nullptr);
+    EXPECT_EQ(map.FindSlot(String("missing")), StringFlatMap<int>::npos);
+
+    map.erase(key);
+    EXPECT_EQ(map.FindInSlot(slot, key), nullptr);
+  }
+}
+
+TEST(StringFlatMapTest, ConstIterator) {
+  StringFlatMap<int> map;
+  map[String("a")] = 1;
+  const auto& const_map = map;
+  StringFlatMap<int>::const_iterator it = map.find(String("a"));
+  EXPECT_EQ(it, const_map.find(String("a")));
+  EXPECT_NE(it, const_map.cend());
+  EXPECT_EQ(++it, map.end());
+}
+
+}  // namespace
+}  // namespace base
+}  // namespace lynx
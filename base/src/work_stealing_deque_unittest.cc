@@ -0,0 +1,96 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "base/include/work_stealing_deque.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace base {
+namespace {
+
+TEST(WorkStealingDequeTest, PushPopAndSteal) {
+  WorkStealingDeque<int> deque(2);
+  int item = 0;
+  EXPECT_TRUE(deque.Empty());
+  EXPECT_FALSE(deque.Pop(item));
+  EXPECT_FALSE(deque.Steal(item));
+
+  // Grows beyond the initial capacity.
+  for (int i = 0; i < 10; ++i) {
+    deque.Push(i);
+  }
+  EXPECT_EQ(deque.Size(), 10);
+
+  // Owner pops from the bottom, and stealers take from the top.
+  EXPECT_TRUE(deque.Pop(item));
+  EXPECT_EQ(item, 9);
+  EXPECT_TRUE(deque.Steal(item));
+  EXPECT_EQ(item, 0);
+  EXPECT_TRUE(deque.Steal(item));
+  EXPECT_EQ(item, 1);
+  for (int i = 8; i >= 2; --i) {
+    EXPECT_TRUE(deque.Pop(item));
+    EXPECT_EQ(item, i);
+  }
+  EXPECT_FALSE(deque.Pop(item));
+  EXPECT_FALSE(deque.Steal(item));
+  EXPECT_TRUE(deque.Empty());
+
+  deque.Push(42);
+  EXPECT_TRUE(deque.Steal(item));
+  EXPECT_EQ(item, 42);
+  EXPECT_FALSE(deque.Pop(item));
+}
+
+TEST(WorkStealingDequeTest, ConcurrentSteal) {
+  constexpr int32_t kItemCount = 100000;
+  constexpr int32_t kStealerCount = 4;
+  WorkStealingDeque<int32_t> deque;
+  std::vector<std::atomic<int32_t>> taken_count(kItemCount);
+  std::atomic_bool done = false;
+
+  std::vector<std::thread> stealers;
+  for (int32_t i = 0; i < kStealerCount; ++i) {
+    stealers.emplace_back([&]() {
+      int32_t item = 0;
+      while (!done.load() || !deque.Empty()) {
+        if (deque.Steal(item)) {
+          taken_count[item].fetch_add(1);
+        }
+      }
+    });
+  }
+
+  // The owner pushes and pops concurrently with the stealers, which grows the
+  // buffer while they are reading it.
+  int32_t item = 0;
+  for (int32_t i = 0; i < kItemCount; ++i) {
+    deque.Push(i);
+    if (i % 3 == 0 && deque.Pop(item)) {
+      taken_count[item].fetch_add(1);
+    }
+  }
+  while (deque.Pop(item)) {
+    taken_count[item].fetch_add(1);
+  }
+  done = true;
+  for (auto& stealer : stealers) {
+    stealer.join();
+  }
+
+  // Every item is taken exactly once.
+  for (int32_t i = 0; i < kItemCount; ++i) {
+    ASSERT_EQ(taken_count[i].load(), 1) << "item " << i;
+  }
+}
+
+}  // namespace
+}  // namespace base
+}  // namespace lynx
@@ -391,10 +391,7 @@ void TaskRunnerManufactor::PostTaskToConcurrentLoop(base::closure task,
                                                     ConcurrentTaskType type) {
   switch (type) {
     case ConcurrentTaskType::HIGH_PRIORITY: {
-      static base::NoDestructor<fml::ConcurrentMessageLoop> high_priority_loop(
-          "LynxHighTask", fml::Thread::ThreadPriority::HIGH,
-          GetConcurrentLoopHighPriorityWorkerCount());
-      high_priority_loop->PostTask(std::move(task));
+      GetHighPriorityLoop().PostTask(std::move(task));
     } break;
     case ConcurrentTaskType::NORMAL_PRIORITY: {
       GetNormalPriorityLoop().PostTask(std::move(task));
@@ -402,6 +399,13 @@ void TaskRunnerManufactor::PostTaskToConcurrentLoop(base::closure task,
   }
 }
 
+fml::ConcurrentMessageLoop& TaskRunnerManufactor::GetHighPriorityLoop() {
+  static base::NoDestructor<fml::ConcurrentMessageLoop> high_priority_loop(
+      "LynxHighTask", fml::Thread::ThreadPriority::HIGH,
+      GetConcurrentLoopHighPriorityWorkerCount());
+  return *high_priority_loop;
+}
+
 fml::ConcurrentMessageLoop& TaskRunnerManufactor::GetNormalPriorityLoop() {
   // TODO(zhoupeng.z): merge with thread pool in LynxThreadPool.java
   constexpr size_t normal_worker_count = 1;
@@ -95,6 +95,10 @@ class TaskRunnerManufactor {
 
   static void PostTaskToConcurrentLoop(base::closure, ConcurrentTaskType type);
 
+  // The loop running the HIGH_PRIORITY tasks, which has as many workers as
+  // the cores by default.
+  static fml::ConcurrentMessageLoop& GetHighPriorityLoop();
+
  private:
   void StartUIThread(bool enable_vsync_aligned_msg_loop);
 
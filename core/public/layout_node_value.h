@@ -3,6 +3,7 @@
 // LICENSE file in the root directory of this source tree.
 #ifndef CORE_PUBLIC_LAYOUT_NODE_VALUE_H_
 #define CORE_PUBLIC_LAYOUT_NODE_VALUE_H_
+#include <cstdint>
 #include <memory>
 
 namespace lynx {
@@ -53,6 +54,11 @@ class MeasureFunc {
   virtual LayoutResult Measure(float width, int32_t width_mode, float height,
                                int32_t height_mode, bool final_measure) = 0;
   virtual void Alignment() = 0;
+  // Returns a key identifying the measured content, e.g. the hash of the text
+  // and the text attributes, with which the results of trying measures are
+  // shared among nodes in the measure cache of LayoutContext. Returns 0 if the
+  // results depend on anything else and should not be shared.
+  virtual uint64_t GetMeasureCacheKey() { return 0; }
 };
 
 }  // namespace tasm
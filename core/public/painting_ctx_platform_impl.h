@@ -165,6 +165,10 @@ class PaintingCtxPlatformImpl {
   // TODO(liting.src): remove this method after ui operation queue refactor.
   virtual base::closure ExecuteOperationSafely(base::closure op) { return op; }
 
+  // Whether operations need to be wrapped by ExecuteOperationSafely(). Others
+  // are enqueued as they are, without being wrapped into a closure.
+  virtual bool NeedExecuteOperationSafely() { return false; }
+
  protected:
   std::shared_ptr<PaintingCtxPlatformRef> platform_ref_;
   std::shared_ptr<shell::TimingCollectorPlatform> timing_collector_platform_;
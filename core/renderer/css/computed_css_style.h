@@ -63,6 +63,8 @@ class ComputedCSSStyle {
     return length_context_.root_node_font_size_;
   }
 
+  float GetFontScale() const { return length_context_.font_scale_; }
+
   void SetScreenWidth(float screen_width) {
     length_context_.screen_width_ = screen_width;
     layout_computed_style_.SetScreenWidth(screen_width);
@@ -3,6 +3,8 @@
 // LICENSE file in the root directory of this source tree.
 #include "core/renderer/css/css_style_sheet_manager.h"
 
+#include <vector>
+
 #include "base/trace/native/trace_event.h"
 #include "core/base/lynx_trace_categories.h"
 #include "core/renderer/css/css_fragment.h"
@@ -46,6 +48,16 @@ SharedCSSFragment* CSSStyleSheetManager::GetCSSStyleSheetForPage(int32_t id) {
 SharedCSSFragment* CSSStyleSheetManager::GetCSSStyleSheet(int32_t id) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, "CSSStyleSheetManager::GetCSSStyleSheet");
   SharedCSSFragment* fragment = GetSharedCSSFragmentById(id);
+  if (!prefetching_fragments_.empty() && prefetching_fragments_.erase(id)) {
+    if (fragment) {
+      ++css_fragment_prefetch_hit_count_;
+    } else {
+      ++css_fragment_prefetch_miss_count_;
+    }
+    TRACE_EVENT_INSTANT(LYNX_TRACE_CATEGORY, "CSSFragmentPrefetch", "hits",
+                        css_fragment_prefetch_hit_count_, "misses",
+                        css_fragment_prefetch_miss_count_);
+  }
   if (fragment == nullptr) {
     if (delegate_ && delegate_->DecodeCSSFragmentById(id)) {
       fragment = GetSharedCSSFragmentById(id);
@@ -77,12 +89,39 @@ void CSSStyleSheetManager::FlatDependentCSS(SharedCSSFragment* fragment) {
 }
 
 void CSSStyleSheetManager::FlattenAllCSSFragment() {
-  std::for_each(raw_fragments_->begin(), raw_fragments_->end(),
-                [this](const auto& fragment) {
-                  this->FlatDependentCSS(fragment.second.get());
+  // FlatDependentCSS looks up raw_fragments_ again, so collect the fragments
+  // first instead of flattening them inside ForEach.
+  std::vector<SharedCSSFragment*> fragments;
+  raw_fragments_->ForEach([&fragments](int32_t, const auto& fragment) {
+    fragments.push_back(fragment.get());
+  });
+  std::for_each(fragments.begin(), fragments.end(),
+                [this](SharedCSSFragment* fragment) {
+                  this->FlatDependentCSS(fragment);
                 });
 }
 
+std::shared_ptr<std::atomic_bool>
+CSSStyleSheetManager::StartCSSFragmentPrefetch(int32_t id) {
+  if (stop_thread_ || raw_fragments_->Contains(id) ||
+      !prefetching_fragments_.insert(id).second) {
+    return nullptr;
+  }
+  if (!prefetch_cancelled_flag_) {
+    prefetch_cancelled_flag_ = std::make_shared<std::atomic_bool>(false);
+  }
+  return prefetch_cancelled_flag_;
+}
+
+void CSSStyleSheetManager::CancelCSSFragmentPrefetch() {
+  if (prefetch_cancelled_flag_) {
+    *prefetch_cancelled_flag_ = true;
+    // Prefetches started later use a new flag.
+    prefetch_cancelled_flag_ = nullptr;
+  }
+  prefetching_fragments_.clear();
+}
+
 void CSSStyleSheetManager::CopyFrom(const CSSStyleSheetManager& other) {
   raw_fragments_ = other.raw_fragments_;
   enable_new_import_rule_ = other.enable_new_import_rule_;
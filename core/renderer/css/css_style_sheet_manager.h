@@ -5,12 +5,13 @@
 #ifndef CORE_RENDERER_CSS_CSS_STYLE_SHEET_MANAGER_H_
 #define CORE_RENDERER_CSS_CSS_STYLE_SHEET_MANAGER_H_
 
+#include <atomic>
 #include <memory>
-#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
+#include "base/include/concurrent_hash_map.h"
 #include "core/renderer/css/shared_css_fragment.h"
 #include "core/renderer/page_config.h"
 #include "core/template_bundle/template_codec/moulds.h"
@@ -28,8 +29,11 @@ class CSSStyleSheetDelegate {
 
 class CSSStyleSheetManager {
  public:
+  // Fragments are decoded by the css async decoding thread and read by the tasm
+  // thread at the same time, so they are kept in a sharded map to avoid both
+  // threads contending on a single lock.
   using CSSFragmentMap =
-      std::unordered_map<int32_t, std::unique_ptr<SharedCSSFragment>>;
+      base::ConcurrentHashMap<int32_t, std::unique_ptr<SharedCSSFragment>>;
 
   CSSStyleSheetManager(CSSStyleSheetDelegate* delegate)
       : raw_fragments_(std::make_shared<CSSFragmentMap>()),
@@ -43,35 +47,28 @@ class CSSStyleSheetManager {
   void SetThreadStopFlag(bool stop_thread) { stop_thread_ = stop_thread; }
 
   SharedCSSFragment* GetSharedCSSFragmentById(int32_t id) {
-    std::lock_guard<std::mutex> g_lock(fragment_mutex_);
-    decoded_fragment_.emplace(id);
-    auto fragment_iter = raw_fragments_->find(id);
-    return fragment_iter != raw_fragments_->end() ? fragment_iter->second.get()
-                                                  : nullptr;
+    decoded_fragment_.Emplace(id, true);
+    SharedCSSFragment* result = nullptr;
+    raw_fragments_->Visit(
+        id, [&result](const auto& fragment) { result = fragment.get(); });
+    return result;
   }
 
   bool IsSharedCSSFragmentDecoded(int32_t id) {
-    std::lock_guard<std::mutex> g_lock(fragment_mutex_);
-    if (decoded_fragment_.find(id) != decoded_fragment_.end()) {
-      return true;
-    }
-    return false;
+    return decoded_fragment_.Contains(id);
   }
 
   void AddSharedCSSFragment(std::unique_ptr<SharedCSSFragment> fragment) {
-    std::lock_guard<std::mutex> g_lock(fragment_mutex_);
-    raw_fragments_->emplace(fragment->id(), std::move(fragment));
+    auto id = fragment->id();
+    raw_fragments_->Emplace(id, std::move(fragment));
   }
 
   void ReplaceSharedCSSFragment(std::unique_ptr<SharedCSSFragment> fragment) {
-    std::lock_guard<std::mutex> g_lock(fragment_mutex_);
-    raw_fragments_->insert_or_assign(fragment->id(), std::move(fragment));
+    auto id = fragment->id();
+    raw_fragments_->InsertOrAssign(id, std::move(fragment));
   }
 
-  void RemoveSharedCSSFragment(int32_t id) {
-    std::lock_guard<std::mutex> g_lock(fragment_mutex_);
-    raw_fragments_->erase(id);
-  }
+  void RemoveSharedCSSFragment(int32_t id) { raw_fragments_->Erase(id); }
 
   void SetEnableNewImportRule(bool enable) { enable_new_import_rule_ = enable; }
 
@@ -89,6 +86,28 @@ class CSSStyleSheetManager {
 
   bool GetEnableCSSLazyImport() { return enable_css_lazy_import_; }
 
+  // Called on the tasm thread before a fragment is prefetched on the css
+  // decoding thread. Returns the flag which cancels the prefetch, or nullptr
+  // if the fragment has been decoded or is being prefetched.
+  std::shared_ptr<std::atomic_bool> StartCSSFragmentPrefetch(int32_t id);
+
+  // Stop all the pending prefetches. Fragments which have been decoded are
+  // kept.
+  void CancelCSSFragmentPrefetch();
+
+  bool IsCSSFragmentPrefetchCancelled(const std::atomic_bool& cancelled) const {
+    return cancelled || stop_thread_;
+  }
+
+  // A prefetched fragment is a hit if it has been decoded when it is first
+  // requested, and a miss if it is decoded on the tasm thread.
+  uint32_t css_fragment_prefetch_hit_count() const {
+    return css_fragment_prefetch_hit_count_;
+  }
+  uint32_t css_fragment_prefetch_miss_count() const {
+    return css_fragment_prefetch_miss_count_;
+  }
+
  private:
   friend class TemplateBinaryReader;
   friend class TemplateBinaryReaderSSR;
@@ -98,17 +117,24 @@ class CSSStyleSheetManager {
   void FlatDependentCSS(SharedCSSFragment* fragment);
 
   CSSRoute route_;
-  CSSFragmentMap page_fragments_;
+  // only accessed on tasm thread
+  std::unordered_map<int32_t, std::unique_ptr<SharedCSSFragment>>
+      page_fragments_;
   // shared in pre-decoding
   std::shared_ptr<CSSFragmentMap> raw_fragments_;
   CSSStyleSheetDelegate* delegate_ = nullptr;
-  std::unordered_set<int> decoded_fragment_;
+  base::ConcurrentHashMap<int32_t, bool> decoded_fragment_;
   volatile std::atomic_bool stop_thread_ = false;
-  std::mutex fragment_mutex_;
   bool enable_new_import_rule_ = false;
 
   // enableCSSLazyImport default value is false.
   bool enable_css_lazy_import_ = false;
+
+  // Prefetches are only started and counted on the tasm thread.
+  std::unordered_set<int32_t> prefetching_fragments_;
+  std::shared_ptr<std::atomic_bool> prefetch_cancelled_flag_;
+  uint32_t css_fragment_prefetch_hit_count_ = 0;
+  uint32_t css_fragment_prefetch_miss_count_ = 0;
 };
 
 }  // namespace tasm
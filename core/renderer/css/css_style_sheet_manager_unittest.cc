@@ -54,7 +54,7 @@ TEST_F(CSSStyleSheetManagerTest, LoadTemplate) {
   auto entry = tasm->FindEntry(DEFAULT_ENTRY_NAME);
 
   auto manager = entry->GetStyleSheetManager();
-  EXPECT_EQ(manager->raw_fragments().size(), static_cast<size_t>(3));
+  EXPECT_EQ(manager->raw_fragments().Size(), static_cast<size_t>(3));
   // pm->css_id();
   auto pf = manager->GetCSSStyleSheetForPage(2);
   EXPECT_TRUE(pf);
@@ -96,6 +96,48 @@ TEST_F(CSSStyleSheetManagerTest, Pseudo) {
   EXPECT_TRUE(cf->GetKeyframesRule("opacity-ani"));
 }
 
+TEST_F(CSSStyleSheetManagerTest, CSSFragmentPrefetch) {
+  CSSStyleSheetManager manager(nullptr);
+  auto cancelled = manager.StartCSSFragmentPrefetch(1);
+  ASSERT_TRUE(cancelled);
+  EXPECT_FALSE(*cancelled);
+  // The fragment is being prefetched.
+  EXPECT_FALSE(manager.StartCSSFragmentPrefetch(1));
+
+  // Prefetched before it is requested.
+  manager.AddSharedCSSFragment(
+      std::make_unique<SharedCSSFragment>(1, &manager));
+  EXPECT_TRUE(manager.GetCSSStyleSheet(1));
+  EXPECT_EQ(manager.css_fragment_prefetch_hit_count(), 1u);
+  EXPECT_EQ(manager.css_fragment_prefetch_miss_count(), 0u);
+  // Counted only once, and decoded fragments are not prefetched again.
+  EXPECT_TRUE(manager.GetCSSStyleSheet(1));
+  EXPECT_EQ(manager.css_fragment_prefetch_hit_count(), 1u);
+  EXPECT_FALSE(manager.StartCSSFragmentPrefetch(1));
+
+  // Requested before it is prefetched.
+  EXPECT_TRUE(manager.StartCSSFragmentPrefetch(2));
+  EXPECT_FALSE(manager.GetCSSStyleSheet(2));
+  EXPECT_EQ(manager.css_fragment_prefetch_miss_count(), 1u);
+
+  // Cancelled prefetches are not counted, and later ones use a new flag.
+  auto cancelled_3 = manager.StartCSSFragmentPrefetch(3);
+  ASSERT_TRUE(cancelled_3);
+  manager.CancelCSSFragmentPrefetch();
+  EXPECT_TRUE(*cancelled_3);
+  EXPECT_TRUE(manager.IsCSSFragmentPrefetchCancelled(*cancelled_3));
+  EXPECT_FALSE(manager.GetCSSStyleSheet(3));
+  EXPECT_EQ(manager.css_fragment_prefetch_miss_count(), 1u);
+  auto cancelled_4 = manager.StartCSSFragmentPrefetch(4);
+  ASSERT_TRUE(cancelled_4);
+  EXPECT_FALSE(*cancelled_4);
+
+  // No prefetch after the decoding threads are stopped.
+  manager.SetThreadStopFlag(true);
+  EXPECT_TRUE(manager.IsCSSFragmentPrefetchCancelled(*cancelled_4));
+  EXPECT_FALSE(manager.StartCSSFragmentPrefetch(5));
+}
+
 // TODO(songshourui.null): enable this test after replace fontfaces.js
 TEST_F(CSSStyleSheetManagerTest, DISABLED_Fontfaces) {
   // testing/fontfaces
@@ -8,11 +8,44 @@
 #include <unordered_map>
 
 #include "core/renderer/lynx_env_config.h"
+#include "core/renderer/ui_wrapper/layout/measure_cache.h"
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
 
 namespace lynx {
 namespace tasm {
 
+namespace {
+
+class CountingMeasureFunc : public MeasureFunc {
+ public:
+  CountingMeasureFunc(uint64_t key, int* count) : key_(key), count_(count) {}
+  ~CountingMeasureFunc() override = default;
+
+  LayoutResult Measure(float width, int32_t width_mode, float height,
+                       int32_t height_mode, bool final_measure) override {
+    ++*count_;
+    return LayoutResult(width / 2, 20.f);
+  }
+  void Alignment() override {}
+  uint64_t GetMeasureCacheKey() override { return key_; }
+
+ private:
+  uint64_t key_;
+  int* count_;
+};
+
+FloatSize Measure(LayoutNode* node, float width, bool final_measure) {
+  starlight::Constraints constraints;
+  constraints[starlight::kHorizontal] =
+      starlight::OneSideConstraint::AtMost(width);
+  constraints[starlight::kVertical] =
+      starlight::OneSideConstraint::Indefinite();
+  return node->slnode()->GetSLMeasureFunc()(node->slnode()->GetContext(),
+                                            constraints, final_measure);
+}
+
+}  // namespace
+
 class LayoutNodeTests : public ::testing::Test {
  protected:
   LayoutNodeTests() = default;
@@ -188,5 +221,57 @@ TEST_F(LayoutNodeTests, RemoveCommonWithinVirtual) {
   EXPECT_EQ(child0->slnode(), child2->slnode()->Previous());
 }
 
+TEST_F(LayoutNodeTests, SharedMeasureCache) {
+  MeasureCache cache;
+  int count = 0;
+  auto child0 = CommonNode();
+  auto child1 = CommonNode();
+  auto child2 = CommonNode();
+  child0->SetMeasureFunc(std::make_unique<CountingMeasureFunc>(42, &count),
+                         &cache);
+  child1->SetMeasureFunc(std::make_unique<CountingMeasureFunc>(42, &count),
+                         &cache);
+  child2->SetMeasureFunc(std::make_unique<CountingMeasureFunc>(43, &count),
+                         &cache);
+
+  EXPECT_FLOAT_EQ(Measure(child0, 100.f, false).width_, 50.f);
+  EXPECT_EQ(count, 1);
+  // Trying measures of the same content and constraints hit the cache, even
+  // on other nodes and after the node is marked dirty.
+  child0->MarkDirty();
+  EXPECT_FLOAT_EQ(Measure(child0, 100.f, false).width_, 50.f);
+  EXPECT_FLOAT_EQ(Measure(child1, 100.f, false).width_, 50.f);
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(cache.GetStats().hits, 2u);
+
+  // Different content or constraints miss.
+  EXPECT_FLOAT_EQ(Measure(child2, 100.f, false).width_, 50.f);
+  EXPECT_FLOAT_EQ(Measure(child1, 80.f, false).width_, 40.f);
+  EXPECT_EQ(count, 3);
+
+  // Final measures always reach the platform.
+  EXPECT_FLOAT_EQ(Measure(child1, 100.f, true).width_, 50.f);
+  EXPECT_EQ(count, 4);
+  EXPECT_EQ(cache.GetStats().misses, 3u);
+  EXPECT_FLOAT_EQ(cache.HitRate(), 0.4f);
+
+  // Font scale is a part of the key.
+  child1->ConsumeFontSize(14.f, 14.f, 2.f);
+  Measure(child1, 100.f, false);
+  EXPECT_EQ(count, 5);
+}
+
+TEST_F(LayoutNodeTests, MeasureWithoutCacheKey) {
+  MeasureCache cache;
+  int count = 0;
+  auto child = CommonNode();
+  child->SetMeasureFunc(std::make_unique<CountingMeasureFunc>(0, &count),
+                        &cache);
+  Measure(child, 100.f, false);
+  Measure(child, 100.f, false);
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(cache.Size(), 0u);
+}
+
 }  // namespace tasm
 }  // namespace lynx
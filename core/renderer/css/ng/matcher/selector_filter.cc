@@ -0,0 +1,157 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/css/ng/matcher/selector_filter.h"
+
+#include <vector>
+
+#include "base/include/log/logging.h"
+#include "base/trace/native/trace_event.h"
+#include "core/base/lynx_trace_categories.h"
+
+namespace lynx {
+namespace css {
+
+namespace {
+
+// Salts to avoid collisions between the ids, classes and tags with the same
+// name.
+constexpr uint32_t kIdSalt = 13;
+constexpr uint32_t kClassSalt = 11;
+constexpr uint32_t kTagSalt = 7;
+
+// 32-bit FNV-1a.
+uint32_t StringHash(const std::string& str) {
+  uint32_t hash = 2166136261u;
+  for (unsigned char c : str) {
+    hash ^= c;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+}  // namespace
+
+uint32_t SelectorIdHash(const std::string& id) {
+  return StringHash(id) * kIdSalt;
+}
+
+uint32_t SelectorClassHash(const std::string& class_name) {
+  return StringHash(class_name) * kClassSalt;
+}
+
+uint32_t SelectorTagHash(const std::string& tag) {
+  return StringHash(tag) * kTagSalt;
+}
+
+template <typename Callback>
+static void ForEachNodeHash(const StyleNode& node, Callback callback) {
+  const auto& id = node.idSelector();
+  if (!id.empty()) {
+    callback(SelectorIdHash(id.str()));
+  }
+  for (const auto& c : node.classes()) {
+    callback(SelectorClassHash(c.str()));
+  }
+  callback(SelectorTagHash(node.tag().str()));
+}
+
+void SelectorFilter::PushNode(const StyleNode& node) {
+  ForEachNodeHash(node, [this](uint32_t hash) { Add(hash); });
+}
+
+void SelectorFilter::PopNode(const StyleNode& node) {
+  ForEachNodeHash(node, [this](uint32_t hash) { Remove(hash); });
+}
+
+void SelectorFilter::PushAncestors(const StyleNode& node) {
+  for (StyleNode* parent = node.SelectorMatchingParent(); parent;
+       parent = parent->SelectorMatchingParent()) {
+    PushNode(*parent);
+  }
+}
+
+void SelectorFilter::PushParent(const StyleNode& parent) {
+  parents_.push_back({&parent, parent_hashes_.size()});
+  ForEachNodeHash(parent, [this](uint32_t hash) {
+    Add(hash);
+    parent_hashes_.push_back(hash);
+  });
+}
+
+void SelectorFilter::PopParent() {
+  DCHECK(!parents_.empty());
+  const size_t hash_offset = parents_.back().hash_offset;
+  for (size_t i = hash_offset; i < parent_hashes_.size(); ++i) {
+    Remove(parent_hashes_[i]);
+  }
+  parent_hashes_.resize(hash_offset);
+  parents_.pop_back();
+}
+
+void SelectorFilter::Clear() {
+  counters_.fill(0);
+  parents_.clear();
+  parent_hashes_.clear();
+}
+
+static SelectorFilter& CurrentThreadFilter() {
+  static thread_local SelectorFilter filter;
+  return filter;
+}
+
+SelectorFilterScope::SelectorFilterScope(const StyleNode* node) {
+  if (!node) {
+    return;
+  }
+  SelectorFilter& filter = CurrentThreadFilter();
+  const StyleNode* parent = node->HolderParent();
+  if (filter.ParentStackIsEmpty()) {
+    // Start of a traversal, which may be a subtree of the page.
+    is_traversal_root_ = true;
+    std::vector<const StyleNode*> ancestors;
+    for (; parent; parent = parent->HolderParent()) {
+      ancestors.push_back(parent);
+    }
+    for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
+      filter.PushParent(**it);
+    }
+    pushed_count_ = ancestors.size();
+  } else if (!filter.ParentStackIsConsistent(parent)) {
+    // Not a child of the traversal, e.g. an element flushed by a nested
+    // traversal. Its descendants build the filter themselves.
+    return;
+  }
+  filter.PushParent(*node);
+  ++pushed_count_;
+}
+
+SelectorFilterScope::~SelectorFilterScope() {
+  SelectorFilter& filter = CurrentThreadFilter();
+  for (size_t i = 0; i < pushed_count_; ++i) {
+    filter.PopParent();
+  }
+  if (is_traversal_root_) {
+    DCHECK(filter.ParentStackIsEmpty());
+    if (filter.hit_count() != 0 || filter.reject_count() != 0) {
+      TRACE_EVENT_INSTANT(LYNX_TRACE_CATEGORY, "SelectorFilter", "hits",
+                          filter.hit_count(), "rejects",
+                          filter.reject_count());
+      filter.ResetStatistics();
+    }
+  }
+}
+
+// static
+SelectorFilter* SelectorFilterScope::FilterForNode(const StyleNode& node) {
+  SelectorFilter& filter = CurrentThreadFilter();
+  if (filter.ParentStackIsEmpty() ||
+      !filter.ParentStackIsConsistent(node.HolderParent())) {
+    return nullptr;
+  }
+  return &filter;
+}
+
+}  // namespace css
+}  // namespace lynx
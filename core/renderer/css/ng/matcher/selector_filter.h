@@ -0,0 +1,146 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_RENDERER_CSS_NG_MATCHER_SELECTOR_FILTER_H_
+#define CORE_RENDERER_CSS_NG_MATCHER_SELECTOR_FILTER_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/renderer/css/style_node.h"
+
+namespace lynx {
+namespace css {
+
+// Hashes of the ids, classes and tags, salted by the type so that ".a" and
+// "#a" are different keys. They are computed by the encoder and stored in the
+// template binary, so they must be stable across platforms and must not use
+// std::hash.
+uint32_t SelectorIdHash(const std::string& id);
+uint32_t SelectorClassHash(const std::string& class_name);
+uint32_t SelectorTagHash(const std::string& tag);
+
+// A counting bloom filter of the ids, classes and tags of the ancestors of a
+// node. Rules whose ancestor hashes are not all in the filter can not match
+// and are rejected without walking up the tree. Elements are removed in the
+// reverse order they are added, so the filter can be maintained incrementally
+// while traversing the tree.
+class SelectorFilter {
+ public:
+  SelectorFilter() { counters_.fill(0); }
+
+  void Add(uint32_t hash) {
+    Increment(FirstSlot(hash));
+    Increment(SecondSlot(hash));
+  }
+  void Remove(uint32_t hash) {
+    Decrement(FirstSlot(hash));
+    Decrement(SecondSlot(hash));
+  }
+  bool MayContain(uint32_t hash) const {
+    return counters_[FirstSlot(hash)] && counters_[SecondSlot(hash)];
+  }
+
+  // Adds or removes the id, the classes and the tag of the node.
+  void PushNode(const StyleNode& node);
+  void PopNode(const StyleNode& node);
+
+  // Adds all the ancestors of the node. The result is the same as pushing
+  // them one by one from the root.
+  void PushAncestors(const StyleNode& node);
+
+  // The parents pushed while traversing the tree. The hashes are saved so
+  // that they are removed correctly even if the node has changed.
+  void PushParent(const StyleNode& parent);
+  void PopParent();
+  bool ParentStackIsEmpty() const { return parents_.empty(); }
+  // Returns true if the filter has exactly the ancestors of a node with the
+  // parent.
+  bool ParentStackIsConsistent(const StyleNode* parent) const {
+    return parents_.empty() ? parent == nullptr
+                            : parents_.back().node == parent;
+  }
+
+  void Clear();
+
+  // Statistics of the rules checked against the filter.
+  void RecordFastReject(bool rejected) {
+    if (rejected) {
+      ++reject_count_;
+    } else {
+      ++hit_count_;
+    }
+  }
+  uint32_t hit_count() const { return hit_count_; }
+  uint32_t reject_count() const { return reject_count_; }
+  void ResetStatistics() {
+    hit_count_ = 0;
+    reject_count_ = 0;
+  }
+
+ private:
+  static constexpr uint32_t kKeyBits = 12;
+  static constexpr uint32_t kTableSize = 1 << kKeyBits;
+  static constexpr uint32_t kKeyMask = kTableSize - 1;
+  // A saturated counter is never decremented, which only makes the filter
+  // less selective.
+  static constexpr uint8_t kMaxCount = UINT8_MAX;
+
+  static uint32_t FirstSlot(uint32_t hash) { return hash & kKeyMask; }
+  static uint32_t SecondSlot(uint32_t hash) {
+    return (hash >> kKeyBits) & kKeyMask;
+  }
+
+  void Increment(uint32_t slot) {
+    if (counters_[slot] != kMaxCount) {
+      ++counters_[slot];
+    }
+  }
+  void Decrement(uint32_t slot) {
+    if (counters_[slot] != kMaxCount && counters_[slot] != 0) {
+      --counters_[slot];
+    }
+  }
+
+  struct ParentStackFrame {
+    const StyleNode* node;
+    // The start of the hashes of the node in parent_hashes_.
+    size_t hash_offset;
+  };
+
+  std::array<uint8_t, kTableSize> counters_;
+  std::vector<ParentStackFrame> parents_;
+  std::vector<uint32_t> parent_hashes_;
+  uint32_t hit_count_ = 0;
+  uint32_t reject_count_ = 0;
+};
+
+// Maintains the ancestor filter of the traversal on the current thread. The
+// scope of a node pushes the node, so that the styles of its descendants
+// resolved within the scope can use the filter. The first scope of a
+// traversal also pushes the ancestors of its node, and reports the statistics
+// of the filter to the trace when it ends.
+class SelectorFilterScope {
+ public:
+  explicit SelectorFilterScope(const StyleNode* node);
+  ~SelectorFilterScope();
+
+  SelectorFilterScope(const SelectorFilterScope&) = delete;
+  SelectorFilterScope& operator=(const SelectorFilterScope&) = delete;
+
+  // Returns the filter of the traversal on the current thread if it has
+  // exactly the ancestors of the node, otherwise nullptr.
+  static SelectorFilter* FilterForNode(const StyleNode& node);
+
+ private:
+  size_t pushed_count_ = 0;
+  bool is_traversal_root_ = false;
+};
+
+}  // namespace css
+}  // namespace lynx
+
+#endif  // CORE_RENDERER_CSS_NG_MATCHER_SELECTOR_FILTER_H_
@@ -0,0 +1,292 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/css/ng/matcher/selector_program.h"
+
+#include <string>
+
+#include "base/include/log/logging.h"
+#include "core/renderer/css/ng/css_ng_utils.h"
+
+namespace lynx {
+namespace css {
+
+SelectorProgram SelectorProgram::Compile(const LynxCSSSelector& selector) {
+  SelectorProgram program;
+  program.CollectAncestorHashes(selector);
+  if (!program.CompileInstructions(selector)) {
+    program.instructions_.clear();
+    program.strings_.clear();
+  }
+  return program;
+}
+
+bool SelectorProgram::CompileInstructions(const LynxCSSSelector& selector) {
+  for (const LynxCSSSelector* current = &selector; current;
+       current = current->TagHistory()) {
+    if (!CompileSimple(*current)) {
+      return false;
+    }
+    if (current->IsLastInTagHistory()) {
+      break;
+    }
+    switch (current->Relation()) {
+      case LynxCSSSelector::kSubSelector:
+        break;
+      case LynxCSSSelector::kDescendant:
+        instructions_.push_back({kDescendant, 0});
+        break;
+      case LynxCSSSelector::kChild:
+        instructions_.push_back({kChild, 0});
+        break;
+      case LynxCSSSelector::kDirectAdjacent:
+        instructions_.push_back({kDirectAdjacent, 0});
+        break;
+      case LynxCSSSelector::kIndirectAdjacent:
+        instructions_.push_back({kIndirectAdjacent, 0});
+        break;
+      case LynxCSSSelector::kUAShadow:
+        instructions_.push_back({kUAShadow, 0});
+        break;
+      default:
+        return false;
+    }
+  }
+  instructions_.push_back({kEnd, 0});
+  return true;
+}
+
+bool SelectorProgram::CompileSimple(const LynxCSSSelector& selector) {
+  switch (selector.Match()) {
+    case LynxCSSSelector::kTag:
+      // The universal selector matches any node.
+      if (selector.Value() != CSSGlobalStarString()) {
+        instructions_.push_back(
+            {kMatchTag, AddStringOperand(selector.Value())});
+      }
+      return true;
+    case LynxCSSSelector::kClass:
+      instructions_.push_back(
+          {kMatchClass, AddStringOperand(selector.Value())});
+      return true;
+    case LynxCSSSelector::kId:
+      instructions_.push_back({kMatchId, AddStringOperand(selector.Value())});
+      return true;
+    case LynxCSSSelector::kPseudoClass:
+      switch (selector.GetPseudoType()) {
+        case LynxCSSSelector::kPseudoHover:
+          instructions_.push_back({kMatchPseudoState, tasm::kPseudoStateHover});
+          return true;
+        case LynxCSSSelector::kPseudoActive:
+          instructions_.push_back(
+              {kMatchPseudoState, tasm::kPseudoStateActive});
+          return true;
+        case LynxCSSSelector::kPseudoFocus:
+          instructions_.push_back({kMatchPseudoState, tasm::kPseudoStateFocus});
+          return true;
+        case LynxCSSSelector::kPseudoRoot:
+          instructions_.push_back({kMatchRoot, 0});
+          return true;
+        default:
+          return false;
+      }
+    case LynxCSSSelector::kPseudoElement:
+      switch (selector.GetPseudoType()) {
+        case LynxCSSSelector::kPseudoPlaceholder:
+          instructions_.push_back(
+              {kMatchPseudoState, tasm::kPseudoStatePlaceHolder});
+          return true;
+        case LynxCSSSelector::kPseudoSelection:
+          instructions_.push_back(
+              {kMatchPseudoState, tasm::kPseudoStateSelection});
+          return true;
+        default:
+          return false;
+      }
+    default:
+      return false;
+  }
+}
+
+void SelectorProgram::CollectAncestorHashes(const LynxCSSSelector& selector) {
+  // Only the compounds reached by descendant and child relations are
+  // ancestors of the matched node, the siblings are skipped. Same as the
+  // selector filter of Blink.
+  LynxCSSSelector::RelationType relation = selector.Relation();
+  bool skip_over_sub_selectors = true;
+  for (const LynxCSSSelector* current = selector.TagHistory(); current;
+       current = current->TagHistory()) {
+    switch (relation) {
+      case LynxCSSSelector::kSubSelector:
+        if (skip_over_sub_selectors) {
+          break;
+        }
+        [[fallthrough]];
+      case LynxCSSSelector::kDescendant:
+      case LynxCSSSelector::kChild:
+        skip_over_sub_selectors = false;
+        switch (current->Match()) {
+          case LynxCSSSelector::kId:
+            ancestor_hashes_.push_back(SelectorIdHash(current->Value()));
+            break;
+          case LynxCSSSelector::kClass:
+            ancestor_hashes_.push_back(SelectorClassHash(current->Value()));
+            break;
+          case LynxCSSSelector::kTag:
+            if (current->Value() != CSSGlobalStarString()) {
+              ancestor_hashes_.push_back(SelectorTagHash(current->Value()));
+            }
+            break;
+          default:
+            break;
+        }
+        break;
+      case LynxCSSSelector::kDirectAdjacent:
+      case LynxCSSSelector::kIndirectAdjacent:
+        skip_over_sub_selectors = true;
+        break;
+      default:
+        return;
+    }
+    if (ancestor_hashes_.size() == kMaxAncestorHashes) {
+      return;
+    }
+    relation = current->Relation();
+  }
+}
+
+uint32_t SelectorProgram::AddStringOperand(const std::string& str) {
+  for (uint32_t i = 0; i < strings_.size(); ++i) {
+    if (strings_[i] == str) {
+      return i;
+    }
+  }
+  strings_.push_back(str);
+  return static_cast<uint32_t>(strings_.size() - 1);
+}
+
+bool SelectorProgram::AddInstruction(uint8_t op, uint32_t operand) {
+  if (op >= kOpCodeCount) {
+    return false;
+  }
+  instructions_.push_back({static_cast<OpCode>(op), operand});
+  return true;
+}
+
+bool SelectorProgram::Verify() const {
+  if (ancestor_hashes_.size() > kMaxAncestorHashes) {
+    return false;
+  }
+  if (instructions_.empty()) {
+    return strings_.empty();
+  }
+  for (size_t i = 0; i < instructions_.size(); ++i) {
+    const Instruction& instruction = instructions_[i];
+    // Only the last one is kEnd, so that Run() always stops.
+    if ((instruction.op == kEnd) != (i == instructions_.size() - 1)) {
+      return false;
+    }
+    switch (instruction.op) {
+      case kMatchTag:
+      case kMatchClass:
+      case kMatchId:
+        if (instruction.operand >= strings_.size()) {
+          return false;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  return true;
+}
+
+bool SelectorProgram::Match(StyleNode* node) const {
+  DCHECK(IsValid());
+  return Run(0, node) == kMatches;
+}
+
+SelectorProgram::MatchResult SelectorProgram::Run(size_t pc,
+                                                  StyleNode* node) const {
+  DCHECK(node);
+  for (;; ++pc) {
+    const Instruction& instruction = instructions_[pc];
+    switch (instruction.op) {
+      case kEnd:
+        return kMatches;
+      case kMatchTag:
+        if (!node->ContainsTagSelector(strings_[instruction.operand])) {
+          return kFailsLocally;
+        }
+        break;
+      case kMatchClass:
+        if (!node->ContainsClassSelector(strings_[instruction.operand])) {
+          return kFailsLocally;
+        }
+        break;
+      case kMatchId:
+        if (!node->ContainsIdSelector(strings_[instruction.operand])) {
+          return kFailsLocally;
+        }
+        break;
+      case kMatchPseudoState:
+        if (!node->HasPseudoState(instruction.operand)) {
+          return kFailsLocally;
+        }
+        break;
+      case kMatchRoot:
+        if (node->tag().str() != "page") {
+          return kFailsLocally;
+        }
+        break;
+      case kDescendant: {
+        for (StyleNode* parent = node->SelectorMatchingParent(); parent;
+             parent = parent->SelectorMatchingParent()) {
+          MatchResult match = Run(pc + 1, parent);
+          if (match == kMatches || match == kFailsCompletely) {
+            return match;
+          }
+        }
+        return kFailsCompletely;
+      }
+      case kChild: {
+        StyleNode* parent = node->SelectorMatchingParent();
+        if (!parent) {
+          return kFailsCompletely;
+        }
+        return Run(pc + 1, parent);
+      }
+      case kDirectAdjacent: {
+        StyleNode* sibling = node->PreviousSibling();
+        if (!sibling) {
+          return kFailsAllSiblings;
+        }
+        return Run(pc + 1, sibling);
+      }
+      case kIndirectAdjacent: {
+        for (StyleNode* sibling = node->PreviousSibling(); sibling;
+             sibling = sibling->PreviousSibling()) {
+          MatchResult match = Run(pc + 1, sibling);
+          if (match == kMatches || match == kFailsAllSiblings ||
+              match == kFailsCompletely) {
+            return match;
+          }
+        }
+        return kFailsAllSiblings;
+      }
+      case kUAShadow: {
+        StyleNode* owner = node->PseudoElementOwner();
+        if (!owner) {
+          return kFailsCompletely;
+        }
+        return Run(pc + 1, owner);
+      }
+      default:
+        return kFailsCompletely;
+    }
+  }
+}
+
+}  // namespace css
+}  // namespace lynx
@@ -0,0 +1,121 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_RENDERER_CSS_NG_MATCHER_SELECTOR_PROGRAM_H_
+#define CORE_RENDERER_CSS_NG_MATCHER_SELECTOR_PROGRAM_H_
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/renderer/css/ng/matcher/selector_filter.h"
+#include "core/renderer/css/ng/selector/lynx_css_selector.h"
+#include "core/renderer/css/style_node.h"
+
+// The type of the section of the selector programs in a css fragment, see
+// CSS_BINARY_FONT_FACE_TYPE
+#define CSS_BINARY_SELECTOR_PROGRAM_TYPE 0x02
+
+namespace lynx {
+namespace css {
+
+// A complex selector compiled into a flat list of instructions, from right to
+// left, which is the order SelectorMatcher walks the LynxCSSSelector array.
+// The simple selectors are checked against the current node, the relations
+// move to another node, and kEnd means the selector matches. It is compiled
+// by the encoder and stored in the template binary, so that matching a rule
+// does not need to walk the selector structures.
+//
+// The ancestor hashes are the ids, classes and tags that the ancestors of a
+// matched node must have, which are checked with a SelectorFilter before
+// running the instructions.
+//
+// Selectors that can not be compiled, e.g. with :not() or attributes, have no
+// instructions and are matched by SelectorMatcher, but their ancestor hashes
+// are still used.
+class SelectorProgram {
+ public:
+  enum OpCode : uint8_t {
+    kEnd,
+    // Simple selectors, the operand is the index in the strings.
+    kMatchTag,
+    kMatchClass,
+    kMatchId,
+    // The operand is a tasm::PseudoState.
+    kMatchPseudoState,
+    kMatchRoot,
+    // Relations, see LynxCSSSelector::RelationType.
+    kDescendant,
+    kChild,
+    kDirectAdjacent,
+    kIndirectAdjacent,
+    kUAShadow,
+    kOpCodeCount,
+  };
+
+  struct Instruction {
+    OpCode op;
+    uint32_t operand;
+  };
+
+  static constexpr size_t kMaxAncestorHashes = 4;
+
+  SelectorProgram() = default;
+
+  static SelectorProgram Compile(const LynxCSSSelector& selector);
+
+  // Returns false if the selector is not compiled.
+  bool IsValid() const { return !instructions_.empty(); }
+
+  // Returns true if the ancestors of the node can not match the selector.
+  bool FastRejects(const SelectorFilter& filter) const {
+    for (uint32_t hash : ancestor_hashes_) {
+      if (!filter.MayContain(hash)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool Match(StyleNode* node) const;
+
+  const std::vector<Instruction>& instructions() const {
+    return instructions_;
+  }
+  const std::vector<std::string>& strings() const { return strings_; }
+  const std::vector<uint32_t>& ancestor_hashes() const {
+    return ancestor_hashes_;
+  }
+
+  // Used by the decoder. Returns false if the program is malformed.
+  bool AddInstruction(uint8_t op, uint32_t operand);
+  void AddString(std::string str) { strings_.emplace_back(std::move(str)); }
+  void AddAncestorHash(uint32_t hash) { ancestor_hashes_.push_back(hash); }
+  bool Verify() const;
+
+ private:
+  enum MatchResult {
+    kMatches,
+    kFailsLocally,
+    kFailsAllSiblings,
+    kFailsCompletely
+  };
+
+  MatchResult Run(size_t pc, StyleNode* node) const;
+
+  bool CompileInstructions(const LynxCSSSelector& selector);
+  bool CompileSimple(const LynxCSSSelector& selector);
+  void CollectAncestorHashes(const LynxCSSSelector& selector);
+  uint32_t AddStringOperand(const std::string& str);
+
+  std::vector<Instruction> instructions_;
+  std::vector<std::string> strings_;
+  std::vector<uint32_t> ancestor_hashes_;
+};
+
+}  // namespace css
+}  // namespace lynx
+
+#endif  // CORE_RENDERER_CSS_NG_MATCHER_SELECTOR_PROGRAM_H_
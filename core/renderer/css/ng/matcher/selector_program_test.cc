@@ -0,0 +1,207 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/css/ng/matcher/selector_program.h"
+
+#include <memory>
+#include <utility>
+
+#include "core/renderer/css/ng/matcher/selector_filter.h"
+#include "core/renderer/css/ng/matcher/selector_matcher.h"
+#include "core/renderer/css/ng/parser/css_parser_token_range.h"
+#include "core/renderer/css/ng/parser/css_tokenizer.h"
+#include "core/renderer/css/ng/selector/css_parser_context.h"
+#include "core/renderer/css/ng/selector/css_selector_parser.h"
+#include "core/renderer/css/ng/selector/lynx_css_selector_list.h"
+#include "core/renderer/tasm/testing/mock_attribute_holder.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace css {
+
+namespace {
+
+LynxCSSSelectorList ParseSelectorList(const char* text) {
+  CSSParserContext context;
+  CSSTokenizer tokenizer(text);
+  const auto tokens = tokenizer.TokenizeToEOF();
+  CSSParserTokenRange range(tokens);
+  LynxCSSSelectorVector vector =
+      CSSSelectorParser::ParseSelector(range, &context);
+  return CSSSelectorParser::AdoptSelectorVector(vector);
+}
+
+}  // namespace
+
+const char* program_test_data[] = {
+    "*",
+    "view",
+    "text",
+    ":root view",
+    ".foo",
+    ".bar",
+    "#main",
+    "#test",
+    ".foo#main:focus",
+    ":focus",
+    ":active:hover",
+    ":focus *",
+    ":focus > *",
+    "page > view",
+    "page view.foo",
+    ".outer view",
+    ".outer > view",
+    ".inner > .foo",
+    ".outer > .inner view",
+    ".outer .inner > view",
+    "#wrapper .foo",
+    "text + .foo",
+    "view + .foo",
+    "text ~ .foo",
+    "view ~ .foo",
+    ".inner text ~ .foo",
+    ".missing text ~ .foo",
+    "* > * > * > .foo",
+};
+
+class SelectorProgramTest : public testing::Test,
+                            public testing::WithParamInterface<const char*> {};
+
+INSTANTIATE_TEST_SUITE_P(SelectorProgram, SelectorProgramTest,
+                         testing::ValuesIn(program_test_data));
+
+TEST_P(SelectorProgramTest, SameAsSelectorMatcher) {
+  const char* text = GetParam();
+  SCOPED_TRACE(text);
+  auto list = ParseSelectorList(text);
+
+  auto root = std::make_unique<tasm::MockAttributeHolder>("page");
+  root->SetIdSelector("wrapper");
+  auto outer = std::make_unique<tasm::MockAttributeHolder>("view");
+  auto outer_ptr = outer.get();
+  outer->SetClass("outer");
+  root->AddChild(std::move(outer));
+  auto inner = std::make_unique<tasm::MockAttributeHolder>("view");
+  auto inner_ptr = inner.get();
+  inner->SetClass("inner");
+  outer_ptr->AddChild(std::move(inner));
+
+  inner_ptr->AddChild(std::make_unique<tasm::MockAttributeHolder>("text"));
+  auto target = std::make_unique<tasm::MockAttributeHolder>("view");
+  auto target_ptr = target.get();
+  target->SetIdSelector("main");
+  target->SetClass("foo");
+  target->SetPseudoState(tasm::kPseudoStateFocus);
+  inner_ptr->AddChild(std::move(target));
+
+  SelectorMatcher matcher;
+  SelectorMatcher::SelectorMatchingContext context(target_ptr);
+  context.selector = list.First();
+  bool expected = matcher.Match(context);
+
+  auto program = SelectorProgram::Compile(*list.First());
+  ASSERT_TRUE(program.IsValid());
+  EXPECT_TRUE(program.Verify());
+  EXPECT_EQ(expected, program.Match(target_ptr));
+
+  // The filter never rejects a matched selector.
+  SelectorFilter filter;
+  filter.PushAncestors(*target_ptr);
+  if (expected) {
+    EXPECT_FALSE(program.FastRejects(filter));
+  }
+}
+
+TEST(SelectorProgramTest, Unsupported) {
+  auto list = ParseSelectorList(":not(text), [flatten]");
+  for (auto* selector = list.First(); selector;
+       selector = LynxCSSSelectorList::Next(*selector)) {
+    SCOPED_TRACE(selector->ToString());
+    EXPECT_FALSE(SelectorProgram::Compile(*selector).IsValid());
+  }
+}
+
+TEST(SelectorProgramTest, AncestorHashes) {
+  {
+    auto list = ParseSelectorList(".a > #b view.c .d");
+    auto program = SelectorProgram::Compile(*list.First());
+    // The rightmost compound is not an ancestor.
+    EXPECT_EQ(program.ancestor_hashes().size(), 4u);
+  }
+  {
+    // The siblings are not ancestors.
+    auto list = ParseSelectorList(".a .b + .c");
+    auto program = SelectorProgram::Compile(*list.First());
+    ASSERT_EQ(program.ancestor_hashes().size(), 1u);
+    EXPECT_EQ(program.ancestor_hashes()[0], SelectorClassHash("a"));
+  }
+  {
+    auto list = ParseSelectorList("view .a::placeholder");
+    auto program = SelectorProgram::Compile(*list.First());
+    EXPECT_TRUE(program.IsValid());
+    EXPECT_TRUE(program.ancestor_hashes().empty());
+  }
+}
+
+TEST(SelectorProgramTest, FastRejects) {
+  auto list = ParseSelectorList(".outer .foo");
+  auto program = SelectorProgram::Compile(*list.First());
+
+  auto root = std::make_unique<tasm::MockAttributeHolder>("page");
+  auto parent = std::make_unique<tasm::MockAttributeHolder>("view");
+  auto parent_ptr = parent.get();
+  root->AddChild(std::move(parent));
+  auto target = std::make_unique<tasm::MockAttributeHolder>("view");
+  auto target_ptr = target.get();
+  target->SetClass("foo");
+  parent_ptr->AddChild(std::move(target));
+
+  SelectorFilter filter;
+  filter.PushAncestors(*target_ptr);
+  EXPECT_TRUE(program.FastRejects(filter));
+
+  parent_ptr->SetClass("outer");
+  filter.PushNode(*parent_ptr);
+  EXPECT_FALSE(program.FastRejects(filter));
+  EXPECT_TRUE(program.Match(target_ptr));
+
+  filter.PopNode(*parent_ptr);
+  EXPECT_TRUE(program.FastRejects(filter));
+}
+
+TEST(SelectorFilterTest, ParentStack) {
+  auto root = std::make_unique<tasm::MockAttributeHolder>("page");
+  auto root_ptr = root.get();
+  root->SetClass("outer");
+  auto parent = std::make_unique<tasm::MockAttributeHolder>("view");
+  auto parent_ptr = parent.get();
+  root->AddChild(std::move(parent));
+  auto target = std::make_unique<tasm::MockAttributeHolder>("view");
+  auto target_ptr = target.get();
+  parent_ptr->AddChild(std::move(target));
+
+  SelectorFilter filter;
+  filter.PushParent(*root_ptr);
+  EXPECT_TRUE(filter.ParentStackIsConsistent(root_ptr));
+  // The saved hashes are removed even if the classes have changed.
+  root_ptr->SetClass("inner");
+  filter.PopParent();
+  EXPECT_TRUE(filter.ParentStackIsEmpty());
+  EXPECT_FALSE(filter.MayContain(SelectorClassHash("outer")));
+
+  auto list = ParseSelectorList(".inner .foo");
+  auto program = SelectorProgram::Compile(*list.First());
+  {
+    SelectorFilterScope scope(parent_ptr);
+    // The ancestors of the first node of the traversal are pushed.
+    SelectorFilter* current = SelectorFilterScope::FilterForNode(*target_ptr);
+    ASSERT_NE(current, nullptr);
+    EXPECT_FALSE(program.FastRejects(*current));
+    EXPECT_EQ(SelectorFilterScope::FilterForNode(*parent_ptr), nullptr);
+  }
+  EXPECT_EQ(SelectorFilterScope::FilterForNode(*target_ptr), nullptr);
+}
+
+}  // namespace css
+}  // namespace lynx
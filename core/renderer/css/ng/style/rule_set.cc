@@ -20,13 +20,52 @@
 namespace lynx {
 namespace css {
 
-static void MatchKey(StyleNode* node, const CompactRuleDataVector& list,
-                     unsigned level, base::Vector<MatchedRule>& matched) {
+// The ancestor filter of the node being matched, built when the first rule
+// with ancestor hashes is matched if not given by the caller.
+class RuleSet::AncestorFilter {
+ public:
+  AncestorFilter(StyleNode* node, SelectorFilter* filter)
+      : node_(node), filter_(filter) {}
+
+  bool FastRejects(const SelectorProgram& program) {
+    if (program.ancestor_hashes().empty()) {
+      return false;
+    }
+    if (!filter_) {
+      local_filter_ = std::make_unique<SelectorFilter>();
+      local_filter_->PushAncestors(*node_);
+      filter_ = local_filter_.get();
+    }
+    bool rejected = program.FastRejects(*filter_);
+    filter_->RecordFastReject(rejected);
+    return rejected;
+  }
+
+ private:
+  StyleNode* node_;
+  SelectorFilter* filter_;
+  std::unique_ptr<SelectorFilter> local_filter_;
+};
+
+void RuleSet::MatchKey(StyleNode* node, const CompactRuleDataVector& list,
+                       unsigned level, AncestorFilter& filter,
+                       base::Vector<MatchedRule>& matched) const {
   for (const auto& rule : list) {
-    SelectorMatcher matcher;
-    SelectorMatcher::SelectorMatchingContext context(node);
-    context.selector = &rule.Selector();
-    auto ret = matcher.Match(context);
+    const SelectorProgram* program = rule.Position() < programs_.size()
+                                         ? &programs_[rule.Position()]
+                                         : nullptr;
+    if (program && filter.FastRejects(*program)) {
+      continue;
+    }
+    bool ret;
+    if (program && program->IsValid()) {
+      ret = program->Match(node);
+    } else {
+      SelectorMatcher matcher;
+      SelectorMatcher::SelectorMatchingContext context(node);
+      context.selector = &rule.Selector();
+      ret = matcher.Match(context);
+    }
     if (ret) {
       // Avoid copying the RuleData, only used in the local scope
       matched.emplace_back(&rule, level);
@@ -34,15 +73,16 @@ static void MatchKey(StyleNode* node, const CompactRuleDataVector& list,
   }
 }
 
-static void MatchKey(
+void RuleSet::MatchKey(
     StyleNode* node, const std::string& key,
     const std::unordered_map<std::string, CompactRuleDataVector>& map,
-    unsigned level, base::Vector<MatchedRule>& matched) {
+    unsigned level, AncestorFilter& filter,
+    base::Vector<MatchedRule>& matched) const {
   if (key.empty()) return;
 
   auto list = map.find(key);
   if (list != map.end()) {
-    MatchKey(node, list->second, level, matched);
+    MatchKey(node, list->second, level, filter, matched);
   }
 }
 
@@ -57,20 +97,36 @@ void RuleSet::AddToRuleSet(const std::string& text,
 }
 
 void RuleSet::MatchStyles(StyleNode* node, unsigned& level,
-                          base::Vector<MatchedRule>& output) const {
+                          base::Vector<MatchedRule>& output,
+                          SelectorFilter* filter) const {
+  AncestorFilter ancestor_filter(node, filter);
+  MatchStyles(node, level, output, ancestor_filter);
+}
+
+void RuleSet::MatchStyles(StyleNode* node, unsigned& level,
+                          base::Vector<MatchedRule>& output,
+                          AncestorFilter& filter) const {
   for (const auto& dep : deps_) {
-    dep.MatchStyles(node, level, output);
+    dep.MatchStyles(node, level, output, filter);
   }
   ++level;
-  MatchKey(node, universal_rules_, level, output);
+  MatchKey(node, universal_rules_, level, filter, output);
   if (node->GetPseudoState() != tasm::kPseudoStateNone) {
-    MatchKey(node, pseudo_rules_, level, output);
+    MatchKey(node, pseudo_rules_, level, filter, output);
   }
-  MatchKey(node, node->tag().str(), tag_rules_, level, output);
+  MatchKey(node, node->tag().str(), tag_rules_, level, filter, output);
   for (const auto& c : node->classes()) {
-    MatchKey(node, c.str(), class_rules_, level, output);
+    MatchKey(node, c.str(), class_rules_, level, filter, output);
   }
-  MatchKey(node, node->idSelector().str(), id_rules_, level, output);
+  MatchKey(node, node->idSelector().str(), id_rules_, level, filter, output);
+}
+
+void RuleSet::SetSelectorPrograms(std::vector<SelectorProgram> programs) {
+  if (programs.size() != rule_count_) {
+    programs_.clear();
+    return;
+  }
+  programs_ = std::move(programs);
 }
 
 void RuleSet::AddStyleRule(const std::shared_ptr<StyleRule>& rule) {
@@ -80,6 +136,10 @@ void RuleSet::AddStyleRule(const std::shared_ptr<StyleRule>& rule) {
        selector_index = rule->IndexOfNextSelectorAfter(selector_index)) {
     RuleData rule_data(rule, selector_index, rule_count_);
     ++rule_count_;
+    if (compile_selectors_) {
+      programs_.emplace_back(
+          SelectorProgram::Compile(rule->SelectorAt(selector_index)));
+    }
     AddToRuleSetInternal(rule->SelectorAt(selector_index), rule_data);
     if (!fragment_) continue;
     RuleInvalidationSet* set = fragment_->GetRuleInvalidationSet();
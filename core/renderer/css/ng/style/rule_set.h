@@ -11,6 +11,8 @@
 #include <vector>
 
 #include "base/include/vector.h"
+#include "core/renderer/css/ng/matcher/selector_filter.h"
+#include "core/renderer/css/ng/matcher/selector_program.h"
 #include "core/renderer/css/ng/style/rule_data.h"
 #include "core/renderer/css/style_node.h"
 
@@ -47,8 +49,11 @@ class RuleSet {
  public:
   explicit RuleSet(tasm::SharedCSSFragment* fragment) : fragment_(fragment) {}
 
+  // The filter has the ancestors of the node, it is built from the node if
+  // not given.
   void MatchStyles(StyleNode* node, unsigned& level,
-                   base::Vector<MatchedRule>& output) const;
+                   base::Vector<MatchedRule>& output,
+                   SelectorFilter* filter = nullptr) const;
 
   void AddToRuleSet(const std::string& text,
                     const std::shared_ptr<lynx::tasm::CSSParseToken>& token);
@@ -71,7 +76,35 @@ class RuleSet {
 
   const auto& universal_rules() { return universal_rules_; }
 
+  // The selectors are compiled when the rules are added, unless the programs
+  // are decoded from the template binary.
+  void SetCompileSelectors(bool compile) { compile_selectors_ = compile; }
+
+  // The compiled selectors, indexed by the position of the rules. They are
+  // dropped if they do not match the rules.
+  void SetSelectorPrograms(std::vector<SelectorProgram> programs);
+
+  const std::vector<SelectorProgram>& selector_programs() const {
+    return programs_;
+  }
+
  private:
+  class AncestorFilter;
+
+  void MatchStyles(StyleNode* node, unsigned& level,
+                   base::Vector<MatchedRule>& output,
+                   AncestorFilter& filter) const;
+
+  void MatchKey(StyleNode* node, const CompactRuleDataVector& list,
+                unsigned level, AncestorFilter& filter,
+                base::Vector<MatchedRule>& matched) const;
+
+  void MatchKey(
+      StyleNode* node, const std::string& key,
+      const std::unordered_map<std::string, CompactRuleDataVector>& map,
+      unsigned level, AncestorFilter& filter,
+      base::Vector<MatchedRule>& matched) const;
+
   bool AddToRuleSetInternal(const LynxCSSSelector& component,
                             const RuleData& rule);
 
@@ -87,6 +120,10 @@ class RuleSet {
   CompactRuleDataVector pseudo_rules_;
   CompactRuleDataVector universal_rules_;
 
+  // Empty if the selectors are not compiled.
+  std::vector<SelectorProgram> programs_;
+  bool compile_selectors_ = true;
+
   std::vector<RuleSet> deps_;
   tasm::SharedCSSFragment* fragment_ = nullptr;
   unsigned rule_count_ = 0;
@@ -8,6 +8,7 @@
 #include "core/renderer/css/ng/parser/css_tokenizer.h"
 #include "core/renderer/css/ng/selector/css_parser_context.h"
 #include "core/renderer/css/ng/selector/css_selector_parser.h"
+#include "core/renderer/tasm/testing/mock_attribute_holder.h"
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
 
 namespace lynx {
@@ -141,5 +142,81 @@ TEST(RuleSetTest, FindBestRuleSetAndAdd_PlaceholderPseudo) {
   ASSERT_EQ(2u, rules.size());
 }
 
+TEST(RuleSetTest, MatchStylesWithSelectorPrograms) {
+  TestFragment fragment;
+  // Match with SelectorMatcher first.
+  fragment.GetRuleSet().SetCompileSelectors(false);
+
+  fragment.AddCSSRules(".outer .foo, .missing .foo, .foo");
+  fragment.AddCSSRules("view:not(text)");
+  fragment.AddCSSRules(".outer > view");
+  RuleSet& rule_set = fragment.GetRuleSet();
+
+  auto parent = std::make_unique<tasm::MockAttributeHolder>("view");
+  parent->SetClass("outer");
+  auto child = std::make_unique<tasm::MockAttributeHolder>("view");
+  auto child_ptr = child.get();
+  child->SetClass("foo");
+  parent->AddChild(std::move(child));
+
+  unsigned level = 0;
+  base::Vector<MatchedRule> expected;
+  rule_set.MatchStyles(child_ptr, level, expected);
+  ASSERT_EQ(4u, expected.size());
+
+  std::vector<SelectorProgram> programs;
+  for (const auto& rule : {".outer .foo", ".missing .foo", ".foo",
+                           "view:not(text)", ".outer > view"}) {
+    CSSParserContext context;
+    CSSTokenizer tokenizer(rule);
+    const auto tokens = tokenizer.TokenizeToEOF();
+    CSSParserTokenRange range(tokens);
+    LynxCSSSelectorVector vector =
+        CSSSelectorParser::ParseSelector(range, &context);
+    auto list = CSSSelectorParser::AdoptSelectorVector(vector);
+    programs.emplace_back(SelectorProgram::Compile(*list.First()));
+  }
+  EXPECT_FALSE(programs[3].IsValid());
+  rule_set.SetSelectorPrograms(std::move(programs));
+  ASSERT_EQ(5u, rule_set.selector_programs().size());
+
+  level = 0;
+  base::Vector<MatchedRule> actual;
+  rule_set.MatchStyles(child_ptr, level, actual);
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(expected[i].Position(), actual[i].Position());
+  }
+
+  // The rules rejected by the ancestor filter are not matched.
+  SelectorFilter filter;
+  filter.PushParent(*child_ptr->HolderParent());
+  level = 0;
+  base::Vector<MatchedRule> filtered;
+  rule_set.MatchStyles(child_ptr, level, filtered, &filter);
+  ASSERT_EQ(expected.size(), filtered.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(expected[i].Position(), filtered[i].Position());
+  }
+  EXPECT_EQ(1u, filter.reject_count());
+
+  // Programs that do not match the rules are dropped.
+  rule_set.SetSelectorPrograms(std::vector<SelectorProgram>(2));
+  EXPECT_TRUE(rule_set.selector_programs().empty());
+}
+
+TEST(RuleSetTest, CompileSelectors) {
+  TestFragment fragment;
+  fragment.AddCSSRules(".outer .foo, .foo");
+  fragment.AddCSSRules(".outer :not(.foo)");
+  const auto& programs = fragment.GetRuleSet().selector_programs();
+  ASSERT_EQ(3u, programs.size());
+  EXPECT_TRUE(programs[0].IsValid());
+  EXPECT_TRUE(programs[1].IsValid());
+  // Not compiled, but still rejected by the ancestor filter.
+  EXPECT_FALSE(programs[2].IsValid());
+  EXPECT_EQ(1u, programs[2].ancestor_hashes().size());
+}
+
 }  // namespace css
 }  // namespace lynx
@@ -55,7 +55,8 @@ void UpdateData(JNIEnv* env, jclass jcaller, jlong nativePtr, jobject data,
                 baseValue->Table().get()->GetValue(outer_key);
             if (old_value.IsTable()) {
               if (old_value.Table()->IsConst()) {
-                old_value = lynx::lepus::Value::Clone(old_value);
+                // Only the first level is modified, share the others.
+                old_value = lynx::lepus::Value::ShallowCopy(old_value);
               }
               // merge Table.
               lynx::lepus::Dictionary* table = outer_value.Table().get();
@@ -12,9 +12,11 @@
 #include "base/trace/native/trace_event.h"
 #include "core/base/lynx_trace_categories.h"
 #include "core/renderer/css/css_sheet.h"
+#include "core/renderer/css/ng/matcher/selector_filter.h"
 #include "core/renderer/css/parser/css_string_parser.h"
 #include "core/renderer/dom/element.h"
 #include "core/renderer/dom/fiber/fiber_element.h"
+#include "core/renderer/dom/fiber/style_sharing_cache.h"
 #include "core/renderer/dom/vdom/radon/radon_element.h"
 #include "core/renderer/dom/vdom/radon/radon_node.h"
 #include "core/services/feature_count/global_feature_counter.h"
@@ -333,7 +335,9 @@ CSSPatching::MatchedVector<css::MatchedRule> CSSPatching::GetCSSMatchedRule(
   MatchedVector<css::MatchedRule> matched_rules;
   if (style_sheet && style_sheet->rule_set()) {
     unsigned level = 0;
-    style_sheet->rule_set()->MatchStyles(node, level, matched_rules);
+    style_sheet->rule_set()->MatchStyles(
+        node, level, matched_rules,
+        css::SelectorFilterScope::FilterForNode(*node));
   }
   base::InsertionSort(matched_rules.data(), matched_rules.size(), CompareRules);
   return matched_rules;
@@ -729,6 +733,35 @@ void CSSPatching::ResolvePlaceHolder() {
 
 void CSSPatching::GetCSSStyleForFiber(FiberElement* node,
                                       CSSFragment* style_sheet) {
+  auto* cache = StyleSharingScope::CacheForParent(node->parent());
+  if (!cache || !StyleSharingCache::CanShare(node)) {
+    MatchCSSStyleForFiber(node, style_sheet);
+    return;
+  }
+  auto& tls_matched_style_map = matched_style_map;
+  auto& tls_matched_variable_map = matched_variable_map;
+  if (const auto* candidate = cache->Find(node)) {
+    for (const auto* style : candidate->styles) {
+      tls_matched_style_map.emplace_back(style);
+    }
+    for (const auto* variables : candidate->variables) {
+      tls_matched_variable_map.emplace_back(variables);
+    }
+    return;
+  }
+  const size_t style_begin = tls_matched_style_map.size();
+  const size_t variable_begin = tls_matched_variable_map.size();
+  MatchCSSStyleForFiber(node, style_sheet);
+  auto& candidate = cache->Add(node);
+  candidate.styles.assign(tls_matched_style_map.begin() + style_begin,
+                          tls_matched_style_map.end());
+  candidate.variables.assign(
+      tls_matched_variable_map.begin() + variable_begin,
+      tls_matched_variable_map.end());
+}
+
+void CSSPatching::MatchCSSStyleForFiber(FiberElement* node,
+                                        CSSFragment* style_sheet) {
   style_sheet->InitPseudoNotStyle();
   // If has_pseudo_not_style means the pseudo_not_style is not empty
   const auto has_pseudo_not_style = style_sheet->HasPseudoNotStyle();
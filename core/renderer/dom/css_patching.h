@@ -53,8 +53,12 @@ class CSSPatching {
 
   void GetCSSStyleNew(AttributeHolder* node, CSSFragment* style_sheet);
 
+  // Shares the matched styles between the siblings if a StyleSharingScope
+  // is opened for the parent.
   void GetCSSStyleForFiber(FiberElement* node, CSSFragment* style_sheet);
 
+  void MatchCSSStyleForFiber(FiberElement* node, CSSFragment* style_sheet);
+
   void GetCSSStyleCompatible(Element* element, CSSFragment* style_sheet);
 
   void DidCollectMatchedRules(AttributeHolder* holder, StyleMap& result,
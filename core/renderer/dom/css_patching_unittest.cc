@@ -11,6 +11,7 @@
 #include "core/renderer/css/shared_css_fragment.h"
 #include "core/renderer/dom/element_manager.h"
 #include "core/renderer/dom/fiber/component_element.h"
+#include "core/renderer/dom/fiber/style_sharing_cache.h"
 #include "core/renderer/dom/fiber/view_element.h"
 #include "core/renderer/tasm/react/testing/mock_painting_context.h"
 #include "core/shell/tasm_operation_queue.h"
@@ -393,6 +394,63 @@ TEST_F(CSSPatchingTest, CSSSelectorDescendantSelectorScope) {
   EXPECT_EQ(new_value.GetPattern(), CSSValuePattern::PX);
   EXPECT_EQ(new_value.AsNumber(), 20);
 }
+
+TEST_F(CSSPatchingTest, GetCSSStyleForFiberStyleSharing) {
+  auto parent = manager->CreateFiberView();
+  parent->data_model()->SetClass("a");
+
+  std::vector<fml::RefPtr<FiberElement>> children;
+  for (const char* class_name : {"b", "b", "c", "b"}) {
+    auto child = manager->CreateFiberView();
+    child->data_model()->SetClass(class_name);
+    parent->InsertNode(child);
+    children.emplace_back(std::move(child));
+  }
+  children[3]->data_model()->SetIdSelector("#b-id");
+
+  CSSParserConfigs configs;
+  CSSParserTokenMap indexTokensMap;
+  for (const auto& [key, size] :
+       {std::make_pair(".b", "18px"), std::make_pair(".c", "19px")}) {
+    auto tokens = std::make_shared<CSSParseToken>(configs);
+    tokens->raw_attributes_[CSSPropertyID::kPropertyIDFontSize] =
+        CSSValue(lepus::Value(size));
+    tokens->sheets().emplace_back(std::make_shared<CSSSheet>(key));
+    indexTokensMap.insert(std::make_pair(key, tokens));
+  }
+  const std::vector<int32_t> dependent_ids;
+  CSSKeyframesTokenMap keyframes;
+  CSSFontFaceRuleMap fontfaces;
+  SharedCSSFragment indexFragment(1, dependent_ids, indexTokensMap, keyframes,
+                                  fontfaces);
+  {
+    auto tokens = std::make_shared<CSSParseToken>(configs);
+    tokens->raw_attributes_[CSSPropertyID::kPropertyIDFontSize] =
+        CSSValue(lepus::Value("20px"));
+    tokens->sheets().emplace_back(std::make_shared<CSSSheet>(".b.a"));
+    indexFragment.cascade_map_.emplace(".b.a", tokens);
+  }
+
+  StyleSharingScope scope(parent.get(), 2);
+  std::vector<double> font_sizes;
+  for (const auto& child : children) {
+    StyleMap result;
+    CSSVariableMap changed_css_vars;
+    child->css_patching_.ResolveStyle(result, &indexFragment,
+                                      &changed_css_vars);
+    font_sizes.push_back(
+        result.at(CSSPropertyID::kPropertyIDFontSize).AsNumber());
+  }
+  EXPECT_EQ(font_sizes, std::vector<double>({20, 20, 19, 20}));
+
+  // The second child shares the styles of the first one, and the last one
+  // with an id is not shared.
+  auto* cache = StyleSharingScope::CacheForParent(parent.get());
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(cache->hit_count(), 1u);
+  EXPECT_EQ(cache->miss_count(), 2u);
+  EXPECT_EQ(StyleSharingScope::CacheForParent(children[0].get()), nullptr);
+}
 }  // namespace testing
 }  // namespace tasm
 }  // namespace lynx
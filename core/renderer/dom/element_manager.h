@@ -15,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/include/dense_id_map.h"
 #include "core/base/threading/task_runner_manufactor.h"
 #include "core/base/utils/any.h"
 #include "core/inspector/observer/inspector_element_observer.h"
@@ -82,27 +83,26 @@ class NodeManager {
   ~NodeManager() = default;
   inline void Record(int id, Element *node) { node_map_[id] = node; }
 
-  inline void Erase(int id) { node_map_.erase(id); }
+  inline void Erase(int id) { node_map_.Erase(id); }
 
   inline Element *Get(int tag) {
-    auto it = node_map_.find(tag);
-    if (it != node_map_.end()) {
-      return it->second;
-    }
-    return nullptr;
+    auto node = node_map_.Find(tag);
+    return node != nullptr ? *node : nullptr;
   }
 
   void WillDestroy() {
-    for (const auto &pair : node_map_) {
-      if (pair.second) {
-        pair.second->set_will_destroy(true);
+    node_map_.ForEach([](int id, Element *node) {
+      if (node) {
+        node->set_will_destroy(true);
       }
-    }
-    node_map_.clear();
+    });
+    node_map_.Clear();
   }
 
  private:
-  std::unordered_map<int, Element *> node_map_;
+  // Element ids are generated densely by ElementManager, so a lookup is an
+  // index into the pages of DenseIdMap rather than a hash.
+  base::DenseIdMap<Element *> node_map_;
 };
 
 /*
@@ -153,7 +153,7 @@ class AirNodeManager {
     air_node_map_[id] = node;
   }
 
-  inline bool IsActive() const { return !(air_node_map_.empty()); }
+  inline bool IsActive() const { return !(air_node_map_.Empty()); }
 
   void RecordForLepusId(int id, uint64_t key, fml::RefPtr<AirLepusRef> node);
 
@@ -161,7 +161,7 @@ class AirNodeManager {
     air_customize_id_map_[id] = tag;
   }
 
-  inline void Erase(int id) { air_node_map_.erase(id); }
+  inline void Erase(int id) { air_node_map_.Erase(id); }
 
   inline void EraseCustomId(const std::string &id) {
     air_customize_id_map_.erase(id);
@@ -170,11 +170,8 @@ class AirNodeManager {
   void EraseLepusId(int id, AirElement *node);
 
   inline std::shared_ptr<AirElement> Get(int tag) const {
-    auto it = air_node_map_.find(tag);
-    if (it != air_node_map_.end()) {
-      return it->second;
-    }
-    return nullptr;
+    auto node = air_node_map_.Find(tag);
+    return node != nullptr ? *node : nullptr;
   }
 
   fml::RefPtr<AirLepusRef> GetForLepusId(int tag, uint64_t key);
@@ -191,7 +188,7 @@ class AirNodeManager {
   }
 
  private:
-  std::unordered_map<int, std::shared_ptr<AirElement>> air_node_map_;
+  base::DenseIdMap<std::shared_ptr<AirElement>> air_node_map_;
   std::unordered_map<int, std::map<uint64_t, fml::RefPtr<AirLepusRef>>>
       air_lepus_id_map_;
   std::unordered_map<std::string, int> air_customize_id_map_;
@@ -719,6 +716,10 @@ class ElementManager {
     return config_ ? config_->GetRemoveDescendantSelectorScope() : false;
   }
 
+  uint32_t GetStyleSharingCandidateCount() const {
+    return config_ ? config_->GetStyleSharingCandidateCount() : 0;
+  }
+
   bool GetEnableFixedNew() const {
     return config_ && config_->GetEnableFixedNew();
   }
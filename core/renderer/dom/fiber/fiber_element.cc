@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <stack>
 #include <string>
 #include <utility>
@@ -21,6 +22,7 @@
 #include "core/renderer/css/css_keyframes_token.h"
 #include "core/renderer/css/css_property.h"
 #include "core/renderer/css/css_utils.h"
+#include "core/renderer/css/ng/matcher/selector_filter.h"
 #include "core/renderer/css/parser/length_handler.h"
 #include "core/renderer/css/unit_handler.h"
 #include "core/renderer/dom/element_manager.h"
@@ -30,6 +32,7 @@
 #include "core/renderer/dom/fiber/none_element.h"
 #include "core/renderer/dom/fiber/raw_text_element.h"
 #include "core/renderer/dom/fiber/scroll_element.h"
+#include "core/renderer/dom/fiber/style_sharing_cache.h"
 #include "core/renderer/dom/fiber/text_element.h"
 #include "core/renderer/dom/fiber/tree_resolver.h"
 #include "core/renderer/dom/fiber/view_element.h"
@@ -1470,6 +1473,16 @@ void FiberElement::FlushActions() {
     UpdateInheritedProperty();
   }
 
+  // The styles of the descendants are resolved with the ancestor filter of
+  // the traversal.
+  std::optional<css::SelectorFilterScope> selector_filter_scope;
+  if (element_manager()->GetEnableStandardCSSSelector()) {
+    selector_filter_scope.emplace(data_model());
+  }
+  // The children with the same tag and classes share the matched styles.
+  StyleSharingScope style_sharing_scope(
+      this, element_manager()->GetStyleSharingCandidateCount());
+
   // Step II: process insert or remove related actions
   PrepareAndGenerateChildrenActions();
 
@@ -663,6 +663,7 @@ class FiberElement : public Element, public SelectorItem {
       const std::shared_ptr<CSSStyleSheetManager>& manager);
 
   virtual void SetCSSID(int32_t id);
+  int32_t css_id() const { return css_id_; }
 
   bool IsInSameCSSScope(FiberElement* element) {
     return css_id_ == element->css_id_;
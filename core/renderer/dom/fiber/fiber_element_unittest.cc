@@ -1801,8 +1801,8 @@ TEST_P(FiberElementTest, TestSetAndRemoveClass) {
 
   auto style_sheet_manager = page->css_style_sheet_manager_;
 
-  style_sheet_manager->raw_fragments_->insert(
-      std::make_pair(css_id, std::move(indexFragment)));
+  style_sheet_manager->raw_fragments_->Emplace(css_id,
+                                               std::move(indexFragment));
 
   auto child = manager->CreateFiberNode("view");
   child->SetParentComponentUniqueIdForFiber(
@@ -6565,8 +6565,8 @@ TEST_P(FiberElementTest, DumpStyleClass) {
 
   auto style_sheet_manager = page->css_style_sheet_manager_;
 
-  style_sheet_manager->raw_fragments_->insert(
-      std::make_pair(css_id, std::move(indexFragment)));
+  style_sheet_manager->raw_fragments_->Emplace(css_id,
+                                               std::move(indexFragment));
 
   auto child = manager->CreateFiberNode("view");
   child->SetParentComponentUniqueIdForFiber(
@@ -7088,6 +7088,86 @@ TEST_P(FiberElementTest, FromTemplateInfoTest) {
   EXPECT_EQ(ref_0_0_0 && ref_0_0_0->IsRefCounted(), true);
 }
 
+TEST_P(FiberElementTest, FromTemplatePrototypeTest) {
+  ElementTemplateInfo template_info;
+  template_info.exist_ = true;
+  template_info.key_ = "key";
+
+  auto info_0 = ElementInfo();
+  info_0.tag_enum_ = ElementBuiltInTagEnum::ELEMENT_VIEW;
+  info_0.class_selector_.emplace_back("root");
+  info_0.builtin_attrs_[ElementBuiltInAttributeEnum::DIRTY_ID] =
+      lepus::Value("0");
+
+  auto info_0_0 = ElementInfo();
+  info_0_0.tag_enum_ = ElementBuiltInTagEnum::ELEMENT_VIEW;
+  info_0_0.id_selector_ = "#0_0";
+  info_0_0.attrs_[base::String("attr")] = lepus::Value("value");
+  info_0_0.builtin_attrs_[ElementBuiltInAttributeEnum::DIRTY_ID] =
+      lepus::Value("0_0");
+
+  auto info_0_0_0 = ElementInfo();
+  info_0_0_0.tag_enum_ = ElementBuiltInTagEnum::ELEMENT_TEXT;
+  info_0_0_0.builtin_attrs_[ElementBuiltInAttributeEnum::DIRTY_ID] =
+      lepus::Value("0_0_0");
+
+  auto info_0_1 = ElementInfo();
+  info_0_1.tag_enum_ = ElementBuiltInTagEnum::ELEMENT_IMAGE;
+  info_0_1.class_selector_.emplace_back("a");
+  info_0_1.class_selector_.emplace_back("b");
+
+  auto info_1 = ElementInfo();
+  info_1.tag_enum_ = ElementBuiltInTagEnum::ELEMENT_VIEW;
+
+  info_0_0.children_.emplace_back(std::move(info_0_0_0));
+  info_0.children_.emplace_back(std::move(info_0_0));
+  info_0.children_.emplace_back(std::move(info_0_1));
+  template_info.elements_.emplace_back(std::move(info_0));
+  template_info.elements_.emplace_back(std::move(info_1));
+
+  auto prototype =
+      std::make_shared<ElementTemplatePrototype>(template_info.elements_);
+  const auto& nodes = prototype->nodes();
+  ASSERT_EQ(nodes.size(), 5);
+  EXPECT_EQ(nodes[0].subtree_size, 4);
+  EXPECT_EQ(nodes[1].subtree_size, 2);
+  EXPECT_EQ(nodes[3].subtree_size, 1);
+  EXPECT_EQ(nodes[4].subtree_size, 1);
+  EXPECT_EQ(nodes[3].classes.end - nodes[3].classes.begin, 2);
+  EXPECT_EQ(prototype->classes().size(), 3);
+  template_info.prototype_ = prototype;
+
+  // Instantiated for each use.
+  for (int i = 0; i < 2; ++i) {
+    auto res = TreeResolver::InitElementTree(
+        TreeResolver::FromTemplateInfo(template_info), 0, manager,
+        tasm->style_sheet_manager(DEFAULT_ENTRY_NAME));
+    ASSERT_EQ(res.GetLength(), 2);
+
+    auto root_element =
+        fml::static_ref_ptr_cast<FiberElement>(res.GetProperty(0).RefCounted());
+    EXPECT_TRUE(root_element->IsTemplateElement());
+    EXPECT_TRUE(root_element->IsPartElement());
+    ASSERT_EQ(root_element->children().size(), 2);
+    auto& element_0_0 = root_element->children()[0];
+    EXPECT_EQ(element_0_0->GetIdSelector().str(), "#0_0");
+    ASSERT_EQ(element_0_0->children().size(), 1);
+    EXPECT_EQ(element_0_0->children()[0]->GetTag().str(), "text");
+    EXPECT_EQ(root_element->children()[1]->classes().size(), 2);
+
+    auto map = TreeResolver::GetTemplateParts(root_element);
+    auto ref_0_0 = map->GetProperty("0_0");
+    EXPECT_EQ(ref_0_0 && ref_0_0->IsRefCounted(), true);
+    auto ref_0_0_0 = map->GetProperty("0_0_0");
+    EXPECT_EQ(ref_0_0_0 && ref_0_0_0->IsRefCounted(), true);
+
+    auto second_root =
+        fml::static_ref_ptr_cast<FiberElement>(res.GetProperty(1).RefCounted());
+    EXPECT_TRUE(second_root->IsTemplateElement());
+    EXPECT_TRUE(second_root->children().empty());
+  }
+}
+
 // CSSVariable Demo Structure
 TEST_P(FiberElementTest, CSSVariableOrderTest) {
   // construct css fragment.
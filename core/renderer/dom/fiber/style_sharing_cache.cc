@@ -0,0 +1,126 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/dom/fiber/style_sharing_cache.h"
+
+#include <deque>
+
+#include "base/include/log/logging.h"
+#include "base/trace/native/trace_event.h"
+#include "core/base/lynx_trace_categories.h"
+#include "core/renderer/dom/fiber/fiber_element.h"
+
+namespace lynx {
+namespace tasm {
+
+// static
+bool StyleSharingCache::CanShare(FiberElement* element) {
+  const auto* holder = element->data_model();
+  return !element->is_component() && holder->idSelector().empty() &&
+         holder->GetPseudoState() == kPseudoStateNone;
+}
+
+const StyleSharingCache::Candidate* StyleSharingCache::Find(
+    FiberElement* element) {
+  DCHECK(element->parent() == parent_);
+  const auto* holder = element->data_model();
+  for (size_t i = 0; i < size_; ++i) {
+    const Candidate& candidate = candidates_[i];
+    if (candidate.css_id == element->css_id() &&
+        candidate.tag == holder->tag() &&
+        candidate.classes == holder->classes()) {
+      ++hit_count_;
+      return &candidate;
+    }
+  }
+  ++miss_count_;
+  return nullptr;
+}
+
+StyleSharingCache::Candidate& StyleSharingCache::Add(FiberElement* element) {
+  DCHECK(capacity_ > 0);
+  if (candidates_.size() < capacity_) {
+    candidates_.resize(capacity_);
+  }
+  Candidate& candidate = candidates_[next_];
+  next_ = (next_ + 1) % capacity_;
+  if (size_ < capacity_) {
+    ++size_;
+  }
+  const auto* holder = element->data_model();
+  candidate.tag = holder->tag();
+  candidate.classes = holder->classes();
+  candidate.css_id = element->css_id();
+  candidate.styles.clear();
+  candidate.variables.clear();
+  return candidate;
+}
+
+void StyleSharingCache::Reset(const Element* parent, size_t capacity) {
+  parent_ = parent;
+  capacity_ = capacity;
+  Clear();
+}
+
+namespace {
+
+struct StyleSharingState {
+  // A deque keeps the caches of the outer scopes in place when a scope is
+  // opened for a descendant.
+  std::deque<StyleSharingCache> caches;
+  size_t depth = 0;
+  uint32_t hit_count = 0;
+  uint32_t miss_count = 0;
+};
+
+StyleSharingState& CurrentThreadState() {
+  static thread_local StyleSharingState state;
+  return state;
+}
+
+}  // namespace
+
+StyleSharingScope::StyleSharingScope(const Element* parent,
+                                     size_t candidate_count) {
+  if (!parent || candidate_count == 0) {
+    return;
+  }
+  StyleSharingState& state = CurrentThreadState();
+  if (state.depth == state.caches.size()) {
+    state.caches.emplace_back();
+  }
+  state.caches[state.depth++].Reset(parent, candidate_count);
+  pushed_ = true;
+}
+
+StyleSharingScope::~StyleSharingScope() {
+  if (!pushed_) {
+    return;
+  }
+  StyleSharingState& state = CurrentThreadState();
+  StyleSharingCache& cache = state.caches[--state.depth];
+  state.hit_count += cache.hit_count_;
+  state.miss_count += cache.miss_count_;
+  cache.hit_count_ = 0;
+  cache.miss_count_ = 0;
+  if (state.depth == 0 && (state.hit_count != 0 || state.miss_count != 0)) {
+    TRACE_EVENT_INSTANT(LYNX_TRACE_CATEGORY, "StyleSharing", "hits",
+                        state.hit_count, "misses", state.miss_count);
+    state.hit_count = 0;
+    state.miss_count = 0;
+  }
+}
+
+// static
+StyleSharingCache* StyleSharingScope::CacheForParent(const Element* parent) {
+  StyleSharingState& state = CurrentThreadState();
+  if (!parent || state.depth == 0) {
+    return nullptr;
+  }
+  StyleSharingCache& cache = state.caches[state.depth - 1];
+  return cache.parent() == parent ? &cache : nullptr;
+}
+
+}  // namespace tasm
+}  // namespace lynx
@@ -0,0 +1,100 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_RENDERER_DOM_FIBER_STYLE_SHARING_CACHE_H_
+#define CORE_RENDERER_DOM_FIBER_STYLE_SHARING_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "base/include/value/base_string.h"
+#include "core/renderer/css/css_property.h"
+#include "core/renderer/utils/base/base_def.h"
+
+namespace lynx {
+namespace tasm {
+
+class Element;
+class FiberElement;
+
+// The styles matched for the recently resolved children of an element.
+// Siblings with the same tag, classes and css scope match the same rules of
+// the fiber css, so the styles matched for one of them are reused by the
+// others instead of looking up the css again. Only the matched styles are
+// shared, the inline styles and css variables are still resolved by each
+// element.
+class StyleSharingCache {
+ public:
+  struct Candidate {
+    base::String tag;
+    ClassList classes;
+    int32_t css_id;
+    std::vector<const StyleMap*> styles;
+    std::vector<const CSSVariableMap*> variables;
+  };
+
+  // Elements with an id or a pseudo state are not shared, nor are the
+  // components which are resolved with their own css.
+  static bool CanShare(FiberElement* element);
+
+  // Returns the candidate with the same tag, classes and css scope as the
+  // element, otherwise nullptr.
+  const Candidate* Find(FiberElement* element);
+
+  // Returns the candidate to be filled with the styles matched for the
+  // element, which replaces the oldest one if the cache is full.
+  Candidate& Add(FiberElement* element);
+
+  void Clear() {
+    size_ = 0;
+    next_ = 0;
+  }
+
+  const Element* parent() const { return parent_; }
+  uint32_t hit_count() const { return hit_count_; }
+  uint32_t miss_count() const { return miss_count_; }
+
+ private:
+  friend class StyleSharingScope;
+
+  // Reuses the storage of the candidates for the children of another parent.
+  void Reset(const Element* parent, size_t capacity);
+
+  const Element* parent_ = nullptr;
+  std::vector<Candidate> candidates_;
+  size_t capacity_ = 0;
+  size_t size_ = 0;
+  // The index of the candidate to be replaced next.
+  size_t next_ = 0;
+  uint32_t hit_count_ = 0;
+  uint32_t miss_count_ = 0;
+};
+
+// Maintains the style sharing cache for the children of an element on the
+// current thread. The cache is only valid within the scope, while the
+// children of the element are resolved by one flush, so that the changes of
+// the classes, the ids and the css of the ancestors made before the next
+// flush never reach it. The outermost scope of a traversal reports the
+// statistics of the caches to the trace when it ends.
+class StyleSharingScope {
+ public:
+  StyleSharingScope(const Element* parent, size_t candidate_count);
+  ~StyleSharingScope();
+
+  StyleSharingScope(const StyleSharingScope&) = delete;
+  StyleSharingScope& operator=(const StyleSharingScope&) = delete;
+
+  // Returns the cache of the innermost scope if it is opened for the parent,
+  // otherwise nullptr.
+  static StyleSharingCache* CacheForParent(const Element* parent);
+
+ private:
+  bool pushed_ = false;
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_RENDERER_DOM_FIBER_STYLE_SHARING_CACHE_H_
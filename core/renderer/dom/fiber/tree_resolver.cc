@@ -284,6 +284,9 @@ fml::RefPtr<FiberElement> TreeResolver::CloneElements(
 base::Vector<fml::RefPtr<FiberElement>> TreeResolver::FromTemplateInfo(
     const ElementTemplateInfo& info) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, "TreeResolver::FromTemplateInfo");
+  if (info.prototype_) {
+    return FromTemplatePrototype(*info.prototype_);
+  }
   base::Vector<fml::RefPtr<FiberElement>> res;
   for (const auto& element_info : info.elements_) {
     auto element_node = FromElementInfo(-1, element_info);
@@ -293,6 +296,113 @@ base::Vector<fml::RefPtr<FiberElement>> TreeResolver::FromTemplateInfo(
   return res;
 }
 
+base::Vector<fml::RefPtr<FiberElement>> TreeResolver::FromTemplatePrototype(
+    const ElementTemplatePrototype& prototype) {
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, "TreeResolver::FromTemplatePrototype");
+  const auto& nodes = prototype.nodes();
+  base::Vector<fml::RefPtr<FiberElement>> res;
+
+  // The elements in creation order, and the parent component id of their
+  // children, which are indexed the same as the nodes.
+  std::vector<fml::RefPtr<FiberElement>> elements;
+  elements.reserve(nodes.size());
+  std::vector<int64_t> component_ids;
+  component_ids.reserve(nodes.size());
+  // The indexes of the ancestors of the current node.
+  std::vector<uint32_t> ancestors;
+
+  // Consumed after the children are inserted, then the element is inserted
+  // into its parent, the same as FromElementInfo.
+  auto finish_element = [&prototype, &nodes, &elements, &ancestors, &res]() {
+    const uint32_t index = ancestors.back();
+    ancestors.pop_back();
+    const auto& node = nodes[index];
+    auto& element = elements[index];
+    if (node.css_id != kInvalidCssId) {
+      element->SetCSSID(node.css_id);
+    }
+    for (uint32_t i = node.builtin_attrs.begin; i < node.builtin_attrs.end;
+         ++i) {
+      const auto& [key, value] = prototype.builtin_attrs()[i];
+      element->SetBuiltinAttribute(key, value);
+    }
+    if (node.config.IsTable()) {
+      element->SetConfig(lepus::Value::ShallowCopy(node.config));
+    }
+    if (ancestors.empty()) {
+      element->MarkTemplateElement();
+      res.emplace_back(element);
+    } else {
+      elements[ancestors.back()]->InsertNode(element);
+    }
+  };
+
+  for (uint32_t index = 0; index < nodes.size(); ++index) {
+    while (!ancestors.empty() &&
+           index >= ancestors.back() + nodes[ancestors.back()].subtree_size) {
+      finish_element();
+    }
+    const auto& node = nodes[index];
+    int64_t parent_component_id =
+        ancestors.empty() ? -1 : component_ids[ancestors.back()];
+
+    auto element =
+        ElementManager::StaticCreateFiberElement(node.tag_enum, node.tag);
+    if (element->is_component()) {
+      auto* component = static_cast<ComponentElement*>(element.get());
+      component->set_component_id(node.component_id);
+      component->set_component_name(node.component_name);
+      component->set_component_path(node.component_path);
+      component->SetCSSID(node.css_id);
+    }
+    if (element->is_page()) {
+      auto* page = static_cast<PageElement*>(element.get());
+      page->set_component_id(node.component_id);
+      page->SetCSSID(node.css_id);
+    }
+    if (node.tag_enum != ELEMENT_PAGE && parent_component_id > 0) {
+      element->SetParentComponentUniqueIdForFiber(parent_component_id);
+    }
+
+    if (!node.id_selector.empty()) {
+      element->SetIdSelector(node.id_selector);
+    }
+    for (uint32_t i = node.classes.begin; i < node.classes.end; ++i) {
+      element->SetClass(prototype.classes()[i]);
+    }
+    for (uint32_t i = node.inline_styles.begin; i < node.inline_styles.end;
+         ++i) {
+      const auto& [id, style] = prototype.inline_styles()[i];
+      element->SetStyle(id, style);
+    }
+    for (uint32_t i = node.events.begin; i < node.events.end; ++i) {
+      const auto& event = prototype.events()[i];
+      element->SetJSEventHandler(event.name_, event.type_, event.value_);
+    }
+    if (node.parsed_styles) {
+      element->SetParsedStyles(*node.parsed_styles, node.config);
+    }
+    for (uint32_t i = node.attrs.begin; i < node.attrs.end; ++i) {
+      const auto& [key, value] = prototype.attrs()[i];
+      element->SetAttribute(key, value);
+    }
+    if (!node.data_set.IsEmpty()) {
+      element->SetDataset(node.data_set);
+    }
+
+    if (node.tag_enum == ELEMENT_COMPONENT || node.tag_enum == ELEMENT_PAGE) {
+      parent_component_id = element->impl_id();
+    }
+    component_ids.emplace_back(parent_component_id);
+    elements.emplace_back(std::move(element));
+    ancestors.emplace_back(index);
+  }
+  while (!ancestors.empty()) {
+    finish_element();
+  }
+  return res;
+}
+
 lepus::Value TreeResolver::InitElementTree(
     base::Vector<fml::RefPtr<FiberElement>>&& elements, int64_t pid,
     ElementManager* manager,
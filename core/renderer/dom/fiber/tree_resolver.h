@@ -70,6 +70,11 @@ class TreeResolver {
   static base::Vector<fml::RefPtr<FiberElement>> FromTemplateInfo(
       const ElementTemplateInfo& info);
 
+  // Construct element tree according to the flat prototype of the
+  // element-template in a single pass.
+  static base::Vector<fml::RefPtr<FiberElement>> FromTemplatePrototype(
+      const ElementTemplatePrototype& prototype);
+
   static lepus::Value InitElementTree(
       base::Vector<fml::RefPtr<FiberElement>>&& elements, int64_t pid,
       ElementManager* manager,
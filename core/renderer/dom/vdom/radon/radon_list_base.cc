@@ -345,13 +345,22 @@ bool RadonListBase::DiffListComponents() {
               });
   FilterComponents(new_components_, tasm_);
   bool is_updating_config = page_proxy_->is_updating_config();
-  platform_info_.update_actions_ = myers_diff::MyersDiff(
-      false, components_.begin(), components_.end(), new_components_.begin(),
-      new_components_.end(),
-      [](const auto& lhs, const auto& rhs) { return lhs->CanBeReusedBy(*rhs); },
-      [is_updating_config](const auto& lhs, const auto& rhs) {
-        return !is_updating_config && (*lhs == *rhs);
-      });
+  auto same_cmp = [is_updating_config](const auto& lhs, const auto& rhs) {
+    return !is_updating_config && (*lhs == *rhs);
+  };
+  if (!myers_diff::KeyedDiff(
+          false, components_.begin(), components_.end(),
+          new_components_.begin(), new_components_.end(),
+          [](const auto& info) { return info->diff_key_.String(); }, same_cmp,
+          platform_info_.update_actions_)) {
+    platform_info_.update_actions_ = myers_diff::MyersDiff(
+        false, components_.begin(), components_.end(), new_components_.begin(),
+        new_components_.end(),
+        [](const auto& lhs, const auto& rhs) {
+          return lhs->CanBeReusedBy(*rhs);
+        },
+        same_cmp);
+  }
 
   auto need_flush = !platform_info_.update_actions_.Empty();
 
@@ -249,6 +249,27 @@ class PageConfig final : public EntryConfig {
     return layout_configs_.enable_fixed_new_;
   }
 
+  inline void SetEnableParallelLayout(bool enable) {
+    enable_parallel_layout_ = enable;
+  }
+  inline bool GetEnableParallelLayout() const {
+    return enable_parallel_layout_;
+  }
+
+  inline void SetEnableCSSFragmentPrefetch(bool enable) {
+    enable_css_fragment_prefetch_ = enable;
+  }
+  inline bool GetEnableCSSFragmentPrefetch() const {
+    return enable_css_fragment_prefetch_;
+  }
+
+  inline void SetStyleSharingCandidateCount(uint32_t count) {
+    style_sharing_candidate_count_ = count;
+  }
+  inline uint32_t GetStyleSharingCandidateCount() const {
+    return style_sharing_candidate_count_;
+  }
+
   inline PackageInstanceDSL GetDSL() { return dsl_; }
 
   inline void SetBundleModuleMode(
@@ -1234,6 +1255,14 @@ class PageConfig final : public EntryConfig {
   bool auto_resume_animation_{true};
   bool enable_reduce_init_data_copy_{false};
   bool enable_component_layout_only_{false};
+  // Lay out fixed-size subtrees on the concurrent loop.
+  bool enable_parallel_layout_{false};
+  // Decode the css of a component on the css decoding thread when its lepus
+  // chunk is loaded.
+  bool enable_css_fragment_prefetch_{false};
+  // The number of siblings whose matched styles are kept for the following
+  // siblings to share, 0 to disable the style sharing.
+  uint32_t style_sharing_candidate_count_{0};
   bool enable_cascade_pseudo_{false};
   // Used for lynx config
   bool enable_css_parser_{false};
@@ -35,44 +35,49 @@ Computation::Computation(SignalContext* signal_context_ptr,
   scope->AdoptComputation(fml::RefPtr<Computation>(this));
 
   signal_context()->UpdateComputation(this);
-
-  SetState(ScopeState::kStateNone);
 }
 
-Computation::~Computation() {}
+Computation::~Computation() { RemoveSources(); }
 
 void Computation::CleanUp() {
-  for (auto signal : signal_list_) {
-    signal->CleanComputation(this);
-  }
-  signal_list_.clear();
+  RemoveSources();
+  // The height is computed again from the signals read by the next run.
+  height_ = 0;
 
   BaseScope::CleanUp();
 
   SetState(ScopeState::kStateNone);
 }
 
-void Computation::MarkDownStream() {
-  if (memo_ == nullptr) {
-    return;
+void Computation::RemoveSources() {
+  for (const auto& source : sources_) {
+    if (source.signal != nullptr) {
+      source.signal->RemoveObserver(source.observer_slot);
+    }
   }
-  memo_->MarkDownStream();
+  sources_.clear();
 }
 
-void Computation::LookUpstream(Computation* ignore) {
-  SetState(ScopeState::kStateNone);
-
-  if (signal_list_.empty()) {
+void Computation::PushSignal(Signal* signal) {
+  // A signal is usually read several times in a row by the same closure.
+  if (!sources_.empty() && sources_.back().signal == signal) {
     return;
   }
-
-  for (auto source : signal_list_) {
-    source->LookUpstream(ignore);
+  const auto source_slot = static_cast<uint32_t>(sources_.size());
+  sources_.push_back({signal, signal->AddObserver(this, source_slot)});
+  if (height_ <= signal->height()) {
+    height_ = signal->height() + 1;
   }
 }
 
-void Computation::PushSignal(Signal* signal) {
-  signal_list_.emplace_back(signal);
+void Computation::UpdateSourcesIfNecessary() {
+  // Updating a memo may run other computations, which never change the
+  // sources of this one since it is not running.
+  for (size_t i = 0; i < sources_.size(); ++i) {
+    if (sources_[i].signal != nullptr) {
+      sources_[i].signal->UpdateIfNecessary();
+    }
+  }
 }
 
 void Computation::Invoke(int32_t time) {
@@ -82,13 +87,12 @@ void Computation::Invoke(int32_t time) {
   }
 
   value_ = vm_context()->CallClosure(closure_, value_);
+  SetUpdatedTime(time);
 
-  if (GetUpdatedTime() <= time &&
-      GetScopeType() == ScopeType::kMemoComputation) {
-    if (memo_ != nullptr) {
-      memo_->OnInvoked(value_);
-    }
-    SetUpdatedTime(time);
+  // The memo compares the new value with the old one, and only notifies the
+  // computations reading it if it has changed.
+  if (memo_ != nullptr) {
+    memo_->OnInvoked(value_);
   }
 }
 
@@ -5,8 +5,9 @@
 #ifndef CORE_RENDERER_SIGNAL_COMPUTATION_H_
 #define CORE_RENDERER_SIGNAL_COMPUTATION_H_
 
-#include <list>
+#include <cstdint>
 
+#include "base/include/vector.h"
 #include "core/renderer/signal/scope.h"
 #include "core/runtime/vm/lepus/lepus_value.h"
 #include "core/runtime/vm/lepus/ref_counted_class.h"
@@ -37,23 +38,43 @@ class Computation : public BaseScope {
 
   void CleanUp() override;
 
-  void MarkDownStream();
-
-  void LookUpstream(Computation* ignore);
-
   void PushSignal(Signal* signal);
 
   void Invoke(int32_t time);
 
   const lepus::Value& GetValue() { return value_; }
 
+  Memo* memo() const { return memo_; }
+
+  // One more than the highest signal read by the computation, so that all
+  // the signals it reads are updated before it runs.
+  uint32_t height() const { return height_; }
+
+  // Brings the signals read by the computation up to date, see
+  // SignalContext::UpdateIfNecessary.
+  void UpdateSourcesIfNecessary();
+
  private:
+  friend class Signal;
+
+  // An edge to a signal read by the computation. The slot is the index of the
+  // edge in the observers of the signal. The signal is nullptr if it has been
+  // destroyed.
+  struct Source {
+    Signal* signal;
+    uint32_t observer_slot;
+  };
+
+  void RemoveSources();
+
   lepus::Value closure_;
   lepus::Value value_;
 
   Memo* memo_;
 
-  std::list<Signal*> signal_list_;
+  uint32_t height_{0};
+
+  base::Vector<Source> sources_;
 };
 
 }  // namespace tasm
@@ -4,6 +4,7 @@
 
 #include "core/renderer/signal/lynx_signal.h"
 
+#include "base/include/log/logging.h"
 #include "core/renderer/signal/computation.h"
 #include "core/renderer/signal/signal_context.h"
 
@@ -11,16 +12,20 @@ namespace lynx {
 namespace tasm {
 
 Signal::Signal(SignalContext* context, const lepus::Value& init_value)
-    : signal_context_(context), value_(init_value), computation_list_() {}
+    : signal_context_(context), value_(init_value) {}
 
-Signal::~Signal() {}
+Signal::~Signal() {
+  for (const auto& observer : observers_) {
+    observer.computation->sources_[observer.source_slot].signal = nullptr;
+  }
+}
 
 void Signal::SetValue(const lepus::Value& value) {
   if (value_.IsEqual(value)) {
     return;
   }
   value_ = value;
-  if (computation_list_.empty()) {
+  if (observers_.empty()) {
     return;
   }
   if (signal_context_ == nullptr) {
@@ -28,14 +33,8 @@ void Signal::SetValue(const lepus::Value& value) {
     return;
   }
   signal_context_->RunUpdates([this]() {
-    for (auto computation : computation_list_) {
-      if (computation->GetState() == ScopeState::kStateNone) {
-        signal_context_->EnqueueComputation(computation);
-        if (computation->GetScopeType() == ScopeType::kMemoComputation) {
-          computation->MarkDownStream();
-        }
-      }
-      computation->SetState(ScopeState::kStateStale);
+    for (const auto& observer : observers_) {
+      signal_context_->EnqueueComputation(observer.computation);
     }
   });
 }
@@ -46,16 +45,29 @@ lepus::Value Signal::GetValue() {
     return value_;
   }
 
+  UpdateIfNecessary();
+
   auto computation = signal_context_->GetTopComputation();
   if (computation != nullptr) {
     computation->PushSignal(this);
-    computation_list_.emplace_back(computation);
   }
   return value_;
 }
 
-void Signal::CleanComputation(Computation* computation) {
-  computation_list_.remove(computation);
+uint32_t Signal::AddObserver(Computation* computation, uint32_t source_slot) {
+  observers_.push_back({computation, source_slot});
+  return static_cast<uint32_t>(observers_.size() - 1);
+}
+
+void Signal::RemoveObserver(uint32_t observer_slot) {
+  DCHECK(observer_slot < observers_.size());
+  // Move the last edge into the slot, and tell its computation where it is.
+  const Observer& last = observers_.back();
+  if (observer_slot != observers_.size() - 1) {
+    observers_[observer_slot] = last;
+    last.computation->sources_[last.source_slot].observer_slot = observer_slot;
+  }
+  observers_.pop_back();
 }
 
 }  // namespace tasm
@@ -5,7 +5,7 @@
 #ifndef CORE_RENDERER_SIGNAL_LYNX_SIGNAL_H_
 #define CORE_RENDERER_SIGNAL_LYNX_SIGNAL_H_
 
-#include <list>
+#include <cstdint>
 
 #include "base/include/vector.h"
 #include "core/runtime/vm/lepus/lepus_value.h"
@@ -30,14 +30,31 @@ class Signal : public lepus::RefCounted {
   void SetValue(const lepus::Value& value);
   lepus::Value GetValue();
 
-  void CleanComputation(Computation* computation);
+  // The height of the signal in the dependency graph. The computations that
+  // read a signal are higher than it, so that they run after it is updated.
+  virtual uint32_t height() const { return 0; }
 
-  virtual void LookUpstream(Computation* ignore) {}
+  // Brings the value up to date before it is read during a batch.
+  virtual void UpdateIfNecessary() {}
 
  protected:
+  friend class Computation;
+
+  // An edge to a computation reading the signal. The slot is the index of the
+  // edge in the sources of the computation, so that the edge is removed from
+  // both sides in constant time.
+  struct Observer {
+    Computation* computation;
+    uint32_t source_slot;
+  };
+
+  // Returns the index of the new edge in the observers.
+  uint32_t AddObserver(Computation* computation, uint32_t source_slot);
+  void RemoveObserver(uint32_t observer_slot);
+
   SignalContext* signal_context_;
   lepus::Value value_;
-  std::list<Computation*> computation_list_;
+  base::Vector<Observer> observers_;
 };
 
 }  // namespace tasm
@@ -38,7 +38,7 @@ TEST_P(SignalTest, TestSetValue) {
   Computation computation0(&signal_context_, nullptr, lepus::Value(),
                            lepus::Value(), true, nullptr);
 
-  signal0.computation_list_.emplace_back(&computation0);
+  computation0.PushSignal(&signal0);
   signal0.SetValue(lepus::Value(3));
 
   Signal signal1(nullptr, lepus::Value(1));
@@ -47,7 +47,7 @@ TEST_P(SignalTest, TestSetValue) {
   signal1.SetValue(lepus::Value(1));
   signal1.SetValue(lepus::Value(2));
 
-  signal1.computation_list_.emplace_back(&computation0);
+  computation0.PushSignal(&signal1);
   signal1.SetValue(lepus::Value(3));
 }
 
@@ -56,15 +56,17 @@ TEST_P(SignalTest, TestGetValue) {
   EXPECT_EQ(signal0.signal_context(), &signal_context_);
 
   EXPECT_EQ(signal0.GetValue(), lepus::Value(1));
-  EXPECT_EQ(signal0.computation_list_.size(), 0);
+  EXPECT_EQ(signal0.observers_.size(), 0);
 
   Computation computation0(&signal_context_, nullptr, lepus::Value(),
                            lepus::Value(), true, nullptr);
   signal_context_.computation_stack_.emplace_back(&computation0);
 
   EXPECT_EQ(signal0.GetValue(), lepus::Value(1));
-  EXPECT_EQ(signal0.computation_list_.size(), 1);
-  EXPECT_EQ(signal0.computation_list_.front(), &computation0);
+  EXPECT_EQ(signal0.observers_.size(), 1);
+  EXPECT_EQ(signal0.observers_[0].computation, &computation0);
+  EXPECT_EQ(computation0.sources_.size(), 1);
+  EXPECT_EQ(computation0.sources_[0].observer_slot, 0);
 }
 
 INSTANTIATE_TEST_SUITE_P(SignalTestModule, SignalTest,
@@ -26,26 +26,10 @@ void Memo::OnCleanUp(const lepus::Value& block) {
 
 void Memo::OnInvoked(const lepus::Value& value) { SetValue(value); }
 
-void Memo::MarkDownStream() {
-  for (auto computation : computation_list_) {
-    if (computation->GetState() != ScopeState::kStateNone) {
-      computation->SetState(ScopeState::kStatePending);
+uint32_t Memo::height() const { return computation_->height(); }
 
-      signal_context()->EnqueueComputation(computation);
-
-      computation->MarkDownStream();
-    }
-  }
-}
-
-void Memo::LookUpstream(Computation* ignore) {
-  if (computation_->GetState() == ScopeState::kStateStale) {
-    if (computation_.get() != ignore) {
-      signal_context()->RunComputation(computation_.get());
-    }
-  } else if (computation_->GetState() == ScopeState::kStatePending) {
-    computation_->LookUpstream(ignore);
-  }
+void Memo::UpdateIfNecessary() {
+  signal_context()->UpdateIfNecessary(computation_.get());
 }
 
 }  // namespace tasm
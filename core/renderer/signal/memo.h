@@ -36,9 +36,9 @@ class Memo : public Signal {
 
   void OnInvoked(const lepus::Value& value);
 
-  void MarkDownStream();
+  uint32_t height() const override;
 
-  void LookUpstream(Computation* ignore) override;
+  void UpdateIfNecessary() override;
 
  private:
   fml::RefPtr<Computation> computation_;
@@ -26,8 +26,10 @@ enum class ScopeType : int32_t {
 
 enum class ScopeState : int32_t {
   kStateNone = 0,
+  // Queued to run in the current batch.
   kStateStale,
-  kStatePending,
+  // Running, the signals it reads are not brought up to date again.
+  kStateRunning,
 };
 
 class SignalContext;
@@ -60,7 +62,7 @@ class BaseScope : public lepus::RefCounted {
 
  protected:
   ScopeType scope_type_{ScopeType::kPureScope};
-  ScopeState scope_state_;
+  ScopeState scope_state_{ScopeState::kStateNone};
 
   int32_t updated_time_{-1};
 
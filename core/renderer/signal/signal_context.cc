@@ -44,108 +44,93 @@ Computation* SignalContext::GetTopComputation() {
 }
 
 void SignalContext::RunUpdates(std::function<void()>&& func) {
-  if (memo_computation_list_ptr_ != nullptr) {
+  if (running_updates_) {
     func();
     return;
   }
 
-  EnsureMemoComputationList();
-
-  bool wait = false;
-  if (pure_computation_list_ptr_ != nullptr) {
-    wait = true;
-  } else {
-    EnsurePureComputationList();
-  }
-
+  running_updates_ = true;
   exec_count_++;
   func();
-  CompleteUpdates(wait);
-  return;
+  CompleteUpdates();
+  running_updates_ = false;
 }
 
-void SignalContext::CompleteUpdates(bool wait) {
-  if (memo_computation_list_ptr_ != nullptr) {
-    auto u = memo_computation_list_ptr_;
-    RunComputation(std::move(u));
-    memo_computation_list_ptr_ = nullptr;
-  }
-
-  if (wait) {
-    return;
-  }
-
-  auto e = pure_computation_list_ptr_;
-  pure_computation_list_ptr_ = nullptr;
-
-  if (e != nullptr && !e->empty()) {
-    RunUpdates([this, list = std::move(e)]() mutable {
-      RunComputation(std::move(list));
-    });
+void SignalContext::CompleteUpdates() {
+  // A memo is only run after all the lower memos, so it reads the values of
+  // the current batch and runs at most once, unless its sources are set again
+  // by the computations of the batch.
+  while (true) {
+    fml::RefPtr<Computation> computation = memo_queue_.Pop();
+    if (computation == nullptr) {
+      computation = pure_queue_.Pop();
+    }
+    if (computation == nullptr) {
+      break;
+    }
+    RunComputation(computation.get());
   }
 }
 
 void SignalContext::EnqueueComputation(Computation* computation) {
+  if (computation->GetState() == ScopeState::kStateStale) {
+    return;
+  }
+  HeightQueue* queue = nullptr;
   if (computation->GetScopeType() == ScopeType::kPureComputation) {
-    EnsurePureComputationList();
-    pure_computation_list_ptr_->emplace_back(
-        fml::RefPtr<Computation>(computation));
+    queue = &pure_queue_;
   } else if (computation->GetScopeType() == ScopeType::kMemoComputation) {
-    EnsureMemoComputationList();
-    memo_computation_list_ptr_->emplace_back(
-        fml::RefPtr<Computation>(computation));
+    queue = &memo_queue_;
+  } else {
+    return;
   }
+  computation->SetState(ScopeState::kStateStale);
+  queue->Push(fml::RefPtr<Computation>(computation));
 }
 
-bool SignalContext::IsScopeActiveComputation(BaseScope* scope) {
-  return scope != nullptr && scope->GetScopeType() != ScopeType::kPureScope &&
-         scope->GetUpdatedTime() < exec_count_ &&
-         scope->GetState() != ScopeState::kStateNone;
-}
-
-void SignalContext::RunComputation(Computation* computation) {
-  if (computation->GetState() == ScopeState::kStateNone) {
+void SignalContext::UpdateIfNecessary(Computation* computation) {
+  // The memos lower than the queued ones are up to date, so are the running
+  // ones, whose values are read while they are cleaning up.
+  if (memo_queue_.empty() ||
+      computation->height() < memo_queue_.min_height() ||
+      computation->GetState() == ScopeState::kStateRunning) {
     return;
   }
+  computation->UpdateSourcesIfNecessary();
+  if (computation->GetState() == ScopeState::kStateStale) {
+    RunComputation(computation);
+  }
+}
 
-  if (computation->GetState() == ScopeState::kStatePending) {
-    computation->LookUpstream(computation);
+void SignalContext::RunComputation(Computation* computation) {
+  if (computation->GetState() != ScopeState::kStateStale) {
     return;
   }
 
-  std::list<fml::RefPtr<Computation>> ancestors;
-  ancestors.push_back(fml::RefPtr<Computation>(computation));
-
-  auto node = computation->GetOwner();
-  while (IsScopeActiveComputation(node)) {
-    ancestors.push_front(
-        fml::RefPtr<Computation>(static_cast<Computation*>(node)));
-    node = node->GetOwner();
+  // The stale owners run first, which dispose of the computations created by
+  // their last runs, including this one.
+  base::InlineVector<fml::RefPtr<Computation>, 8> owners;
+  for (auto* owner = computation->GetOwner();
+       owner != nullptr && owner->GetScopeType() != ScopeType::kPureScope;
+       owner = owner->GetOwner()) {
+    if (owner->GetState() == ScopeState::kStateStale) {
+      owners.emplace_back(static_cast<Computation*>(owner));
+    }
   }
-
-  for (auto computation : ancestors) {
-    if (computation->GetState() == ScopeState::kStateStale) {
-      UpdateComputation(computation.get());
-    } else if (computation->GetState() == ScopeState::kStatePending) {
-      auto updates = memo_computation_list_ptr_;
-      memo_computation_list_ptr_ = nullptr;
-      RunUpdates([computation, &ancestors]() {
-        computation->LookUpstream(ancestors.back().get());
-      });
-      memo_computation_list_ptr_ = updates;
+  for (size_t i = owners.size(); i > 0; --i) {
+    if (owners[i - 1]->GetState() == ScopeState::kStateStale) {
+      UpdateComputation(owners[i - 1].get());
     }
   }
-}
 
-void SignalContext::RunComputation(
-    std::shared_ptr<std::list<fml::RefPtr<Computation>>>&& list) {
-  for (auto computation : *list) {
-    RunComputation(computation.get());
+  if (computation->GetState() == ScopeState::kStateStale) {
+    UpdateComputation(computation);
   }
 }
 
 void SignalContext::UpdateComputation(Computation* computation) {
   computation->CleanUp();
+  computation->SetState(ScopeState::kStateRunning);
 
   PushScope(computation);
   PushComputation(computation);
@@ -154,22 +139,45 @@ void SignalContext::UpdateComputation(Computation* computation) {
 
   PopComputation();
   PopScope();
+
+  // It is queued again if its sources are set while running.
+  if (computation->GetState() == ScopeState::kStateRunning) {
+    computation->SetState(ScopeState::kStateNone);
+  }
 }
 
-void SignalContext::EnsurePureComputationList() {
-  if (pure_computation_list_ptr_ != nullptr) {
-    return;
+void SignalContext::HeightQueue::Push(fml::RefPtr<Computation> computation) {
+  const uint32_t height = computation->height();
+  if (buckets_.size() <= height) {
+    buckets_.resize(height + 1);
   }
-  pure_computation_list_ptr_ =
-      std::make_shared<std::list<fml::RefPtr<Computation>>>();
+  buckets_[height].emplace_back(std::move(computation));
+  if (size_ == 0 || height < min_height_) {
+    min_height_ = height;
+  }
+  ++size_;
 }
 
-void SignalContext::EnsureMemoComputationList() {
-  if (memo_computation_list_ptr_ != nullptr) {
-    return;
+fml::RefPtr<Computation> SignalContext::HeightQueue::Pop() {
+  while (size_ > 0) {
+    auto& bucket = buckets_[min_height_];
+    if (bucket.empty()) {
+      ++min_height_;
+      continue;
+    }
+    fml::RefPtr<Computation> computation = std::move(bucket.front());
+    bucket.pop_front();
+    --size_;
+    // The height grows if the computation has read a higher memo after being
+    // queued, it is moved to the bucket of the new height.
+    if (computation->height() > min_height_ &&
+        computation->GetState() == ScopeState::kStateStale) {
+      Push(std::move(computation));
+      continue;
+    }
+    return computation;
   }
-  memo_computation_list_ptr_ =
-      std::make_shared<std::list<fml::RefPtr<Computation>>>();
+  return nullptr;
 }
 
 void SignalContext::WillDestroy() {
@@ -5,9 +5,10 @@
 #ifndef CORE_RENDERER_SIGNAL_SIGNAL_CONTEXT_H_
 #define CORE_RENDERER_SIGNAL_SIGNAL_CONTEXT_H_
 
-#include <list>
-#include <memory>
+#include <deque>
+#include <functional>
 #include <unordered_set>
+#include <vector>
 
 #include "base/include/fml/memory/ref_counted.h"
 #include "base/include/vector.h"
@@ -37,19 +38,21 @@ class SignalContext {
 
   void MarkUnTrack(bool enable_un_track) { enable_un_track_ = enable_un_track; }
 
+  // Runs the function as a batch. The computations reading the signals set in
+  // the batch run when the outermost batch completes, in the order of their
+  // heights, so that each of them runs after all the memos it reads have been
+  // updated. The memos run before the pure computations.
   void RunUpdates(std::function<void()>&& func);
 
-  void CompleteUpdates(bool wait);
-
   void EnqueueComputation(Computation* computation);
 
-  void RunComputation(Computation* computation);
-
-  void RunComputation(
-      std::shared_ptr<std::list<fml::RefPtr<Computation>>>&& list);
-
   void UpdateComputation(Computation* computation);
 
+  // Runs a queued memo computation before its turn if it may be out of date,
+  // which happens when it is read by a lower computation or by a computation
+  // that has set a signal.
+  void UpdateIfNecessary(Computation* computation);
+
   void WillDestroy();
 
   void RecordScope(Scope* scope);
@@ -57,24 +60,40 @@ class SignalContext {
   void EraseScope(Scope* scope);
 
  private:
-  void EnsurePureComputationList();
-  void EnsureMemoComputationList();
+  // The computations queued in a batch, bucketed by their heights.
+  class HeightQueue {
+   public:
+    bool empty() const { return size_ == 0; }
+    // No computation lower than it is queued.
+    uint32_t min_height() const { return min_height_; }
 
-  bool IsScopeActiveComputation(BaseScope* scope);
+    void Push(fml::RefPtr<Computation> computation);
+    // Returns the lowest computation, or nullptr if empty.
+    fml::RefPtr<Computation> Pop();
+
+   private:
+    std::vector<std::deque<fml::RefPtr<Computation>>> buckets_;
+    uint32_t min_height_{0};
+    size_t size_{0};
+  };
+
+  void CompleteUpdates();
+
+  void RunComputation(Computation* computation);
 
   bool enable_un_track_{false};
 
+  bool running_updates_{false};
+
   int32_t exec_count_{0};
 
   base::Vector<BaseScope*> scope_stack_;
 
   base::Vector<Computation*> computation_stack_;
 
-  std::shared_ptr<std::list<fml::RefPtr<Computation>>>
-      pure_computation_list_ptr_;
+  HeightQueue memo_queue_;
 
-  std::shared_ptr<std::list<fml::RefPtr<Computation>>>
-      memo_computation_list_ptr_;
+  HeightQueue pure_queue_;
 
   std::unordered_set<Scope*> scope_set_;
 };
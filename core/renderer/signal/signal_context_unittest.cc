@@ -2,12 +2,169 @@
 // Licensed under the Apache License Version 2.0 that can be found in the
 // LICENSE file in the root directory of this source tree.
 
+#define private public
+#define protected public
+
 #include "core/renderer/signal/signal_context_unittest.h"
 
+#include <vector>
+
+#include "core/renderer/signal/computation.h"
+#include "core/renderer/signal/lynx_signal.h"
+#include "core/renderer/signal/memo.h"
+#include "core/renderer/signal/scope.h"
+
 namespace lynx {
 namespace tasm {
 namespace testing {
-// TODO(songshourui.null): impl this later.
+
+namespace {
+
+// The closures of the computations are c functions reading the graph, since
+// they are called without the arguments of a lepus closure.
+struct Graph {
+  fml::RefPtr<Signal> a;
+  fml::RefPtr<Memo> b;
+  fml::RefPtr<Memo> c;
+  fml::RefPtr<Memo> d;
+  int b_count = 0;
+  int c_count = 0;
+  int d_count = 0;
+  std::vector<double> effect_values;
+};
+
+Graph* graph = nullptr;
+
+lepus::Value EmptyClosure(lepus::Context* context) { return lepus::Value(); }
+
+// b = a * 2
+lepus::Value ClosureB(lepus::Context* context) {
+  ++graph->b_count;
+  return lepus::Value(graph->a->GetValue().Number() * 2);
+}
+
+// c = b + 1
+lepus::Value ClosureC(lepus::Context* context) {
+  ++graph->c_count;
+  return lepus::Value(graph->b->GetValue().Number() + 1);
+}
+
+// d = b + c
+lepus::Value ClosureD(lepus::Context* context) {
+  ++graph->d_count;
+  return lepus::Value(graph->b->GetValue().Number() +
+                      graph->c->GetValue().Number());
+}
+
+lepus::Value Effect(lepus::Context* context) {
+  graph->effect_values.push_back(graph->d->GetValue().Number());
+  return lepus::Value();
+}
+
+}  // namespace
+
+void SignalContextTest::SetUp() { vm_context_.Initialize(); }
+
+void SignalContextTest::TearDown() { graph = nullptr; }
+
+// Not used for now.
+const std::tuple<bool> test_params[] = {std::make_tuple(true),
+                                        std::make_tuple(false)};
+
+TEST_P(SignalContextTest, TestGlitchFreeUpdates) {
+  Graph g;
+  graph = &g;
+  auto scope = fml::MakeRefCounted<Scope>(&signal_context_, &vm_context_,
+                                          lepus::Value(EmptyClosure));
+  signal_context_.PushScope(scope.get());
+
+  g.a = fml::MakeRefCounted<Signal>(&signal_context_, lepus::Value(1));
+  g.b = fml::MakeRefCounted<Memo>(&signal_context_, &vm_context_,
+                                  lepus::Value(ClosureB), lepus::Value());
+  g.c = fml::MakeRefCounted<Memo>(&signal_context_, &vm_context_,
+                                  lepus::Value(ClosureC), lepus::Value());
+  g.d = fml::MakeRefCounted<Memo>(&signal_context_, &vm_context_,
+                                  lepus::Value(ClosureD), lepus::Value());
+  fml::MakeRefCounted<Computation>(&signal_context_, &vm_context_,
+                                   lepus::Value(Effect), lepus::Value(), true,
+                                   nullptr);
+
+  EXPECT_EQ(g.b->height(), 1);
+  EXPECT_EQ(g.c->height(), 2);
+  EXPECT_EQ(g.d->height(), 3);
+  EXPECT_EQ(g.effect_values, std::vector<double>({5}));
+
+  // Each memo runs once, and d never reads the new b with the old c.
+  g.a->SetValue(lepus::Value(2));
+  EXPECT_EQ(g.b_count, 2);
+  EXPECT_EQ(g.c_count, 2);
+  EXPECT_EQ(g.d_count, 2);
+  EXPECT_EQ(g.effect_values, std::vector<double>({5, 9}));
+
+  // The signals set in a batch are propagated once.
+  signal_context_.RunUpdates([&g]() {
+    g.a->SetValue(lepus::Value(3));
+    g.a->SetValue(lepus::Value(4));
+  });
+  EXPECT_EQ(g.b_count, 3);
+  EXPECT_EQ(g.d_count, 3);
+  EXPECT_EQ(g.effect_values, std::vector<double>({5, 9, 17}));
+
+  // Nothing runs if the value does not change.
+  g.a->SetValue(lepus::Value(4));
+  EXPECT_EQ(g.b_count, 3);
+
+  signal_context_.PopScope();
+  scope->CleanUp();
+}
+
+TEST_P(SignalContextTest, TestUpdateIfNecessary) {
+  Graph g;
+  graph = &g;
+  auto scope = fml::MakeRefCounted<Scope>(&signal_context_, &vm_context_,
+                                          lepus::Value(EmptyClosure));
+  signal_context_.PushScope(scope.get());
+
+  g.a = fml::MakeRefCounted<Signal>(&signal_context_, lepus::Value(1));
+  g.b = fml::MakeRefCounted<Memo>(&signal_context_, &vm_context_,
+                                  lepus::Value(ClosureB), lepus::Value());
+  g.c = fml::MakeRefCounted<Memo>(&signal_context_, &vm_context_,
+                                  lepus::Value(ClosureC), lepus::Value());
+
+  // A memo read in the batch which has set its sources is brought up to
+  // date before its turn, and does not run again.
+  signal_context_.RunUpdates([&g]() {
+    g.a->SetValue(lepus::Value(2));
+    EXPECT_EQ(g.c->GetValue().Number(), 5);
+  });
+  EXPECT_EQ(g.b_count, 2);
+  EXPECT_EQ(g.c_count, 2);
+
+  signal_context_.PopScope();
+  scope->CleanUp();
+}
+
+TEST_P(SignalContextTest, TestRemoveObserver) {
+  Signal signal(&signal_context_, lepus::Value(1));
+  Computation computation0(&signal_context_, nullptr, lepus::Value(),
+                           lepus::Value(), true, nullptr);
+  Computation computation1(&signal_context_, nullptr, lepus::Value(),
+                           lepus::Value(), true, nullptr);
+  computation0.PushSignal(&signal);
+  computation1.PushSignal(&signal);
+  EXPECT_EQ(signal.observers_.size(), 2);
+
+  // The last edge is moved into the removed slot.
+  computation0.CleanUp();
+  EXPECT_EQ(signal.observers_.size(), 1);
+  EXPECT_EQ(signal.observers_[0].computation, &computation1);
+  EXPECT_EQ(computation1.sources_[0].observer_slot, 0);
+  EXPECT_EQ(computation1.height(), 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(SignalContextTestModule, SignalContextTest,
+                         ::testing::ValuesIn(test_params));
+
 }  // namespace testing
 }  // namespace tasm
 }  // namespace lynx
@@ -8,6 +8,7 @@
 #include <tuple>
 
 #include "core/renderer/signal/signal_context.h"
+#include "core/runtime/vm/lepus/vm_context.h"
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
 
 namespace lynx {
@@ -15,7 +16,16 @@ namespace tasm {
 namespace testing {
 
 class SignalContextTest : public ::testing::TestWithParam<std::tuple<bool>> {
-  // TODO(songshourui.null): impl this later.
+ public:
+  SignalContextTest() = default;
+  ~SignalContextTest() = default;
+
+  void SetUp() override;
+  void TearDown() override;
+
+ protected:
+  lepus::VMContext vm_context_;
+  SignalContext signal_context_;
 };
 
 }  // namespace testing
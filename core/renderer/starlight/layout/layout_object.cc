@@ -370,6 +370,81 @@ void LayoutObject::ReLayoutWithConstraints(Constraints& constraints,
   SendLayoutEvent(LayoutEventType::RoundToPixelGridEnd);
 }
 
+bool LayoutObject::IsLayoutBoundary() const {
+  const LayoutObject* parent = ParentLayoutObject();
+  if (parent == nullptr || IsFixed()) {
+    return false;
+  }
+  const auto& style = *css_style_;
+  if (!style.GetWidth().IsUnit() || !style.GetHeight().IsUnit()) {
+    return false;
+  }
+  // Percentages are resolved against the containing block.
+  for (const NLength* length :
+       {&style.GetMinWidth(), &style.GetMaxWidth(), &style.GetMinHeight(),
+        &style.GetMaxHeight(), &style.GetMarginLeft(), &style.GetMarginRight(),
+        &style.GetMarginTop(), &style.GetMarginBottom(),
+        &style.GetPaddingLeft(), &style.GetPaddingRight(),
+        &style.GetPaddingTop(), &style.GetPaddingBottom()}) {
+    if (length->ContainsPercentage()) {
+      return false;
+    }
+  }
+  // Items resized by the parent would miss the cache. Items that may shrink
+  // are resized once their line overflows, which depends on their siblings.
+  const auto parent_display =
+      parent->GetCSSStyle()->GetDisplay(parent->configs_, parent->attr_map());
+  if (parent_display == DisplayType::kFlex &&
+      (style.GetFlexGrow() > 0 || style.GetFlexShrink() > 0 ||
+       !style.GetFlexBasis().IsAuto())) {
+    return false;
+  }
+  if (parent_display == DisplayType::kLinear && style.GetLinearWeight() > 0) {
+    return false;
+  }
+  return true;
+}
+
+void LayoutObject::CollectDirtyLayoutBoundaries(
+    std::vector<LayoutObject*>& boundaries) {
+  for (Node* node = FirstChild(); node != nullptr; node = node->Next()) {
+    static_cast<LayoutObject*>(node)->CollectDirtyLayoutBoundariesRecursively(
+        boundaries);
+  }
+}
+
+bool LayoutObject::CollectDirtyLayoutBoundariesRecursively(
+    std::vector<LayoutObject*>& boundaries) {
+  if (css_style_->GetDisplay(configs_, attr_map()) == DisplayType::kNone) {
+    // The subtree is only hidden, without being measured.
+    return true;
+  }
+  const size_t first_boundary_index = boundaries.size();
+  bool concurrent =
+      !measure_func_ && !alignment_func_ && !is_list_ && !IsFixed();
+  for (Node* node = FirstChild(); node != nullptr; node = node->Next()) {
+    concurrent = static_cast<LayoutObject*>(node)
+                     ->CollectDirtyLayoutBoundariesRecursively(boundaries) &&
+                 concurrent;
+  }
+  // Leaves are not worth dispatching and have no cached measure result.
+  if (concurrent && GetChildCount() && IsDirty() && IsLayoutBoundary()) {
+    boundaries.resize(first_boundary_index);
+    boundaries.push_back(this);
+  }
+  return concurrent;
+}
+
+void LayoutObject::LayoutAsBoundary() {
+  // Neither the box info nor the preferred size depends on the containing
+  // block, so an indefinite one results in the constraints from the parent.
+  Constraints containing_block;
+  box_info_->InitializeBoxInfo(containing_block, *this, GetLayoutConfigs());
+  UpdateMeasure(
+      property_utils::GenerateDefaultConstraints(*this, containing_block),
+      true);
+}
+
 void LayoutObject::SendLayoutEvent(LayoutEventType type,
                                    const LayoutEventData& data) {
   if (event_handler_) {
@@ -231,6 +231,21 @@ class LayoutObject : public ContainerNode {
   void ReLayoutWithConstraints(Constraints& constraints,
                                const SLNodeSet* fixed_node_set = nullptr);
 
+  // A layout boundary is a box whose size and box info depend neither on its
+  // parent nor on its content, e.g. a card with fixed width and height. Its
+  // subtree can be laid out before the parent's, and the parent then reuses
+  // the cached measure result.
+  //
+  // Collects the dirty layout boundaries among the descendants whose subtrees
+  // have no measure or alignment functions, no fixed nodes and no lists, so
+  // that they can be laid out on other threads. Nested boundaries are not
+  // collected separately.
+  BASE_EXPORT void CollectDirtyLayoutBoundaries(
+      std::vector<LayoutObject*>& boundaries);
+  // Measures a layout boundary with the constraints given by its parent.
+  // Different boundaries can be measured concurrently.
+  BASE_EXPORT void LayoutAsBoundary();
+
   void UpdateConstraintsForViewport(Constraints& constraints);
   virtual FloatSize UpdateMeasure(const Constraints& constraints,
                                   bool final_measure,
@@ -291,6 +306,10 @@ class LayoutObject : public ContainerNode {
 
   void RemoveAlgorithm();
   void RemoveAlgorithmRecursive();
+  bool IsLayoutBoundary() const;
+  // Returns whether the subtree can be laid out on another thread.
+  bool CollectDirtyLayoutBoundariesRecursively(
+      std::vector<LayoutObject*>& boundaries);
   bool CanReuseLayoutResultForCustomMeasureNode(bool is_horizontal) const;
 
   base::Position measured_position_;
@@ -0,0 +1,244 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/starlight/layout/layout_object.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "core/renderer/css/computed_css_style.h"
+#include "core/renderer/starlight/types/layout_configs.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace starlight {
+namespace testing {
+
+namespace {
+
+constexpr int32_t kCardCount = 64;
+constexpr int32_t kItemCountPerCard = 4;
+
+class TestNode {
+ public:
+  TestNode()
+      : css_style_(std::make_unique<ComputedCSSStyle>(1.f, 1.f)),
+        layout_object_(std::make_unique<LayoutObject>(
+            LayoutConfigs(), css_style_->GetLayoutComputedStyle())) {}
+
+  ~TestNode() {
+    if (layout_object_->parent()) {
+      layout_object_->parent()->RemoveChild(layout_object_.get());
+    }
+  }
+
+  void SetLength(tasm::CSSPropertyID id, float value,
+                 tasm::CSSValuePattern pattern = tasm::CSSValuePattern::PX) {
+    css_style_->SetValue(id, tasm::CSSValue(lepus::Value(value), pattern));
+    layout_object_->MarkDirty();
+  }
+
+  void SetEnum(tasm::CSSPropertyID id, int value) {
+    css_style_->SetValue(id, tasm::CSSValue::MakeEnum(value));
+    layout_object_->MarkDirty();
+  }
+
+  void SetNumber(tasm::CSSPropertyID id, float value) {
+    css_style_->SetValue(
+        id, tasm::CSSValue(lepus::Value(value), tasm::CSSValuePattern::NUMBER));
+    layout_object_->MarkDirty();
+  }
+
+  LayoutObject* layout_object() { return layout_object_.get(); }
+
+ private:
+  std::unique_ptr<ComputedCSSStyle> css_style_;
+  std::unique_ptr<LayoutObject> layout_object_;
+};
+
+class TestTree {
+ public:
+  // A wrapping row of fixed-size cards, each with a column of items.
+  TestTree() {
+    TestNode* root = CreateNode(nullptr);
+    root->SetLength(tasm::kPropertyIDWidth, 400.f);
+    root->SetEnum(tasm::kPropertyIDDisplay,
+                  static_cast<int>(DisplayType::kFlex));
+    root->SetEnum(tasm::kPropertyIDFlexWrap,
+                  static_cast<int>(FlexWrapType::kWrap));
+    for (int32_t i = 0; i < kCardCount; ++i) {
+      TestNode* card = CreateNode(root);
+      card->SetLength(tasm::kPropertyIDWidth, 90.f);
+      card->SetLength(tasm::kPropertyIDHeight, 120.f);
+      card->SetLength(tasm::kPropertyIDMarginLeft, 5.f);
+      card->SetLength(tasm::kPropertyIDPaddingTop, 3.f);
+      card->SetNumber(tasm::kPropertyIDFlexShrink, 0.f);
+      for (int32_t j = 0; j < kItemCountPerCard; ++j) {
+        TestNode* item = CreateNode(card);
+        item->SetLength(tasm::kPropertyIDWidth, 50.f,
+                        tasm::CSSValuePattern::PERCENT);
+        item->SetLength(tasm::kPropertyIDHeight, 10.f + j);
+        item->SetLength(tasm::kPropertyIDMarginTop, 2.f);
+      }
+    }
+  }
+
+  ~TestTree() {
+    // Children are destroyed before their parents.
+    while (!nodes_.empty()) {
+      nodes_.pop_back();
+    }
+  }
+
+  TestNode* CreateNode(TestNode* parent) {
+    nodes_.emplace_back(std::make_unique<TestNode>());
+    TestNode* node = nodes_.back().get();
+    if (parent) {
+      parent->layout_object()->AppendChild(node->layout_object());
+    }
+    return node;
+  }
+
+  TestNode* node(size_t index) { return nodes_[index].get(); }
+  TestNode* card(int32_t index) {
+    return node(1 + index * (kItemCountPerCard + 1));
+  }
+  LayoutObject* root() { return node(0)->layout_object(); }
+  size_t size() const { return nodes_.size(); }
+
+  void ReLayout() {
+    root()->ReLayout();
+    for (auto& node : nodes_) {
+      node->layout_object()->MarkUpdated();
+    }
+  }
+
+ private:
+  std::vector<std::unique_ptr<TestNode>> nodes_;
+};
+
+void LayoutBoundariesOnThreads(std::vector<LayoutObject*>& boundaries) {
+  constexpr size_t kThreadCount = 4;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back([&boundaries, i]() {
+      for (size_t j = i; j < boundaries.size(); j += kThreadCount) {
+        boundaries[j]->LayoutAsBoundary();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+void ExpectSameLayout(TestTree& expected, TestTree& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    LayoutObject* expected_node = expected.node(i)->layout_object();
+    LayoutObject* actual_node = actual.node(i)->layout_object();
+    EXPECT_FLOAT_EQ(expected_node->GetBorderBoundWidth(),
+                    actual_node->GetBorderBoundWidth());
+    EXPECT_FLOAT_EQ(expected_node->GetBorderBoundHeight(),
+                    actual_node->GetBorderBoundHeight());
+    EXPECT_FLOAT_EQ(expected_node->GetBorderBoundLeftFromParentPaddingBound(),
+                    actual_node->GetBorderBoundLeftFromParentPaddingBound());
+    EXPECT_FLOAT_EQ(expected_node->GetBorderBoundTopFromParentPaddingBound(),
+                    actual_node->GetBorderBoundTopFromParentPaddingBound());
+  }
+}
+
+FloatSize MeasureFixedSize(void* context, const Constraints& constraints,
+                           bool final_measure) {
+  return FloatSize(20.f, 20.f, 0.f);
+}
+
+}  // namespace
+
+TEST(LayoutObjectTest, CollectDirtyLayoutBoundaries) {
+  TestTree tree;
+  std::vector<LayoutObject*> boundaries;
+  tree.root()->CollectDirtyLayoutBoundaries(boundaries);
+  ASSERT_EQ(boundaries.size(), static_cast<size_t>(kCardCount));
+  EXPECT_EQ(boundaries.front(), tree.card(0)->layout_object());
+
+  // Cards resized by the parent, or with measure functions inside, are not
+  // boundaries.
+  tree.card(0)->SetNumber(tasm::kPropertyIDFlexGrow, 1.f);
+  tree.card(1)->SetLength(tasm::kPropertyIDPaddingLeft, 10.f,
+                          tasm::CSSValuePattern::PERCENT);
+  static_cast<LayoutObject*>(tree.card(2)->layout_object()->FirstChild())
+      ->SetSLMeasureFunc(MeasureFixedSize);
+  boundaries.clear();
+  tree.root()->CollectDirtyLayoutBoundaries(boundaries);
+  ASSERT_EQ(boundaries.size(), static_cast<size_t>(kCardCount - 3));
+  EXPECT_EQ(boundaries.front(), tree.card(3)->layout_object());
+
+  // Clean cards are skipped.
+  tree.ReLayout();
+  boundaries.clear();
+  tree.root()->CollectDirtyLayoutBoundaries(boundaries);
+  EXPECT_TRUE(boundaries.empty());
+  tree.card(5)->SetLength(tasm::kPropertyIDHeight, 100.f);
+  tree.root()->CollectDirtyLayoutBoundaries(boundaries);
+  ASSERT_EQ(boundaries.size(), 1u);
+  EXPECT_EQ(boundaries.front(), tree.card(5)->layout_object());
+}
+
+TEST(LayoutObjectTest, ShrinkableItemsAreNotLayoutBoundaries) {
+  // A nowrap row of fixed-size cards wider than the row, so the cards that
+  // may shrink are resized by the row.
+  TestTree expected;
+  TestTree actual;
+  for (TestTree* tree : {&expected, &actual}) {
+    tree->node(0)->SetEnum(tasm::kPropertyIDFlexWrap,
+                           static_cast<int>(FlexWrapType::kNowrap));
+    for (int32_t i = 0; i < kCardCount; i += 2) {
+      tree->card(i)->SetNumber(tasm::kPropertyIDFlexShrink, 1.f);
+    }
+  }
+  expected.ReLayout();
+
+  std::vector<LayoutObject*> boundaries;
+  actual.root()->CollectDirtyLayoutBoundaries(boundaries);
+  ASSERT_EQ(boundaries.size(), static_cast<size_t>(kCardCount / 2));
+  EXPECT_EQ(boundaries.front(), actual.card(1)->layout_object());
+  LayoutBoundariesOnThreads(boundaries);
+  actual.ReLayout();
+  ExpectSameLayout(expected, actual);
+  EXPECT_LT(actual.card(0)->layout_object()->GetBorderBoundWidth(), 90.f);
+  EXPECT_FLOAT_EQ(actual.card(1)->layout_object()->GetBorderBoundWidth(),
+                  90.f);
+}
+
+TEST(LayoutObjectTest, LayoutBoundariesConcurrently) {
+  TestTree expected;
+  expected.ReLayout();
+
+  TestTree actual;
+  std::vector<LayoutObject*> boundaries;
+  actual.root()->CollectDirtyLayoutBoundaries(boundaries);
+  ASSERT_EQ(boundaries.size(), static_cast<size_t>(kCardCount));
+  LayoutBoundariesOnThreads(boundaries);
+  actual.ReLayout();
+  ExpectSameLayout(expected, actual);
+
+  // Relayout after updating some of the cards.
+  for (int32_t i = 0; i < kCardCount; i += 3) {
+    expected.card(i)->SetLength(tasm::kPropertyIDHeight, 80.f);
+    actual.card(i)->SetLength(tasm::kPropertyIDHeight, 80.f);
+  }
+  expected.ReLayout();
+  boundaries.clear();
+  actual.root()->CollectDirtyLayoutBoundaries(boundaries);
+  EXPECT_EQ(boundaries.size(), static_cast<size_t>((kCardCount + 2) / 3));
+  LayoutBoundariesOnThreads(boundaries);
+  actual.ReLayout();
+  ExpectSameLayout(expected, actual);
+}
+
+}  // namespace testing
+}  // namespace starlight
+}  // namespace lynx
@@ -42,6 +42,7 @@
 #define FEATURE_CSS_VALUE_VERSION tasm::V_2_0
 #define FEATURE_CSS_STYLE_VARIABLES tasm::V_2_0
 #define FEATURE_CSS_FONT_FACE_EXTENSION tasm::V_2_7
+#define FEATURE_CSS_SELECTOR_PROGRAM tasm::V_3_3
 #define FEATURE_HEADER_EXT_INFO_VERSION tasm::V_1_6
 #define FEATURE_DYNAMIC_COMPONENT_VERSION tasm::V_1_6
 #define FEATURE_RADON_DYNAMIC_COMPONENT_VERSION tasm::V_2_1
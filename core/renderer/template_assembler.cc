@@ -105,6 +105,48 @@ base::LynxError ConstructLynxErrorForLazyBundle(const std::string& url,
   return error;
 }
 
+void MarkSectionDecodeTimings(
+    const std::vector<SectionDecodeTiming>& timings) {
+  for (const auto& timing : timings) {
+    const char* start_key = nullptr;
+    const char* end_key = nullptr;
+    switch (timing.section) {
+      case BinarySection::CSS:
+        start_key = timing::kTemplateBundleParseCSSStart;
+        end_key = timing::kTemplateBundleParseCSSEnd;
+        break;
+      case BinarySection::JS:
+        start_key = timing::kTemplateBundleParseJSStart;
+        end_key = timing::kTemplateBundleParseJSEnd;
+        break;
+      case BinarySection::JS_BYTECODE:
+        start_key = timing::kTemplateBundleParseJSBytecodeStart;
+        end_key = timing::kTemplateBundleParseJSBytecodeEnd;
+        break;
+      case BinarySection::ROOT_LEPUS:
+        start_key = timing::kTemplateBundleParseLepusStart;
+        end_key = timing::kTemplateBundleParseLepusEnd;
+        break;
+      case BinarySection::LEPUS_CHUNK:
+        start_key = timing::kTemplateBundleParseLepusChunkStart;
+        end_key = timing::kTemplateBundleParseLepusChunkEnd;
+        break;
+      case BinarySection::NEW_ELEMENT_TEMPLATE:
+        start_key = timing::kTemplateBundleParseElementTemplateStart;
+        end_key = timing::kTemplateBundleParseElementTemplateEnd;
+        break;
+      case BinarySection::PARSED_STYLES:
+        start_key = timing::kTemplateBundleParseParsedStylesStart;
+        end_key = timing::kTemplateBundleParseParsedStylesEnd;
+        break;
+      default:
+        continue;
+    }
+    TimingCollector::Instance()->Mark(start_key, timing.start);
+    TimingCollector::Instance()->Mark(end_key, timing.end);
+  }
+}
+
 class ComponentUpdateReporter {
  public:
   ComponentUpdateReporter(const runtime::UpdateDataTask& task,
@@ -836,6 +878,7 @@ void TemplateAssembler::LoadTemplateBundle(
                                     template_bundle.decode_start_timestamp_);
   TimingCollector::Instance()->Mark(tasm::timing::kTemplateBundleParseEnd,
                                     template_bundle.decode_end_timestamp_);
+  MarkSectionDecodeTimings(template_bundle.section_decode_timings_);
   LoadTemplateInternal(
       url, template_data, pipeline_options,
       [this, template_bundle = std::move(template_bundle)](
@@ -2086,6 +2129,9 @@ bool TemplateAssembler::FromBinary(const std::shared_ptr<TemplateEntry>& entry,
     ReportDecodeError(is_card, entry, reader->error_message_);
     return false;
   }
+  if (is_card) {
+    MarkSectionDecodeTimings(reader->GetSectionDecodeTimings());
+  }
 
   entry->SetLazyReader(std::move(reader));
   return true;
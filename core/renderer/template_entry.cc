@@ -199,6 +199,7 @@ bool TemplateEntry::InitWithPageConfigger(
 
   SetEnableMicrotaskPromisePolyfill(
       page_config->GetEnableMicrotaskPromisePolyfill());
+  SetEnableCSSFragmentPrefetch(page_config->GetEnableCSSFragmentPrefetch());
   return true;
 }
 
@@ -306,6 +307,7 @@ bool TemplateEntry::Execute() {
 TemplateEntry::~TemplateEntry() {
   DetachNapiEnvironment();
   template_bundle_.css_style_manager_->SetThreadStopFlag(true);
+  template_bundle_.css_style_manager_->CancelCSSFragmentPrefetch();
   template_bundle_.lepus_chunk_manager_->SetThreadStopFlag(true);
 #if ENABLE_TRACE_PERFETTO
   if (vm_context_ && vm_context_->IsLepusNGContext()) {
@@ -495,6 +497,12 @@ bool TemplateEntry::LoadLepusChunk(const std::string& entry_path,
 
   LynxTemplateBundle& template_bundle = template_bundle_;
 
+  // The component is usually created right after its lepus chunk is loaded,
+  // so its css is decoded in parallel with the lepus chunk.
+  if (enable_css_fragment_prefetch_) {
+    PrefetchCSSForLepusChunk(entry_path);
+  }
+
   auto lepus_chunk_opt = template_bundle.GetLepusChunk(entry_path);
   lepus::Value lepus_chunk_eval_result{};
 
@@ -513,6 +521,18 @@ bool TemplateEntry::LoadLepusChunk(const std::string& entry_path,
   return false;
 }
 
+void TemplateEntry::PrefetchCSSForLepusChunk(const std::string& entry_path) {
+  if (!reader_) {
+    return;
+  }
+  for (const auto& [id, mould] : component_moulds()) {
+    if (mould->path() == entry_path) {
+      reader_->PrefetchCSSFragmentByIdInRender(mould->css_id());
+      return;
+    }
+  }
+}
+
 std::unique_ptr<LynxBinaryRecyclerDelegate>
 TemplateEntry::GetTemplateBundleRecycler() {
   return reader_ ? reader_->CreateRecycler() : nullptr;
@@ -169,6 +169,9 @@ class TemplateEntry : public VmContextHolder, public CSSStyleSheetDelegate {
   }
 
   void SetEnableBindICU(bool enable) { enable_bind_icu_ = enable; }
+  void SetEnableCSSFragmentPrefetch(bool enable) {
+    enable_css_fragment_prefetch_ = enable;
+  }
   void SetEnableMicrotaskPromisePolyfill(bool enable) {
     enable_microtask_promise_polyfill_ = enable;
   }
@@ -242,6 +245,9 @@ class TemplateEntry : public VmContextHolder, public CSSStyleSheetDelegate {
 
   std::string GenerateLepusJSFileName(const std::string& name);
 
+  // Prefetch the css of the component whose lepus chunk is at entry_path.
+  void PrefetchCSSForLepusChunk(const std::string& entry_path);
+
   std::string name_;
   bool is_card_{true};
 
@@ -270,6 +276,7 @@ class TemplateEntry : public VmContextHolder, public CSSStyleSheetDelegate {
   bool enable_js_binding_api_throw_exception_ = false;
   bool enable_bind_icu_ = false;
   bool enable_microtask_promise_polyfill_{false};
+  bool enable_css_fragment_prefetch_{false};
 #if ENABLE_LEPUSNG_WORKLET
   std::unique_ptr<lynx::piper::NapiEnvironment> napi_environment_;
 #endif
@@ -37,5 +37,9 @@ void LayoutNodeAndroid::Align(JNIEnv* env, jobject obj) {
   Java_LayoutNode_align(env, obj);
 }
 
+int64_t LayoutNodeAndroid::GetMeasureCacheKey(JNIEnv* env, jobject obj) {
+  return Java_LayoutNode_getMeasureCacheKey(env, obj);
+}
+
 }  // namespace tasm
 }  // namespace lynx
@@ -17,6 +17,7 @@ class LayoutNodeAndroid {
       JNIEnv* env, jobject obj, jfloat width, int widthMode, jfloat height,
       int heightMode, jboolean finalMeasure);
   static void Align(JNIEnv* env, jobject obj);
+  static int64_t GetMeasureCacheKey(JNIEnv* env, jobject obj);
 };
 
 }  // namespace tasm
@@ -198,5 +198,16 @@ void MeasureFuncAndroid::Alignment() {
   lynx::tasm::LayoutNodeAndroid::Align(env, local_java_ref.Get());
 }
 
+uint64_t MeasureFuncAndroid::GetMeasureCacheKey() {
+  JNIEnv* env = base::android::AttachCurrentThread();
+  base::android::ScopedLocalJavaRef<jobject> local_java_ref(jni_object_);
+  if (local_java_ref.IsNull()) {
+    return 0;
+  }
+  return static_cast<uint64_t>(
+      lynx::tasm::LayoutNodeAndroid::GetMeasureCacheKey(env,
+                                                        local_java_ref.Get()));
+}
+
 }  // namespace tasm
 }  // namespace lynx
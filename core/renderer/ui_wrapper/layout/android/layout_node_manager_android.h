@@ -24,6 +24,7 @@ class MeasureFuncAndroid : public MeasureFunc {
   LayoutResult Measure(float width, int32_t width_mode, float height,
                        int32_t height_mode, bool final_measure) override;
   void Alignment() override;
+  uint64_t GetMeasureCacheKey() override;
 
  private:
   base::android::ScopedWeakGlobalJavaRef<jobject> jni_object_;
@@ -16,6 +16,7 @@
 #include "base/include/no_destructor.h"
 #include "base/trace/native/trace_event.h"
 #include "core/base/lynx_trace_categories.h"
+#include "core/base/threading/task_runner_manufactor.h"
 #include "core/build/gen/lynx_sub_error_code.h"
 #include "core/public/layout_node_value.h"
 #include "core/renderer/dom/attribute_holder.h"
@@ -77,7 +78,7 @@ void LayoutContext::SetMeasureFunc(int32_t id,
   if (node == nullptr) {
     return;
   }
-  node->SetMeasureFunc(std::move(measure_func));
+  node->SetMeasureFunc(std::move(measure_func), &measure_cache_);
 }
 
 void LayoutContext::MarkDirtyAndRequestLayout(int32_t id) {
@@ -437,11 +438,9 @@ LayoutNode* LayoutContext::CreateLayoutNode(int32_t id,
                                             const base::String& tag) {
   auto layout_configs = GetLayoutConfigs();
   LayoutNode* layoutNode =
-      &layout_nodes_
-           .emplace(std::piecewise_construct, std::forward_as_tuple(id),
-                    std::forward_as_tuple(id, layout_configs, lynx_env_config_,
-                                          *init_css_style_))
-           .first->second;
+      layout_nodes_
+          .Emplace(id, id, layout_configs, lynx_env_config_, *init_css_style_)
+          .first;
   layoutNode->SetTag(tag);
   if (tag.str() == kListNodeTag) {
     layoutNode->slnode()->MarkList();
@@ -531,7 +530,7 @@ void LayoutContext::DestroyLayoutNode(int32_t id) {
       // to avoid accessing destroyed root node.
       root_ = nullptr;
     }
-    layout_nodes_.erase(id);
+    layout_nodes_.Erase(id);
   }
 }
 int LayoutContext::GetIndexForChild(LayoutNode* parent, LayoutNode* child) {
@@ -631,11 +630,7 @@ void LayoutContext::MarkDirty(int32_t id) {
 }
 
 LayoutNode* LayoutContext::FindNodeById(int32_t id) {
-  auto it = layout_nodes_.find(id);
-  if (it != layout_nodes_.end()) {
-    return &it->second;
-  }
-  return nullptr;
+  return layout_nodes_.Find(id);
 }
 
 void LayoutContext::DispatchLayoutUpdates(const PipelineOptions& options) {
@@ -656,6 +651,31 @@ void LayoutContext::DispatchLayoutUpdates(const PipelineOptions& options) {
   Layout(options);
 }
 
+void LayoutContext::LayoutBoundariesConcurrently() {
+  // Not worth dispatching a single subtree.
+  constexpr size_t kMinBoundaryCount = 2;
+  std::vector<starlight::LayoutObject*> boundaries;
+  root_->slnode()->CollectDirtyLayoutBoundaries(boundaries);
+  if (boundaries.size() < kMinBoundaryCount) {
+    return;
+  }
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, "LayoutContext.LayoutBoundariesConcurrently",
+              [&boundaries](lynx::perfetto::EventContext ctx) {
+                ctx.event()->add_debug_annotations(
+                    "count", std::to_string(boundaries.size()));
+              });
+  is_laying_out_boundaries_concurrently_ = true;
+  base::TaskRunnerManufactor::GetHighPriorityLoop().ParallelFor(
+      boundaries.size(),
+      [&boundaries](size_t index) { boundaries[index]->LayoutAsBoundary(); });
+  is_laying_out_boundaries_concurrently_ = false;
+
+  for (const auto& [type, data] : deferred_layout_events_) {
+    OnLayoutEvent(nullptr, type, data);
+  }
+  deferred_layout_events_.clear();
+}
+
 void LayoutContext::SetEnableLayout() {
   enable_layout_ = true;
   DestroyPlatformNodesIfNeeded();
@@ -683,6 +703,7 @@ void LayoutContext::CheckFixed(LayoutNode* node) {
 
 void LayoutContext::SetFontFaces(const FontFacesMap& fontfaces) {
   platform_impl_->SetFontFaces(fontfaces);
+  measure_cache_.Clear();
 }
 
 void LayoutContext::SetLayoutEarlyExitTiming(const PipelineOptions& options) {
@@ -753,7 +774,13 @@ void LayoutContext::Layout(const PipelineOptions& options) {
   LOGV("[Layout] Computing layout" << view_port_info_str);
   {
     TRACE_EVENT(LYNX_TRACE_CATEGORY_VITALS, "CalculateLayout");
+    if (page_config_ && page_config_->GetEnableParallelLayout()) {
+      LayoutBoundariesConcurrently();
+    }
     root_->CalculateLayout(GetFixedNodeSet());
+    TRACE_EVENT_INSTANT(LYNX_TRACE_CATEGORY, "MeasureCache", "hits",
+                        measure_cache_.GetStats().hits, "misses",
+                        measure_cache_.GetStats().misses);
   }
   LOGV("[Layout] Updating layout result" << view_port_info_str);
   {
@@ -1047,6 +1074,7 @@ void LayoutContext::UpdateViewport(float width, int width_mode, float height,
 
 void LayoutContext::UpdateLynxEnvForLayoutThread(LynxEnvConfig env) {
   lynx_env_config_ = env;
+  measure_cache_.Clear();
 
   if (!root()) {
     return;
@@ -1097,6 +1125,19 @@ void LayoutContext::CircularLayoutDependencyDetector::
 void LayoutContext::OnLayoutEvent(const starlight::LayoutObject* node,
                                   starlight::LayoutEventType type,
                                   const starlight::LayoutEventData& data) {
+  if (is_laying_out_boundaries_concurrently_) {
+    // Trace sections of the workers are not paired on this thread, skip them.
+    if (type == starlight::LayoutEventType::LayoutStyleError ||
+        type == starlight::LayoutEventType::FeatureCountOnGridDisplay ||
+        type == starlight::LayoutEventType::FeatureCountOnRelativeDisplay) {
+      std::lock_guard<std::mutex> lock(deferred_layout_events_mutex_);
+      deferred_layout_events_.emplace_back(
+          type, type == starlight::LayoutEventType::LayoutStyleError
+                    ? static_cast<const starlight::LayoutErrorData&>(data)
+                    : starlight::LayoutErrorData("", ""));
+    }
+    return;
+  }
   switch (type) {
     case starlight::LayoutEventType::UpdateMeasureBegin: {
       TRACE_EVENT_BEGIN(LYNX_TRACE_CATEGORY, "UpdateMeasure");
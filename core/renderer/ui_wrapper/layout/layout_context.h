@@ -7,11 +7,14 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "base/include/closure.h"
+#include "base/include/dense_id_map.h"
 #include "core/public/layout_ctx_platform_impl.h"
 #include "core/public/layout_node_manager.h"
 #include "core/public/pipeline_option.h"
@@ -25,6 +28,7 @@
 #include "core/renderer/starlight/types/layout_constraints.h"
 #include "core/renderer/ui_wrapper/layout/layout_context_data.h"
 #include "core/renderer/ui_wrapper/layout/layout_node.h"
+#include "core/renderer/ui_wrapper/layout/measure_cache.h"
 #include "core/services/timing_handler/timing.h"
 
 namespace lynx {
@@ -187,6 +191,9 @@ class LayoutContext : public std::enable_shared_from_this<LayoutContext>,
     return std::weak_ptr<LayoutCtxPlatformImpl>(platform_impl_);
   }
 
+  // Hit rate of the measure results shared among nodes.
+  const MeasureCache& measure_cache() const { return measure_cache_; }
+
   std::unordered_map<int32_t, LayoutInfoArray> GetSubTreeLayoutInfo(
       int32_t root_id, Viewport viewport = Viewport{});
 #if ENABLE_TESTBENCH_RECORDER
@@ -210,6 +217,9 @@ class LayoutContext : public std::enable_shared_from_this<LayoutContext>,
   // Should be call on the thread that layout engine work on
   void RequestLayout(const PipelineOptions& options = PipelineOptions());
   void DispatchLayoutBeforeRecursively(LayoutNode* node);
+  // Lays out the dirty layout boundaries on the concurrent loop before the
+  // whole tree is laid out, see LayoutObject::CollectDirtyLayoutBoundaries().
+  void LayoutBoundariesConcurrently();
   void LayoutRecursively(LayoutNode* node, const PipelineOptions& options);
   void DestroyPlatformNodesIfNeeded();
   bool SetViewportSizeToRootNode();
@@ -271,7 +281,9 @@ class LayoutContext : public std::enable_shared_from_this<LayoutContext>,
   // Help to record those platform node that have been removed during diff so
   // that we can trigger destroy operation on platform
   std::unordered_set<int> destroyed_platform_nodes_;
-  std::unordered_map<int32_t, LayoutNode> layout_nodes_;
+  // Keyed by element id. LayoutNode is large, so use smaller pages than the
+  // default to limit the memory held by partially used pages.
+  base::DenseIdMap<LayoutNode, 64> layout_nodes_;
   SLNodeSet fixed_node_set_;
   std::unordered_map<base::String, LayoutNodeType> node_type_recorder_;
   // used for copy constructor when LayoutNode init css_style
@@ -288,6 +300,16 @@ class LayoutContext : public std::enable_shared_from_this<LayoutContext>,
 
   RequestLayoutCallback request_layout_callback_;
 
+  MeasureCache measure_cache_;
+
+  // FeatureCounter and ErrorStorage are thread local, so the layout events
+  // sent while laying out boundaries concurrently are deferred and handled on
+  // the layout thread afterwards.
+  bool is_laying_out_boundaries_concurrently_ = false;
+  std::mutex deferred_layout_events_mutex_;
+  std::vector<std::pair<starlight::LayoutEventType, starlight::LayoutErrorData>>
+      deferred_layout_events_;
+
   LayoutContext(const LayoutContext&) = delete;
   LayoutContext& operator=(const LayoutContext&) = delete;
 };
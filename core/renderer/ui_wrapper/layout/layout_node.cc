@@ -280,15 +280,17 @@ void LayoutNode::AlignmentByPlatform(float offset_top, float offset_left) {
   slnode()->AlignmentByPlatform(offset_top, offset_left);
 }
 
-void LayoutNode::SetMeasureFunc(std::unique_ptr<MeasureFunc> measure_func) {
+void LayoutNode::SetMeasureFunc(std::unique_ptr<MeasureFunc> measure_func,
+                                MeasureCache* measure_cache) {
   measure_func_ = std::move(measure_func);
+  measure_cache_ = measure_cache;
 
   sl_node_->SetContext(this);
   sl_node_->SetSLMeasureFunc([](void* context,
                                 const starlight::Constraints& constraints,
                                 bool final_measure) {
-    MeasureFunc* measure = (static_cast<LayoutNode*>(context))->measure_func();
-    DCHECK(measure);
+    LayoutNode* node = static_cast<LayoutNode*>(context);
+    DCHECK(node->measure_func());
     SLMeasureMode width_mode = constraints[starlight::kHorizontal].Mode();
     SLMeasureMode height_mode = constraints[starlight::kVertical].Mode();
     float width = IsSLIndefiniteMode(width_mode)
@@ -299,7 +301,7 @@ void LayoutNode::SetMeasureFunc(std::unique_ptr<MeasureFunc> measure_func) {
                        : constraints[starlight::kVertical].Size();
 
     LayoutResult result =
-        measure->Measure(width, width_mode, height, height_mode, final_measure);
+        node->Measure(width, width_mode, height, height_mode, final_measure);
 
     return FloatSize(result.width_, result.height_, result.baseline_);
   });
@@ -310,6 +312,34 @@ void LayoutNode::SetMeasureFunc(std::unique_ptr<MeasureFunc> measure_func) {
   });
 }
 
+LayoutResult LayoutNode::Measure(float width, int32_t width_mode, float height,
+                                 int32_t height_mode, bool final_measure) {
+  const uint64_t content_key =
+      measure_cache_ ? measure_func_->GetMeasureCacheKey() : 0;
+  if (content_key == 0) {
+    return measure_func_->Measure(width, width_mode, height, height_mode,
+                                  final_measure);
+  }
+  MeasureCacheKey key;
+  key.content_key = content_key;
+  key.font_scale = css_style_->GetFontScale();
+  key.width = width;
+  key.width_mode = width_mode;
+  key.height = height;
+  key.height_mode = height_mode;
+  // Final measures always reach the platform, which keeps the measured layout
+  // for Alignment().
+  if (!final_measure) {
+    if (const LayoutResult* result = measure_cache_->Find(key)) {
+      return *result;
+    }
+  }
+  LayoutResult result = measure_func_->Measure(width, width_mode, height,
+                                               height_mode, final_measure);
+  measure_cache_->Insert(key, result);
+  return result;
+}
+
 ConsumptionStatus LayoutNode::ConsumptionTest(CSSPropertyID id) {
   static int kWantedProperty[kPropertyEnd];
   static bool kIsInit = false;
@@ -16,6 +16,7 @@
 #include "core/renderer/starlight/layout/layout_global.h"
 #include "core/renderer/starlight/layout/layout_object.h"
 #include "core/renderer/starlight/types/layout_measurefunc.h"
+#include "core/renderer/ui_wrapper/layout/measure_cache.h"
 #include "core/renderer/utils/base/base_def.h"
 
 namespace lynx {
@@ -48,7 +49,10 @@ class LayoutNode {
   void CalculateLayoutWithConstraints(
       starlight::Constraints& constraints,
       const SLNodeSet* fixed_node_set = nullptr);
-  void SetMeasureFunc(std::unique_ptr<MeasureFunc> measure_func);
+  // Results of trying measures are shared through |measure_cache| if the
+  // function gives a cache key.
+  void SetMeasureFunc(std::unique_ptr<MeasureFunc> measure_func,
+                      MeasureCache* measure_cache = nullptr);
   void InsertNode(LayoutNode* child, int index = -1);
   LayoutNode* RemoveNodeAtIndex(unsigned int index);
   void MoveNode(LayoutNode* child, int from_index, unsigned int to_index);
@@ -91,6 +95,8 @@ class LayoutNode {
       children_;
   LayoutNode* parent_ = nullptr;
   std::unique_ptr<MeasureFunc> measure_func_;
+  // Owned by LayoutContext.
+  MeasureCache* measure_cache_ = nullptr;
 
   base::String tag_;
   // Whether node is a native list element which needs to invoke
@@ -104,6 +110,8 @@ class LayoutNode {
   LayoutNode(const LayoutNode&) = delete;
   LayoutNode& operator=(const LayoutNode&) = delete;
   void MarkDirtyInternal(bool request_layout);
+  LayoutResult Measure(float width, int32_t width_mode, float height,
+                       int32_t height_mode, bool final_measure);
 };
 
 }  // namespace tasm
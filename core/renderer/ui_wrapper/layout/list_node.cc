@@ -55,17 +55,28 @@ bool ListNode::MyersDiff(
   auto same_kind_cmp = [](const auto& lhs, const auto& rhs) {
     return lhs->CanBeReusedBy(*rhs);
   };
-  if (force_update_all) {
+  auto diff = [this, &old_components, &new_components,
+               &same_kind_cmp](auto same_cmp) {
+    const bool enable_move_detection = NewArch() || EnableMoveOperation();
+    // Items are of the same kind if they have the same item-key, so the keyed
+    // diff applies unless item-keys are duplicated.
+    if (myers_diff::KeyedDiff(
+            enable_move_detection, old_components.begin(),
+            old_components.end(), new_components.begin(),
+            new_components.end(),
+            [](const auto& info) { return info->diff_key_.String(); },
+            same_cmp, platform_info_.update_actions_)) {
+      return;
+    }
     platform_info_.update_actions_ = myers_diff::MyersDiff(
-        (NewArch() || EnableMoveOperation()), old_components.begin(),
-        old_components.end(), new_components.begin(), new_components.end(),
-        same_kind_cmp, [](const auto& lhs, const auto& rhs) { return false; });
+        enable_move_detection, old_components.begin(), old_components.end(),
+        new_components.begin(), new_components.end(), same_kind_cmp,
+        same_cmp);
+  };
+  if (force_update_all) {
+    diff([](const auto& lhs, const auto& rhs) { return false; });
   } else {
-    platform_info_.update_actions_ = myers_diff::MyersDiff(
-        (NewArch() || EnableMoveOperation()), old_components.begin(),
-        old_components.end(), new_components.begin(), new_components.end(),
-        same_kind_cmp,
-        [](const auto& lhs, const auto& rhs) { return *lhs == *rhs; });
+    diff([](const auto& lhs, const auto& rhs) { return *lhs == *rhs; });
   }
   return !platform_info_.update_actions_.Empty();
 }
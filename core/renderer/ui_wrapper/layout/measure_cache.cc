@@ -0,0 +1,37 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/ui_wrapper/layout/measure_cache.h"
+
+#include <functional>
+
+namespace lynx {
+namespace tasm {
+
+namespace {
+
+inline void HashCombine(size_t& seed, size_t value) {
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+}  // namespace
+
+size_t MeasureCacheKeyHash::operator()(const MeasureCacheKey& key) const {
+  size_t seed = std::hash<uint64_t>()(key.content_key);
+  HashCombine(seed, std::hash<float>()(key.font_scale));
+  HashCombine(seed, std::hash<float>()(key.width));
+  HashCombine(seed, std::hash<int32_t>()(key.width_mode));
+  HashCombine(seed, std::hash<float>()(key.height));
+  HashCombine(seed, std::hash<int32_t>()(key.height_mode));
+  return seed;
+}
+
+float MeasureCache::HitRate() const {
+  const auto& stats = cache_.GetStats();
+  const uint64_t total = stats.hits + stats.misses;
+  return total == 0 ? 0.f : static_cast<float>(stats.hits) / total;
+}
+
+}  // namespace tasm
+}  // namespace lynx
@@ -0,0 +1,77 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_RENDERER_UI_WRAPPER_LAYOUT_MEASURE_CACHE_H_
+#define CORE_RENDERER_UI_WRAPPER_LAYOUT_MEASURE_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "base/include/lru_cache.h"
+#include "core/public/layout_node_value.h"
+
+namespace lynx {
+namespace tasm {
+
+struct MeasureCacheKey {
+  // Given by MeasureFunc::GetMeasureCacheKey(), e.g. the hash of the text and
+  // the text attributes.
+  uint64_t content_key = 0;
+  float font_scale = 0;
+  float width = 0;
+  int32_t width_mode = 0;
+  float height = 0;
+  int32_t height_mode = 0;
+
+  bool operator==(const MeasureCacheKey& other) const {
+    return content_key == other.content_key &&
+           font_scale == other.font_scale && width == other.width &&
+           width_mode == other.width_mode && height == other.height &&
+           height_mode == other.height_mode;
+  }
+};
+
+struct MeasureCacheKeyHash {
+  size_t operator()(const MeasureCacheKey& key) const;
+};
+
+// Results of platform measure functions shared by all the layout nodes of a
+// LayoutContext, so that nodes with the same content, e.g. repeated text in a
+// feed, are measured once. Unlike the cache of each LayoutObject, it is not
+// reset when a node is marked dirty or destroyed, which is safe since the
+// content is a part of the key. It is not thread safe, which is fine since
+// nodes with measure functions are never laid out concurrently.
+class MeasureCache {
+ public:
+  static constexpr size_t kDefaultCapacity = 1024;
+
+  explicit MeasureCache(size_t capacity = kDefaultCapacity)
+      : cache_(capacity) {}
+
+  // Returns nullptr if not found.
+  const LayoutResult* Find(const MeasureCacheKey& key) {
+    return cache_.Get(key);
+  }
+  void Insert(const MeasureCacheKey& key, const LayoutResult& result) {
+    cache_.Put(key, result);
+  }
+
+  // Results become stale if fonts or the environment change.
+  void Clear() { cache_.Clear(); }
+
+  size_t Size() const { return cache_.Size(); }
+  const base::LRUCacheStats& GetStats() const { return cache_.GetStats(); }
+  // Returns 0 if nothing has been looked up.
+  float HitRate() const;
+
+ private:
+  base::LRUCache<MeasureCacheKey, LayoutResult,
+                 base::LRUUnitWeigher<LayoutResult>, MeasureCacheKeyHash>
+      cache_;
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_RENDERER_UI_WRAPPER_LAYOUT_MEASURE_CACHE_H_
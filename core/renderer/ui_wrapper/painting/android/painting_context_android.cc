@@ -447,45 +447,47 @@ void PaintingContextAndroid::CreatePaintingNode(
       base::ErrorStorage::GetInstance().AddCustomInfoToError(
           {{"node_index", std::to_string(node_index)}});
     }
-    Enqueue([this, task_ref = std::move(task_ref)]() {
-      TRACE_EVENT(LYNX_TRACE_CATEGORY,
-                  "UIOperationQueue::CreatePaintingNodeTask");
-      if (task_ref.IsNull()) {
-        return;
-      }
-      JNIEnv* env = base::android::AttachCurrentThread();
-      InvokeNativeRunnable(task_ref, env);
-    });
+    Enqueue(shell::UIOperationKind::kCreateNode,
+            [this, task_ref = std::move(task_ref)]() {
+              TRACE_EVENT(LYNX_TRACE_CATEGORY,
+                          "UIOperationQueue::CreatePaintingNodeTask");
+              if (task_ref.IsNull()) {
+                return;
+              }
+              JNIEnv* env = base::android::AttachCurrentThread();
+              InvokeNativeRunnable(task_ref, env);
+            });
     return;
   }
 
   // Sync create
   if (!create_node_async) {
-    Enqueue([this, impl = impl_, id, tag, painting_data, flatten,
+    Enqueue(shell::UIOperationKind::kCreateNode,
+            [this, impl = impl_, id, tag, painting_data, flatten,
              node_index]() mutable {
-      JNIEnv* env = base::android::AttachCurrentThread();
-      base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
-      if (local_ref.IsNull()) {
-        return;
-      }
-      PropBundleAndroid* pda;
-      jobject props_object;
-      jobject listeners_object;
-      jobject gestures_object;
-      std::tie(pda, props_object, listeners_object, gestures_object) =
-          GetArgsForCreatePaintingNode(painting_data);
-      const auto tag_ref =
-          base::android::JNIConvertHelper::ConvertToJNIStringUTF(env,
-                                                                 tag.c_str());
-      Java_PaintingContext_createPaintingNodeSync(
-          env, local_ref.Get(), id, tag_ref.Get(), props_object,
-          pda->GetStyleMapBuffer().Get(), listeners_object, flatten, node_index,
-          gestures_object);
-      if (lynx::base::android::HasJNIException()) {
-        base::ErrorStorage::GetInstance().AddCustomInfoToError(
-            {{"node_index", std::to_string(node_index)}});
-      }
-    });
+              JNIEnv* env = base::android::AttachCurrentThread();
+              base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
+              if (local_ref.IsNull()) {
+                return;
+              }
+              PropBundleAndroid* pda;
+              jobject props_object;
+              jobject listeners_object;
+              jobject gestures_object;
+              std::tie(pda, props_object, listeners_object, gestures_object) =
+                  GetArgsForCreatePaintingNode(painting_data);
+              const auto tag_ref =
+                  base::android::JNIConvertHelper::ConvertToJNIStringUTF(
+                      env, tag.c_str());
+              Java_PaintingContext_createPaintingNodeSync(
+                  env, local_ref.Get(), id, tag_ref.Get(), props_object,
+                  pda->GetStyleMapBuffer().Get(), listeners_object, flatten,
+                  node_index, gestures_object);
+              if (lynx::base::android::HasJNIException()) {
+                base::ErrorStorage::GetInstance().AddCustomInfoToError(
+                    {{"node_index", std::to_string(node_index)}});
+              }
+            });
     return;
   }
 
@@ -535,29 +537,33 @@ void PaintingContextAndroid::CreatePaintingNode(
         base::ConcurrentTaskType::HIGH_PRIORITY);
     scheduled_create_node_async_task_queue_.Push(create_node_async_task);
   }
-  Enqueue([this, task = std::move(create_node_async_task)]() {
-    JNIEnv* env = base::android::AttachCurrentThread();
-    task->Run();
-    // Taking tasks from the LIFO queue iterable container to execute while
-    // waiting for the current task to finish.
-    while (!(task->GetFuture().valid() &&
-             task.get()->GetFuture().wait_for(std::chrono::seconds(0)) ==
-                 std::future_status::ready) &&
-           (!backward_create_node_async_task_iterable_container_.empty() &&
-            backward_create_node_async_task_iterator_ !=
-                backward_create_node_async_task_iterable_container_.end())) {
-      auto back_task = *backward_create_node_async_task_iterator_;
-      back_task->Run();
-      backward_create_node_async_task_iterator_++;
-    }
-
-    if (task->GetFuture().valid()) {
-      auto runnable = task->GetFuture().get();
-      if (!runnable.IsNull()) {
-        InvokeNativeRunnable(runnable, env);
-      }
-    }
-  });
+  Enqueue(shell::UIOperationKind::kCreateNode,
+          [this, task = std::move(create_node_async_task)]() {
+            JNIEnv* env = base::android::AttachCurrentThread();
+            task->Run();
+            // Taking tasks from the LIFO queue iterable container to execute
+            // while waiting for the current task to finish.
+            while (
+                !(task->GetFuture().valid() &&
+                  task.get()->GetFuture().wait_for(std::chrono::seconds(0)) ==
+                      std::future_status::ready) &&
+                (!backward_create_node_async_task_iterable_container_
+                      .empty() &&
+                 backward_create_node_async_task_iterator_ !=
+                     backward_create_node_async_task_iterable_container_
+                         .end())) {
+              auto back_task = *backward_create_node_async_task_iterator_;
+              back_task->Run();
+              backward_create_node_async_task_iterator_++;
+            }
+
+            if (task->GetFuture().valid()) {
+              auto runnable = task->GetFuture().get();
+              if (!runnable.IsNull()) {
+                InvokeNativeRunnable(runnable, env);
+              }
+            }
+          });
 }
 
 void PaintingContextAndroid::SetContextHasAttached() {
@@ -584,18 +590,20 @@ void PaintingContextAndroid::InsertPaintingNode(int parent, int child,
     ui_operation_batch_builder_->putInt(index);
     return;
   }
-  Enqueue([impl = impl_, parent, child, index]() {
-    TRACE_EVENT(LYNX_TRACE_CATEGORY,
-                "UIOperationQueue::InsertPaintingNodeTask");
+  Enqueue(shell::UIOperationKind::kInsertNode,
+          [impl = impl_, parent, child, index]() {
+            TRACE_EVENT(LYNX_TRACE_CATEGORY,
+                        "UIOperationQueue::InsertPaintingNodeTask");
 
-    base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
-    if (local_ref.IsNull()) {
-      return;
-    }
+            base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
+            if (local_ref.IsNull()) {
+              return;
+            }
 
-    JNIEnv* env = base::android::AttachCurrentThread();
-    Java_PaintingContext_insertNode(env, local_ref.Get(), parent, child, index);
-  });
+            JNIEnv* env = base::android::AttachCurrentThread();
+            Java_PaintingContext_insertNode(env, local_ref.Get(), parent, child,
+                                            index);
+          });
 }
 
 void PaintingContextAndroid::RemovePaintingNode(int parent, int child,
@@ -608,18 +616,20 @@ void PaintingContextAndroid::RemovePaintingNode(int parent, int child,
     return;
   }
 
-  Enqueue([impl = impl_, parent, child]() {
-    TRACE_EVENT(LYNX_TRACE_CATEGORY,
-                "UIOperationQueue::RemovePaintingNodeTask");
+  Enqueue(shell::UIOperationKind::kRemoveNode,
+          [impl = impl_, parent, child]() {
+            TRACE_EVENT(LYNX_TRACE_CATEGORY,
+                        "UIOperationQueue::RemovePaintingNodeTask");
 
-    base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
-    if (local_ref.IsNull()) {
-      return;
-    }
+            base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
+            if (local_ref.IsNull()) {
+              return;
+            }
 
-    JNIEnv* env = base::android::AttachCurrentThread();
-    Java_PaintingContext_removeNode(env, local_ref.Get(), parent, child);
-  });
+            JNIEnv* env = base::android::AttachCurrentThread();
+            Java_PaintingContext_removeNode(env, local_ref.Get(), parent,
+                                            child);
+          });
 }
 
 void PaintingContextAndroid::DestroyPaintingNode(int parent, int child,
@@ -631,18 +641,20 @@ void PaintingContextAndroid::DestroyPaintingNode(int parent, int child,
     ui_operation_batch_builder_->putInt(child);
     return;
   }
-  Enqueue([impl = impl_, parent, child]() {
-    TRACE_EVENT(LYNX_TRACE_CATEGORY,
-                "UIOperationQueue::DestroyPaintingNodeTask");
+  Enqueue(shell::UIOperationKind::kDestroyNode,
+          [impl = impl_, parent, child]() {
+            TRACE_EVENT(LYNX_TRACE_CATEGORY,
+                        "UIOperationQueue::DestroyPaintingNodeTask");
 
-    base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
-    if (local_ref.IsNull()) {
-      return;
-    }
+            base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
+            if (local_ref.IsNull()) {
+              return;
+            }
 
-    JNIEnv* env = base::android::AttachCurrentThread();
-    Java_PaintingContext_destroyNode(env, local_ref.Get(), parent, child);
-  });
+            JNIEnv* env = base::android::AttachCurrentThread();
+            Java_PaintingContext_destroyNode(env, local_ref.Get(), parent,
+                                             child);
+          });
 }
 
 void PaintingContextAndroid::UpdateLayout(
@@ -699,23 +711,24 @@ void PaintingContextAndroid::UpdatePaintingNode(
       env, pda->GetStyleMapBuffer().Get());
 
   TRACE_EVENT(LYNX_TRACE_CATEGORY, "Catalyzer.UpdatePaintingNode");
-  Enqueue([impl = impl_, id, tend_to_flatten, props_ref = std::move(props_ref),
+  Enqueue(shell::UIOperationKind::kUpdateProps,
+          [impl = impl_, id, tend_to_flatten, props_ref = std::move(props_ref),
            listeners_ref = std::move(listeners_ref),
            gestures_ref = std::move(gestures_ref),
            styles_ref = std::move(styles_ref)]() {
-    TRACE_EVENT(LYNX_TRACE_CATEGORY,
-                "UIOperationQueue::UpdatePaintingNodeTask");
+            TRACE_EVENT(LYNX_TRACE_CATEGORY,
+                        "UIOperationQueue::UpdatePaintingNodeTask");
 
-    base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
-    if (local_ref.IsNull()) {
-      return;
-    }
+            base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
+            if (local_ref.IsNull()) {
+              return;
+            }
 
-    JNIEnv* env = base::android::AttachCurrentThread();
-    Java_PaintingContext_updateProps(env, local_ref.Get(), id, tend_to_flatten,
-                                     props_ref.Get(), styles_ref.Get(),
-                                     listeners_ref.Get(), gestures_ref.Get());
-  });
+            JNIEnv* env = base::android::AttachCurrentThread();
+            Java_PaintingContext_updateProps(
+                env, local_ref.Get(), id, tend_to_flatten, props_ref.Get(),
+                styles_ref.Get(), listeners_ref.Get(), gestures_ref.Get());
+          });
 }
 
 void PaintingContextAndroid::UpdatePlatformExtraBundle(
@@ -729,19 +742,20 @@ void PaintingContextAndroid::UpdatePlatformExtraBundle(
       env, static_cast<PlatformExtraBundleAndroid*>(bundle)
                ->GetPlatformBundle()
                .Get());
-  Enqueue([impl = impl_, id, java_bundle_ref = std::move(java_bundle_ref)]() {
-    TRACE_EVENT(LYNX_TRACE_CATEGORY,
-                "UIOperationQueue::UpdatePlatformExtraBundleTask");
+  Enqueue(shell::UIOperationKind::kUpdateExtraData,
+          [impl = impl_, id, java_bundle_ref = std::move(java_bundle_ref)]() {
+            TRACE_EVENT(LYNX_TRACE_CATEGORY,
+                        "UIOperationQueue::UpdatePlatformExtraBundleTask");
 
-    base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
-    if (local_ref.IsNull()) {
-      return;
-    }
+            base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
+            if (local_ref.IsNull()) {
+              return;
+            }
 
-    JNIEnv* env = base::android::AttachCurrentThread();
-    Java_PaintingContext_updateExtraData(env, local_ref.Get(), id,
-                                         java_bundle_ref.Get());
-  });
+            JNIEnv* env = base::android::AttachCurrentThread();
+            Java_PaintingContext_updateExtraData(env, local_ref.Get(), id,
+                                                 java_bundle_ref.Get());
+          });
 }
 
 void PaintingContextAndroid::Flush() {
@@ -779,19 +793,20 @@ void PaintingContextAndroid::FinishLayoutOperation(
     ui_operation_batch_builder_->putInt(options.list_comp_id_);
     ui_operation_batch_builder_->putLong(options.operation_id);
   } else {
-    Enqueue([impl = impl_, options = options]() {
-      TRACE_EVENT(LYNX_TRACE_CATEGORY,
-                  "UIOperationQueue::FinishLayoutOperationTask");
-
-      base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
-      if (local_ref.IsNull()) {
-        return;
-      }
-      JNIEnv* env = base::android::AttachCurrentThread();
-      Java_PaintingContext_FinishLayoutOperation(
-          env, local_ref.Get(), options.list_comp_id_, options.operation_id,
-          options.is_first_screen);
-    });
+    Enqueue(shell::UIOperationKind::kFinish,
+            [impl = impl_, options = options]() {
+              TRACE_EVENT(LYNX_TRACE_CATEGORY,
+                          "UIOperationQueue::FinishLayoutOperationTask");
+
+              base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
+              if (local_ref.IsNull()) {
+                return;
+              }
+              JNIEnv* env = base::android::AttachCurrentThread();
+              Java_PaintingContext_FinishLayoutOperation(
+                  env, local_ref.Get(), options.list_comp_id_,
+                  options.operation_id, options.is_first_screen);
+            });
   }
 
   Enqueue([weak_queue = std::weak_ptr<shell::DynamicUIOperationQueue>(queue_),
@@ -839,7 +854,7 @@ void PaintingContextAndroid::FinishTasmOperation(
         static_cast<int32_t>(UIOperationType::kTasmFinish));
     ui_operation_batch_builder_->putLong(options.operation_id);
   } else {
-    Enqueue([impl = impl_, options]() {
+    Enqueue(shell::UIOperationKind::kFinish, [impl = impl_, options]() {
       TRACE_EVENT(LYNX_TRACE_CATEGORY,
                   "UIOperationQueue::FinishTasmOperationTask");
 
@@ -1053,59 +1068,62 @@ void PaintingContextAndroid::UpdateLayoutPatching() {
       return;
     }
 
-    Enqueue([impl = impl_, patching_ids = std::move(patching_ids_),
+    Enqueue(shell::UIOperationKind::kUpdateLayout,
+            [impl = impl_, patching_ids = std::move(patching_ids_),
              patching_ints = std::move(patching_ints_),
              patching_bounds = std::move(patching_bounds_),
              patching_stickies = std::move(patching_stickies_),
              patching_node_index = std::move(patching_node_index_)]() {
-      TRACE_EVENT(LYNX_TRACE_CATEGORY,
-                  "UIOperationQueue::UpdateLayoutPatchingTask");
-
-      base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
-      if (local_ref.IsNull()) {
-        return;
-      }
-
-      JNIEnv* env = base::android::AttachCurrentThread();
-      size_t patching_count = patching_ids.size();
-      base::android::ScopedLocalJavaRef<jintArray> j_ids(
-          env, env->NewIntArray(patching_count));
-      env->SetIntArrayRegion(j_ids.Get(), 0, patching_count, &patching_ids[0]);
-      base::android::ScopedLocalJavaRef<jintArray> j_node_index(
-          env, env->NewIntArray(patching_count));
-      env->SetIntArrayRegion(j_node_index.Get(), 0, patching_count,
-                             &patching_node_index[0]);
-
-      // rect, paddings, margins, bounds, sticky, max_height
-      base::android::ScopedLocalJavaRef<jintArray> j_ints(
-          env, env->NewIntArray(static_cast<int>(IntValueIndex::SIZE) *
-                                patching_count));
-      env->SetIntArrayRegion(
-          j_ints.Get(), 0,
-          static_cast<int>(IntValueIndex::SIZE) * patching_count,
-          &patching_ints[0][0]);
-
-      jfloatArray jni_bounds = nullptr, jni_stickies = nullptr;
-      base::android::ScopedLocalJavaRef<jfloatArray> j_bounds(
-          env, env->NewFloatArray(4 * patching_bounds.size()));
-      if (!patching_bounds.empty()) {
-        env->SetFloatArrayRegion(j_bounds.Get(), 0, 4 * patching_bounds.size(),
-                                 &patching_bounds[0][0]);
-        jni_bounds = j_bounds.Get();
-      }
-      base::android::ScopedLocalJavaRef<jfloatArray> j_stickies(
-          env, env->NewFloatArray(4 * patching_stickies.size()));
-      if (!patching_stickies.empty()) {
-        env->SetFloatArrayRegion(j_stickies.Get(), 0,
-                                 4 * patching_stickies.size(),
-                                 &patching_stickies[0][0]);
-        jni_stickies = j_stickies.Get();
-      }
-
-      Java_PaintingContext_UpdateLayoutPatching(
-          env, local_ref.Get(), j_ids.Get(), j_ints.Get(), jni_bounds,
-          jni_stickies, j_node_index.Get());
-    });
+              TRACE_EVENT(LYNX_TRACE_CATEGORY,
+                          "UIOperationQueue::UpdateLayoutPatchingTask");
+
+              base::android::ScopedLocalJavaRef<jobject> local_ref(*impl);
+              if (local_ref.IsNull()) {
+                return;
+              }
+
+              JNIEnv* env = base::android::AttachCurrentThread();
+              size_t patching_count = patching_ids.size();
+              base::android::ScopedLocalJavaRef<jintArray> j_ids(
+                  env, env->NewIntArray(patching_count));
+              env->SetIntArrayRegion(j_ids.Get(), 0, patching_count,
+                                     &patching_ids[0]);
+              base::android::ScopedLocalJavaRef<jintArray> j_node_index(
+                  env, env->NewIntArray(patching_count));
+              env->SetIntArrayRegion(j_node_index.Get(), 0, patching_count,
+                                     &patching_node_index[0]);
+
+              // rect, paddings, margins, bounds, sticky, max_height
+              base::android::ScopedLocalJavaRef<jintArray> j_ints(
+                  env, env->NewIntArray(static_cast<int>(IntValueIndex::SIZE) *
+                                        patching_count));
+              env->SetIntArrayRegion(
+                  j_ints.Get(), 0,
+                  static_cast<int>(IntValueIndex::SIZE) * patching_count,
+                  &patching_ints[0][0]);
+
+              jfloatArray jni_bounds = nullptr, jni_stickies = nullptr;
+              base::android::ScopedLocalJavaRef<jfloatArray> j_bounds(
+                  env, env->NewFloatArray(4 * patching_bounds.size()));
+              if (!patching_bounds.empty()) {
+                env->SetFloatArrayRegion(j_bounds.Get(), 0,
+                                         4 * patching_bounds.size(),
+                                         &patching_bounds[0][0]);
+                jni_bounds = j_bounds.Get();
+              }
+              base::android::ScopedLocalJavaRef<jfloatArray> j_stickies(
+                  env, env->NewFloatArray(4 * patching_stickies.size()));
+              if (!patching_stickies.empty()) {
+                env->SetFloatArrayRegion(j_stickies.Get(), 0,
+                                         4 * patching_stickies.size(),
+                                         &patching_stickies[0][0]);
+                jni_stickies = j_stickies.Get();
+              }
+
+              Java_PaintingContext_UpdateLayoutPatching(
+                  env, local_ref.Get(), j_ids.Get(), j_ints.Get(), jni_bounds,
+                  jni_stickies, j_node_index.Get());
+            });
   }
 }
 
@@ -1135,8 +1153,14 @@ void PaintingContextAndroid::UpdateNodeReadyPatching(
   }
 }
 
-void PaintingContextAndroid::Enqueue(shell::UIOperation op) {
-  queue_->EnqueueUIOperation(std::move(op));
+template <typename F>
+void PaintingContextAndroid::Enqueue(F&& op) {
+  Enqueue(shell::UIOperationKind::kGeneric, std::forward<F>(op));
+}
+
+template <typename F>
+void PaintingContextAndroid::Enqueue(shell::UIOperationKind kind, F&& op) {
+  queue_->EnqueueUIOperation(kind, std::forward<F>(op));
 }
 
 void PaintingContextAndroid::EnqueueHighPriorityUIOperation(
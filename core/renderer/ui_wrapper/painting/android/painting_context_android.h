@@ -194,7 +194,11 @@ class PaintingContextAndroid : public PaintingCtxPlatformImpl {
     kLayoutFinish = 7,
   };
 
-  void Enqueue(shell::UIOperation op);
+  template <typename F>
+  void Enqueue(F&& op);
+  // Records the kind of the operation in the statistics of the queue.
+  template <typename F>
+  void Enqueue(shell::UIOperationKind kind, F&& op);
   void EnqueueHighPriorityUIOperation(shell::UIOperation op);
   void BeforeFlush();
   void InvokeNativeRunnable(
@@ -131,6 +131,8 @@ class PaintingContextDarwin : public PaintingCtxPlatformImpl {
 
   shell::UIOperation ExecuteOperationSafely(shell::UIOperation op) override;
 
+  bool NeedExecuteOperationSafely() override { return true; }
+
  private:
   __weak LynxUIOwner* uiOwner_;
   bool enable_create_ui_async_{false};
@@ -142,6 +144,9 @@ class PaintingContextDarwin : public PaintingCtxPlatformImpl {
 
   template <typename F>
   void Enqueue(F&& func);
+  // Records the kind of the operation in the statistics of the queue.
+  template <typename F>
+  void Enqueue(shell::UIOperationKind kind, F&& func);
 
   template <typename F>
   void EnqueueHighPriorityUIOperation(F&& func);
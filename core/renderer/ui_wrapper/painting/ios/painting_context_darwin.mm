@@ -312,65 +312,69 @@ void PaintingContextDarwin::CreatePaintingNode(int sign, const std::string& tag,
 
       base::TaskRunnerManufactor::PostTaskToConcurrentLoop([async_task]() { async_task->Run(); },
                                                            base::ConcurrentTaskType::HIGH_PRIORITY);
-      Enqueue([async_task, uiOwner, sign, tagName, props]() {
-        TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::CreatePaintingNodeAsyncTask");
-
-        async_task->Run();
-        LynxUI* ui = async_task->GetFuture().get();
-        ui.view = [ui createView];
-        [uiOwner processUIOnMainThread:ui withSign:sign tagName:tagName props:props];
-      });
+      Enqueue(shell::UIOperationKind::kCreateNode,
+              [async_task, uiOwner, sign, tagName, props]() {
+                TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::CreatePaintingNodeAsyncTask");
+
+                async_task->Run();
+                LynxUI* ui = async_task->GetFuture().get();
+                ui.view = [ui createView];
+                [uiOwner processUIOnMainThread:ui withSign:sign tagName:tagName props:props];
+              });
     } else {
       // Sync create ui if the class does not support async creating.
-      Enqueue([uiOwner, sign, tagName, clazz, state, eventSet = pda->event_set(),
+      Enqueue(shell::UIOperationKind::kCreateNode,
+              [uiOwner, sign, tagName, clazz, state, eventSet = pda->event_set(),
                lepusEventSet = pda->lepus_event_set(), props, node_index,
                gestureDetectorSet = pda->gesture_detector_set()]() {
-        TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::CreatePaintingNodeSyncTask");
+                TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::CreatePaintingNodeSyncTask");
+
+                [uiOwner createUISyncWithSign:sign
+                                      tagName:tagName
+                                        clazz:clazz
+                               supportedState:state
+                                     eventSet:eventSet
+                                lepusEventSet:lepusEventSet
+                                        props:props
+                                    nodeIndex:node_index
+                           gestureDetectorSet:gestureDetectorSet];
+              });
+    }
+    return;
+  }
+
+  Enqueue(shell::UIOperationKind::kCreateNode,
+          [uiOwner, sign, tagName, eventSet = pda->event_set(),
+           lepusEventSet = pda->lepus_event_set(), props, node_index,
+           gestureDetectorSet = pda->gesture_detector_set()]() {
+            TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::CreatePaintingNodeTask");
 
-        [uiOwner createUISyncWithSign:sign
+            [uiOwner createUIWithSign:sign
                               tagName:tagName
-                                clazz:clazz
-                       supportedState:state
                              eventSet:eventSet
                         lepusEventSet:lepusEventSet
                                 props:props
                             nodeIndex:node_index
                    gestureDetectorSet:gestureDetectorSet];
-      });
-    }
-    return;
-  }
-
-  Enqueue([uiOwner, sign, tagName, eventSet = pda->event_set(),
-           lepusEventSet = pda->lepus_event_set(), props, node_index,
-           gestureDetectorSet = pda->gesture_detector_set()]() {
-    TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::CreatePaintingNodeTask");
-
-    [uiOwner createUIWithSign:sign
-                      tagName:tagName
-                     eventSet:eventSet
-                lepusEventSet:lepusEventSet
-                        props:props
-                    nodeIndex:node_index
-           gestureDetectorSet:gestureDetectorSet];
-  });
+          });
 }
 
 void PaintingContextDarwin::UpdatePaintingNode(int id, bool tend_to_flatten,
                                                const std::shared_ptr<PropBundle>& painting_data) {
   PropBundleDarwin* pda = static_cast<PropBundleDarwin*>(painting_data.get());
   __weak LynxUIOwner* uiOwner = uiOwner_;
-  Enqueue([uiOwner, id, props = pda->dictionary(), eventSet = pda->event_set(),
+  Enqueue(shell::UIOperationKind::kUpdateProps,
+          [uiOwner, id, props = pda->dictionary(), eventSet = pda->event_set(),
            lepusEventSet = pda->lepus_event_set(),
            gestureDetectorSet = pda->gesture_detector_set()]() {
-    TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::UpdatePaintingNodeTask");
+            TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::UpdatePaintingNodeTask");
 
-    [uiOwner updateUIWithSign:id
-                        props:props
-                     eventSet:eventSet
-                lepusEventSet:lepusEventSet
-           gestureDetectorSet:gestureDetectorSet];
-  });
+            [uiOwner updateUIWithSign:id
+                                props:props
+                             eventSet:eventSet
+                        lepusEventSet:lepusEventSet
+                   gestureDetectorSet:gestureDetectorSet];
+          });
 }
 
 void PaintingContextDarwin::UpdateLayout(int sign, float x, float y, float width, float height,
@@ -389,20 +393,21 @@ void PaintingContextDarwin::UpdateLayout(int sign, float x, float y, float width
     }
   }
   __weak LynxUIOwner* uiOwner = uiOwner_;
-  Enqueue([uiOwner, sign, x, y, width, height, padding = UI_EDGE_INSETS(paddings),
+  Enqueue(shell::UIOperationKind::kUpdateLayout,
+          [uiOwner, sign, x, y, width, height, padding = UI_EDGE_INSETS(paddings),
            border = UI_EDGE_INSETS(borders), margin = UI_EDGE_INSETS(margins), stickyArr]() {
-    TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::UpdateLayoutTask");
-
-    [uiOwner updateUI:sign
-           layoutLeft:x
-                  top:y
-                width:width
-               height:height
-              padding:padding
-               border:border
-               margin:margin
-               sticky:stickyArr];
-  });
+            TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::UpdateLayoutTask");
+
+            [uiOwner updateUI:sign
+                   layoutLeft:x
+                          top:y
+                        width:width
+                       height:height
+                      padding:padding
+                       border:border
+                       margin:margin
+                       sticky:stickyArr];
+          });
 #undef UI_EDGE_INSETS
 }
 
@@ -629,29 +634,33 @@ void PaintingContextDarwin::UpdatePlatformExtraBundle(int32_t signature,
 
   auto platform_bundle = static_cast<PlatformExtraBundleDarwin*>(bundle);
   __weak LynxUIOwner* uiOwner = uiOwner_;
-  Enqueue([uiOwner, signature, value = platform_bundle->PlatformBundle()]() {
-    TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::UpdatePlatformExtraBundleTask");
+  Enqueue(shell::UIOperationKind::kUpdateExtraData,
+          [uiOwner, signature, value = platform_bundle->PlatformBundle()]() {
+            TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::UpdatePlatformExtraBundleTask");
 
-    [uiOwner onReceiveUIOperation:value onUI:signature];
-  });
+            [uiOwner onReceiveUIOperation:value onUI:signature];
+          });
 }
 
 void PaintingContextDarwin::FinishLayoutOperation(const PipelineOptions& options) {
   is_layout_finish_ = true;
   __weak LynxUIOwner* uiOwner = uiOwner_;
-  Enqueue([uiOwner, weak_queue = std::weak_ptr<shell::DynamicUIOperationQueue>(queue_), options]() {
-    TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::FinishLayoutOperationTask");
-
-    if (auto queue = weak_queue.lock()) {
-      [uiOwner finishLayoutOperation:options.operation_id componentID:options.list_comp_id_];
-      if (options.has_layout) {
-        [uiOwner layoutDidFinish];
-      }
-      if (options.native_update_data_order_ == queue->GetNativeUpdateDataOrder()) {
-        queue->UpdateStatus(shell::UIOperationStatus::ALL_FINISH);
-      }
-    }
-  });
+  Enqueue(shell::UIOperationKind::kFinish,
+          [uiOwner, weak_queue = std::weak_ptr<shell::DynamicUIOperationQueue>(queue_),
+           options]() {
+            TRACE_EVENT(LYNX_TRACE_CATEGORY, "UIOperationQueue::FinishLayoutOperationTask");
+
+            if (auto queue = weak_queue.lock()) {
+              [uiOwner finishLayoutOperation:options.operation_id
+                                 componentID:options.list_comp_id_];
+              if (options.has_layout) {
+                [uiOwner layoutDidFinish];
+              }
+              if (options.native_update_data_order_ == queue->GetNativeUpdateDataOrder()) {
+                queue->UpdateStatus(shell::UIOperationStatus::ALL_FINISH);
+              }
+            }
+          });
   if (options.native_update_data_order_ == queue_->GetNativeUpdateDataOrder()) {
     queue_->UpdateStatus(shell::UIOperationStatus::LAYOUT_FINISH);
   }
@@ -674,7 +683,12 @@ void PaintingContextDarwin::ForceFlush() { queue_->ForceFlush(); }
 
 template <typename F>
 void PaintingContextDarwin::Enqueue(F&& func) {
-  queue_->EnqueueUIOperation([func = std::move(func)]() {
+  Enqueue(shell::UIOperationKind::kGeneric, std::forward<F>(func));
+}
+
+template <typename F>
+void PaintingContextDarwin::Enqueue(shell::UIOperationKind kind, F&& func) {
+  queue_->EnqueueUIOperation(kind, [func = std::move(func)]() {
     @autoreleasepool {
       ExecuteSafely(func);
     }
@@ -32,9 +32,11 @@ void PaintingContext::InsertPaintingNode(int parent, int child, int index) {
   if (platform_impl_->HasEnableUIOperationBatching()) {
     platform_impl_->InsertPaintingNode(parent, child, index);
   } else {
-    Enqueue(
-        [platform_ref = platform_impl_->GetPlatformRef(), parent, child,
-         index]() { platform_ref->InsertPaintingNode(parent, child, index); });
+    Enqueue(shell::UIOperationKind::kInsertNode,
+            [platform_ref = platform_impl_->GetPlatformRef(), parent, child,
+             index]() {
+              platform_ref->InsertPaintingNode(parent, child, index);
+            });
   }
 }
 
@@ -52,10 +54,11 @@ void PaintingContext::RemovePaintingNode(int parent, int child, int index,
   if (platform_impl_->HasEnableUIOperationBatching()) {
     platform_impl_->RemovePaintingNode(parent, child, index, is_move);
   } else {
-    Enqueue([platform_ref = platform_impl_->GetPlatformRef(), parent, child,
+    Enqueue(shell::UIOperationKind::kRemoveNode,
+            [platform_ref = platform_impl_->GetPlatformRef(), parent, child,
              index, is_move]() {
-      platform_ref->RemovePaintingNode(parent, child, index, is_move);
-    });
+              platform_ref->RemovePaintingNode(parent, child, index, is_move);
+            });
   }
 
   if (!is_move) {
@@ -69,9 +72,11 @@ void PaintingContext::DestroyPaintingNode(int parent, int child, int index) {
   if (platform_impl_->HasEnableUIOperationBatching()) {
     platform_impl_->DestroyPaintingNode(parent, child, index);
   } else {
-    Enqueue(
-        [platform_ref = platform_impl_->GetPlatformRef(), parent, child,
-         index]() { platform_ref->DestroyPaintingNode(parent, child, index); });
+    Enqueue(shell::UIOperationKind::kDestroyNode,
+            [platform_ref = platform_impl_->GetPlatformRef(), parent, child,
+             index]() {
+              platform_ref->DestroyPaintingNode(parent, child, index);
+            });
   }
 }
 
@@ -80,12 +85,13 @@ void PaintingContext::UpdateNodeReadyPatching() {
     platform_impl_->UpdateNodeReadyPatching(patching_node_ready_ids_,
                                             patching_node_remove_ids_);
   } else {
-    Enqueue([platform_ref = platform_impl_->GetPlatformRef(),
+    Enqueue(shell::UIOperationKind::kPatching,
+            [platform_ref = platform_impl_->GetPlatformRef(),
              ready_ids = patching_node_ready_ids_,
              remove_ids = patching_node_remove_ids_]() {
-      platform_ref->UpdateNodeReadyPatching(std::move(ready_ids),
-                                            std::move(remove_ids));
-    });
+              platform_ref->UpdateNodeReadyPatching(std::move(ready_ids),
+                                                    std::move(remove_ids));
+            });
   }
 
   patching_node_ready_ids_.clear();
@@ -105,65 +111,74 @@ void PaintingContext::UpdateNodeReloadPatching() {
 
 void PaintingContext::OnCollectExtraUpdates(int32_t id) {
   // Remove this funciton later.
-  Enqueue([platform_ref = platform_impl_->GetPlatformRef(), id]() {
-    platform_ref->OnCollectExtraUpdates(id);
-  });
+  Enqueue(shell::UIOperationKind::kUpdateExtraData,
+          [platform_ref = platform_impl_->GetPlatformRef(), id]() {
+            platform_ref->OnCollectExtraUpdates(id);
+          });
 }
 
 void PaintingContext::UpdateScrollInfo(int32_t container_id, bool smooth,
                                        float estimated_offset, bool scrolling) {
-  Enqueue([platform_ref = platform_impl_->GetPlatformRef(), container_id,
+  Enqueue(shell::UIOperationKind::kGeneric,
+          [platform_ref = platform_impl_->GetPlatformRef(), container_id,
            smooth, estimated_offset, scrolling]() mutable {
-    platform_ref->UpdateScrollInfo(container_id, smooth, estimated_offset,
-                                   scrolling);
-  });
+            platform_ref->UpdateScrollInfo(container_id, smooth,
+                                           estimated_offset, scrolling);
+          });
 }
 
 void PaintingContext::SetGestureDetectorState(int64_t id, int32_t gesture_id,
                                               int32_t state) {
-  Enqueue([platform_ref = platform_impl_->GetPlatformRef(), id, gesture_id,
+  Enqueue(shell::UIOperationKind::kGeneric,
+          [platform_ref = platform_impl_->GetPlatformRef(), id, gesture_id,
            state]() mutable {
-    platform_ref->SetGestureDetectorState(id, gesture_id, state);
-  });
+            platform_ref->SetGestureDetectorState(id, gesture_id, state);
+          });
 }
 
 void PaintingContext::UpdateEventInfo(bool has_touch_pseudo) {
   Enqueue(
+      shell::UIOperationKind::kGeneric,
       [platform_ref = platform_impl_->GetPlatformRef(), has_touch_pseudo]() {
         platform_ref->UpdateEventInfo(has_touch_pseudo);
       });
 }
 
 void PaintingContext::UpdateFlattenStatus(int id, bool flatten) {
-  Enqueue([platform_ref = platform_impl_->GetPlatformRef(), id, flatten]() {
-    platform_ref->UpdateFlattenStatus(id, flatten);
-  });
+  Enqueue(shell::UIOperationKind::kUpdateProps,
+          [platform_ref = platform_impl_->GetPlatformRef(), id, flatten]() {
+            platform_ref->UpdateFlattenStatus(id, flatten);
+          });
 }
 
 void PaintingContext::ListReusePaintingNode(int id,
                                             const base::String& item_key) {
-  Enqueue([platform_ref = platform_impl_->GetPlatformRef(), id, item_key]() {
-    platform_ref->ListReusePaintingNode(id, item_key.str());
-  });
+  Enqueue(shell::UIOperationKind::kList,
+          [platform_ref = platform_impl_->GetPlatformRef(), id, item_key]() {
+            platform_ref->ListReusePaintingNode(id, item_key.str());
+          });
 }
 
 void PaintingContext::ListCellWillAppear(int id, const base::String& item_key) {
-  Enqueue([platform_ref = platform_impl_->GetPlatformRef(), id, item_key]() {
-    platform_ref->ListCellWillAppear(id, item_key.str());
-  });
+  Enqueue(shell::UIOperationKind::kList,
+          [platform_ref = platform_impl_->GetPlatformRef(), id, item_key]() {
+            platform_ref->ListCellWillAppear(id, item_key.str());
+          });
 }
 
 void PaintingContext::ListCellDisappear(int id, bool isExist,
                                         const base::String& item_key) {
-  Enqueue([platform_ref = platform_impl_->GetPlatformRef(), id, isExist,
+  Enqueue(shell::UIOperationKind::kList,
+          [platform_ref = platform_impl_->GetPlatformRef(), id, isExist,
            item_key]() {
-    platform_ref->ListCellDisappear(id, isExist, item_key.str());
-  });
+            platform_ref->ListCellDisappear(id, isExist, item_key.str());
+          });
 }
 
 void PaintingContext::InsertListItemPaintingNode(int32_t list_id,
                                                  int32_t child_id) {
   Enqueue(
+      shell::UIOperationKind::kList,
       [platform_ref = platform_impl_->GetPlatformRef(), list_id, child_id]() {
         platform_ref->InsertListItemPaintingNode(list_id, child_id);
       });
@@ -172,6 +187,7 @@ void PaintingContext::InsertListItemPaintingNode(int32_t list_id,
 void PaintingContext::RemoveListItemPaintingNode(int32_t list_id,
                                                  int32_t child_id) {
   Enqueue(
+      shell::UIOperationKind::kList,
       [platform_ref = platform_impl_->GetPlatformRef(), list_id, child_id]() {
         platform_ref->RemoveListItemPaintingNode(list_id, child_id);
       });
@@ -180,25 +196,23 @@ void PaintingContext::RemoveListItemPaintingNode(int32_t list_id,
 void PaintingContext::UpdateContentOffsetForListContainer(
     int32_t container_id, float content_size, float delta_x, float delta_y,
     bool is_init_scroll_offset) {
-  Enqueue([platform_ref = platform_impl_->GetPlatformRef(), container_id,
+  Enqueue(shell::UIOperationKind::kList,
+          [platform_ref = platform_impl_->GetPlatformRef(), container_id,
            content_size, delta_x, delta_y, is_init_scroll_offset] {
-    platform_ref->UpdateContentOffsetForListContainer(
-        container_id, content_size, delta_x, delta_y, is_init_scroll_offset);
-  });
+            platform_ref->UpdateContentOffsetForListContainer(
+                container_id, content_size, delta_x, delta_y,
+                is_init_scroll_offset);
+          });
 }
 
-void PaintingContext::Enqueue(shell::UIOperation op, bool high_priority) {
+void PaintingContext::EnqueueHighPriorityUIOperation(shell::UIOperation op) {
   if (!platform_impl_->EnableUIOperationQueue() || !ui_operation_queue_) {
     op();
     return;
   }
 
-  auto task = platform_impl_->ExecuteOperationSafely(std::move(op));
-  if (high_priority) {
-    ui_operation_queue_->EnqueueHighPriorityUIOperation(std::move(task));
-  } else {
-    ui_operation_queue_->EnqueueUIOperation(std::move(task));
-  }
+  ui_operation_queue_->EnqueueHighPriorityUIOperation(
+      platform_impl_->ExecuteOperationSafely(std::move(op)));
 }
 
 void PaintingContext::MarkUIOperationQueueFlushTiming(
@@ -210,6 +224,7 @@ void PaintingContext::MarkUIOperationQueueFlushTiming(
   std::weak_ptr<shell::TimingCollectorPlatform> weak_timing_collector_platform =
       timing_collector_platform_;
   Enqueue(
+      shell::UIOperationKind::kGeneric,
       [weak_timing_collector_platform, key = std::move(key), pipeline_id]() {
         TRACE_EVENT(LYNX_TRACE_CATEGORY,
                     "UIOperationQueue::MarkUIOperationQueueFlushTimingTask");
@@ -228,11 +243,12 @@ void PaintingContext::SetNeedMarkDrawEndTiming(
 
   std::weak_ptr<shell::TimingCollectorPlatform> weak_timing_collector =
       timing_collector_platform_;
-  Enqueue([platform_ref = platform_impl_->GetPlatformRef(),
+  Enqueue(shell::UIOperationKind::kGeneric,
+          [platform_ref = platform_impl_->GetPlatformRef(),
            weak_timing_collector, pipeline_id]() {
-    platform_ref->SetNeedMarkDrawEndTiming(std::move(weak_timing_collector),
-                                           pipeline_id);
-  });
+            platform_ref->SetNeedMarkDrawEndTiming(
+                std::move(weak_timing_collector), pipeline_id);
+          });
 }
 
 void PaintingContext::MarkLayoutUIOperationQueueFlushStartIfNeed() {
@@ -221,10 +221,20 @@ class PaintingContext {
   void SetContextHasAttached();
 
  private:
-  void Enqueue(shell::UIOperation op, bool high_priority = false);
-  void EnqueueHighPriorityUIOperation(shell::UIOperation op) {
-    Enqueue(std::move(op), true);
+  template <typename F>
+  void Enqueue(shell::UIOperationKind kind, F&& op) {
+    if (!platform_impl_->EnableUIOperationQueue() || !ui_operation_queue_) {
+      op();
+      return;
+    }
+    if (platform_impl_->NeedExecuteOperationSafely()) {
+      ui_operation_queue_->EnqueueUIOperation(
+          kind, platform_impl_->ExecuteOperationSafely(std::forward<F>(op)));
+      return;
+    }
+    ui_operation_queue_->EnqueueUIOperation(kind, std::forward<F>(op));
   }
+  void EnqueueHighPriorityUIOperation(shell::UIOperation op);
 
   std::unique_ptr<PaintingCtxPlatformImpl> platform_impl_;
 
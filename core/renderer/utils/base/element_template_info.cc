@@ -0,0 +1,76 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/utils/base/element_template_info.h"
+
+namespace lynx {
+namespace tasm {
+
+ElementTemplatePrototype::ElementTemplatePrototype(
+    const std::vector<ElementInfo>& elements) {
+  nodes_.reserve(CountElements(elements));
+  for (const auto& info : elements) {
+    Flatten(info);
+  }
+}
+
+size_t ElementTemplatePrototype::CountElements(
+    const std::vector<ElementInfo>& elements) const {
+  size_t count = elements.size();
+  for (const auto& info : elements) {
+    count += CountElements(info.children_);
+  }
+  return count;
+}
+
+void ElementTemplatePrototype::Flatten(const ElementInfo& info) {
+  const size_t index = nodes_.size();
+  Node& node = nodes_.emplace_back();
+  node.tag_enum = info.tag_enum_;
+  node.tag = info.tag_;
+  node.id_selector = info.id_selector_;
+
+  node.classes.begin = static_cast<uint32_t>(classes_.size());
+  classes_.insert(classes_.end(), info.class_selector_.begin(),
+                  info.class_selector_.end());
+  node.classes.end = static_cast<uint32_t>(classes_.size());
+
+  node.inline_styles.begin = static_cast<uint32_t>(inline_styles_.size());
+  for (const auto& [id, style] : info.inline_styles_) {
+    inline_styles_.emplace_back(id, lepus::Value(style));
+  }
+  node.inline_styles.end = static_cast<uint32_t>(inline_styles_.size());
+
+  node.events.begin = static_cast<uint32_t>(events_.size());
+  events_.insert(events_.end(), info.events_.begin(), info.events_.end());
+  node.events.end = static_cast<uint32_t>(events_.size());
+
+  node.attrs.begin = static_cast<uint32_t>(attrs_.size());
+  attrs_.insert(attrs_.end(), info.attrs_.begin(), info.attrs_.end());
+  node.attrs.end = static_cast<uint32_t>(attrs_.size());
+
+  node.builtin_attrs.begin = static_cast<uint32_t>(builtin_attrs_.size());
+  builtin_attrs_.insert(builtin_attrs_.end(), info.builtin_attrs_.begin(),
+                        info.builtin_attrs_.end());
+  node.builtin_attrs.end = static_cast<uint32_t>(builtin_attrs_.size());
+
+  node.data_set = info.data_set_;
+  if (info.has_parser_style_) {
+    node.parsed_styles = info.parsed_styles_;
+  }
+  node.config = info.config_;
+  node.component_name = info.component_name_;
+  node.component_path = info.component_path_;
+  node.component_id = info.component_id_;
+  node.css_id = info.css_id_;
+
+  // Indexed again since the reference may be invalidated by the children.
+  for (const auto& child : info.children_) {
+    Flatten(child);
+  }
+  nodes_[index].subtree_size = static_cast<uint32_t>(nodes_.size() - index);
+}
+
+}  // namespace tasm
+}  // namespace lynx
@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "core/renderer/css/css_property.h"
@@ -81,6 +82,76 @@ struct ElementInfo {
   int32_t css_id_{kInvalidCssId};
 };
 
+// The immutable and flat representation of an element template, which is
+// built once after the template is decoded. The elements are stored in
+// pre-order, and their classes, inline styles, events and attributes are
+// stored contiguously and referred by index ranges, so that the template can
+// be instantiated in a single linear pass for each use, e.g. the components
+// reused in lists.
+class ElementTemplatePrototype {
+ public:
+  struct Range {
+    uint32_t begin{0};
+    uint32_t end{0};
+  };
+
+  struct Node {
+    ElementBuiltInTagEnum tag_enum{ElementBuiltInTagEnum::ELEMENT_OTHER};
+    base::String tag;
+    base::String id_selector;
+    // The count of the elements in the subtree, including itself.
+    uint32_t subtree_size{1};
+    Range classes;
+    Range inline_styles;
+    Range events;
+    Range attrs;
+    Range builtin_attrs;
+    lepus::Value data_set{};
+    // Null if the element has no parsed style.
+    std::shared_ptr<ParsedStyles> parsed_styles{};
+    lepus::Value config{};
+    base::String component_name;
+    base::String component_path;
+    base::String component_id;
+    int32_t css_id{kInvalidCssId};
+  };
+
+  explicit ElementTemplatePrototype(const std::vector<ElementInfo>& elements);
+
+  ElementTemplatePrototype(const ElementTemplatePrototype&) = delete;
+  ElementTemplatePrototype& operator=(const ElementTemplatePrototype&) =
+      delete;
+
+  const std::vector<Node>& nodes() const { return nodes_; }
+  const std::vector<base::String>& classes() const { return classes_; }
+  const std::vector<std::pair<CSSPropertyID, lepus::Value>>& inline_styles()
+      const {
+    return inline_styles_;
+  }
+  const std::vector<ElementEventInfo>& events() const { return events_; }
+  const std::vector<std::pair<base::String, lepus::Value>>& attrs() const {
+    return attrs_;
+  }
+  const std::vector<std::pair<ElementBuiltInAttributeEnum, lepus::Value>>&
+  builtin_attrs() const {
+    return builtin_attrs_;
+  }
+
+ private:
+  size_t CountElements(const std::vector<ElementInfo>& elements) const;
+  void Flatten(const ElementInfo& info);
+
+  std::vector<Node> nodes_;
+  std::vector<base::String> classes_;
+  // The styles are converted to lepus values once here instead of on each
+  // instantiation.
+  std::vector<std::pair<CSSPropertyID, lepus::Value>> inline_styles_;
+  std::vector<ElementEventInfo> events_;
+  std::vector<std::pair<base::String, lepus::Value>> attrs_;
+  std::vector<std::pair<ElementBuiltInAttributeEnum, lepus::Value>>
+      builtin_attrs_;
+};
+
 struct ElementTemplateInfo {
   // Make ElementTemplateInfo move only
   ElementTemplateInfo() = default;
@@ -91,7 +162,12 @@ struct ElementTemplateInfo {
 
   bool exist_{false};
   std::string key_;
+  // Empty once the prototype is built.
   std::vector<ElementInfo> elements_;
+  // Built by the decoder after the elements are decoded, which then releases
+  // the elements. Null for the templates constructed by hand, which are
+  // instantiated from the elements.
+  std::shared_ptr<const ElementTemplatePrototype> prototype_{};
 };
 
 }  // namespace tasm
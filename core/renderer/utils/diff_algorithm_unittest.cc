@@ -239,7 +239,7 @@ auto testLists(const std::vector<Component>& list_old,
   return testListsImpl(list_old, list_new,
                        [](auto&&... args) {
                          return lynx::tasm::myers_diff::MyersDiff(
-                             std::forward<decltype(args)>(args)...);
+                             true, std::forward<decltype(args)>(args)...);
                        }) &&
          testListsImpl(
              list_old, list_new,
@@ -260,7 +260,7 @@ auto testRandomLists(size_t max_name_len, size_t pool_size,
   auto lists = genLists(max_name_len, pool_size, list_estimate_size);
   return testListsImpl(lists.first, lists.second, [](auto&&... args) {
     return lynx::tasm::myers_diff::MyersDiff(
-        std::forward<decltype(args)>(args)...);
+        true, std::forward<decltype(args)>(args)...);
   });
 }
 
@@ -270,7 +270,7 @@ auto testRandomListsTime(size_t max_name_len, size_t pool_size,
   return testListsImpl(lists.first, lists.second, [&lists](auto&&... args) {
     auto start_time = std::chrono::high_resolution_clock::now();
     auto res = lynx::tasm::myers_diff::MyersDiff(
-        std::forward<decltype(args)>(args)...);
+        true, std::forward<decltype(args)>(args)...);
     auto stop_time = std::chrono::high_resolution_clock::now();
     auto duration = stop_time - start_time;
     std::cout << "[          ] from list " << lists.first.size() << ", to list "
@@ -380,6 +380,116 @@ TEST(DiffAlgorithmTest, MyersDiffRandomTestTime) {
   ASSERT_TRUE(res);
 }
 
+auto keyedDiffer(bool enable_move_detection) {
+  return [enable_move_detection](auto first1, auto last1, auto first2,
+                                 auto last2, auto cmp1, auto cmp2) {
+    auto diff_result = lynx::tasm::myers_diff::DiffResult{};
+    EXPECT_TRUE(lynx::tasm::myers_diff::KeyedDiff(
+        enable_move_detection, first1, last1, first2, last2,
+        [](const Component& component) { return component.name_; }, cmp2,
+        diff_result));
+    return diff_result;
+  };
+}
+
+// Lists of unique names, the new one is made by removing, inserting, moving
+// and updating items of the old one.
+std::pair<std::vector<Component>, std::vector<Component>> genKeyedLists(
+    size_t size) {
+  randomGenerator random_generator{};
+  auto list_old = std::vector<Component>{};
+  for (size_t i = 0; i < size; ++i) {
+    list_old.push_back(Component{"old" + std::to_string(i), 0});
+  }
+  auto list_new = std::vector<Component>{};
+  for (const auto& component : list_old) {
+    if (!random_generator.Bool(10)) {
+      list_new.push_back(component);
+    }
+    if (random_generator.Bool(10)) {
+      list_new.push_back(
+          Component{"new" + std::to_string(list_new.size()), 0});
+    }
+  }
+  for (auto& component : list_new) {
+    if (random_generator.Bool(10)) {
+      component.data_ = 1;
+    }
+    if (random_generator.Bool(10)) {
+      std::swap(component,
+                list_new[random_generator.Num(list_new.size())]);
+    }
+  }
+  return {list_old, list_new};
+}
+
+TEST(DiffAlgorithmTest, KeyedDiffTest) {
+  const auto list_old = std::vector<Component>{
+      {"A", 0}, {"B", 0}, {"C", 0}, {"D", 0}, {"E", 0}, {"F", 0}};
+  const auto list_new = std::vector<Component>{
+      {"A", 1}, {"C", 1}, {"D", 0}, {"G", 0}, {"B", 0}, {"F", 1}};
+  auto diff_result = lynx::tasm::myers_diff::DiffResult{};
+  ASSERT_TRUE(lynx::tasm::myers_diff::KeyedDiff(
+      true, list_old.begin(), list_old.end(), list_new.begin(),
+      list_new.end(),
+      [](const Component& component) { return component.name_; },
+      std::equal_to<Component>{}, diff_result));
+  // A and F are leading and trailing items, C and D stay in place, B is moved.
+  EXPECT_EQ(diff_result.removals_, (lynx::tasm::myers_diff::IndexVector{4}));
+  EXPECT_EQ(diff_result.insertions_,
+            (lynx::tasm::myers_diff::IndexVector{3}));
+  EXPECT_EQ(diff_result.update_from_,
+            (lynx::tasm::myers_diff::IndexVector{0, 2, 5}));
+  EXPECT_EQ(diff_result.update_to_,
+            (lynx::tasm::myers_diff::IndexVector{0, 1, 5}));
+  EXPECT_EQ(diff_result.move_from_, (lynx::tasm::myers_diff::IndexVector{1}));
+  EXPECT_EQ(diff_result.move_to_, (lynx::tasm::myers_diff::IndexVector{4}));
+
+  ASSERT_TRUE(testListsImpl(list_old, list_new, keyedDiffer(true)));
+  ASSERT_TRUE(testListsImpl(list_old, list_new, keyedDiffer(false)));
+}
+
+TEST(DiffAlgorithmTest, KeyedDiffDuplicateKeyTest) {
+  auto key = [](const Component& component) { return component.name_; };
+  auto diff_result = lynx::tasm::myers_diff::DiffResult{};
+  {
+    const auto list_old =
+        std::vector<Component>{{"A", 0}, {"B", 0}, {"C", 0}};
+    const auto list_new =
+        std::vector<Component>{{"B", 0}, {"B", 0}, {"D", 0}};
+    ASSERT_FALSE(lynx::tasm::myers_diff::KeyedDiff(
+        true, list_old.begin(), list_old.end(), list_new.begin(),
+        list_new.end(), key, std::equal_to<Component>{}, diff_result));
+  }
+  {
+    const auto list_old =
+        std::vector<Component>{{"B", 0}, {"B", 0}, {"C", 0}};
+    const auto list_new =
+        std::vector<Component>{{"A", 0}, {"B", 0}, {"D", 0}};
+    ASSERT_FALSE(lynx::tasm::myers_diff::KeyedDiff(
+        true, list_old.begin(), list_old.end(), list_new.begin(),
+        list_new.end(), key, std::equal_to<Component>{}, diff_result));
+  }
+  // Duplicated keys matched as leading or trailing items are fine.
+  {
+    const auto list_old =
+        std::vector<Component>{{"A", 0}, {"A", 0}, {"B", 0}, {"A", 0}};
+    const auto list_new =
+        std::vector<Component>{{"A", 0}, {"A", 1}, {"C", 0}, {"A", 0}};
+    ASSERT_TRUE(testListsImpl(list_old, list_new, keyedDiffer(true)));
+  }
+}
+
+TEST(DiffAlgorithmTest, KeyedDiffRandomTest) {
+  auto res = true;
+  for (int i = 0; i < 10; ++i) {
+    auto lists = genKeyedLists(1000);
+    res &= testListsImpl(lists.first, lists.second, keyedDiffer(true));
+    res &= testListsImpl(lists.first, lists.second, keyedDiffer(false));
+  }
+  ASSERT_TRUE(res);
+}
+
 }  // namespace
 }  // namespace base
 }  // namespace lynx
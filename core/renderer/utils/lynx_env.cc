@@ -376,5 +376,9 @@ bool LynxEnv::EnableNativeCreateViewAsync() {
 bool LynxEnv::EnableSignalAPI() {
   return GetBoolEnv(Key::ENABLE_SIGNAL_API, false);
 }
+
+bool LynxEnv::EnableParallelSectionDecode() {
+  return GetBoolEnv(Key::ENABLE_PARALLEL_SECTION_DECODE, false);
+}
 }  // namespace tasm
 }  // namespace lynx
@@ -83,6 +83,7 @@ class BASE_EXPORT_FOR_DEVTOOL LynxEnv {
     ENABLE_FIBER_ELEMENT_FOR_RADON_DIFF,
     ENABLE_NATIVE_CREATE_VIEW_ASYNC,
     ENABLE_SIGNAL_API,
+    ENABLE_PARALLEL_SECTION_DECODE,
     // Please add new enum values above
     END_MARK,  // Keep this as the last enum value, and do not use
   };
@@ -171,6 +172,8 @@ class BASE_EXPORT_FOR_DEVTOOL LynxEnv {
             {Key::ENABLE_NATIVE_CREATE_VIEW_ASYNC,
              "enable_native_create_view_async"},
             {Key::ENABLE_SIGNAL_API, "enable_signal_api"},
+            {Key::ENABLE_PARALLEL_SECTION_DECODE,
+             "enable_parallel_section_decode"},
         });
     auto it = (*env_key_to_string_map).find(key);
     DCHECK(it != (*env_key_to_string_map).end());
@@ -271,6 +274,7 @@ class BASE_EXPORT_FOR_DEVTOOL LynxEnv {
   bool EnableUseContextPool();
   bool EnableNativeCreateViewAsync();
   bool EnableSignalAPI();
+  bool EnableParallelSectionDecode();
 
   LynxEnv(const LynxEnv&) = delete;
   LynxEnv& operator=(const LynxEnv&) = delete;
@@ -17,11 +17,17 @@ bool CheckTableValueNotEqual(const lepus::Value& target_item_value,
     return true;
   }
 
+  // Tables and arrays may be modified in place, unless they are const and
+  // shared by the two values.
   switch (update_item_value.Type()) {
-    case lepus::Value_Table:
-      return true;
-    case lepus::Value_Array:
-      return true;
+    case lepus::Value_Table: {
+      auto table = update_item_value.Table();
+      return !(table->IsConst() && table == target_item_value.Table());
+    }
+    case lepus::Value_Array: {
+      auto array = update_item_value.Array();
+      return !(array->IsConst() && array == target_item_value.Array());
+    }
     default:
       return update_item_value != target_item_value;
   }
@@ -39,6 +45,11 @@ bool CheckTableDeepUpdated(const lepus::Value& target,
     auto update_table_value = update.Table();
     // component current data table
     auto target_table_value = target.Table();
+    // a const table shared by both is not updated;
+    if (update_table_value == target_table_value &&
+        update_table_value->IsConst()) {
+      return false;
+    }
     // if two tables' size are different, need update;
     if (update_table_value->size() != target_table_value->size() &&
         !first_layer) {
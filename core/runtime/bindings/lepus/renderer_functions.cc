@@ -1098,11 +1098,11 @@ RENDERER_FUNCTION_CC(ReplaceStyleSheetByIdWithBase64) {
 
   // CSSStyleSheetManager hold by this reader is never shared
   // so we can manipulate it without lock
-  auto fragment_handle = reader.template_bundle()
-                             .GetCSSStyleManager()
-                             ->GetCSSFragmentMap()
-                             ->extract(id);
-  if (fragment_handle.empty()) {
+  auto fragment = reader.template_bundle()
+                      .GetCSSStyleManager()
+                      ->GetCSSFragmentMap()
+                      ->Extract(id);
+  if (!fragment.has_value()) {
     RenderFatal(LEPUS_CONTEXT(),
                 "css fragment with specific id is not provided by this buffer");
     RETURN_UNDEFINED();
@@ -1110,7 +1110,7 @@ RENDERER_FUNCTION_CC(ReplaceStyleSheetByIdWithBase64) {
 
   ModifyStyleSheetByIdHelper(self, entry_name,
                              static_cast<int32_t>(arg0->Number()),
-                             std::move(fragment_handle.mapped()));
+                             std::move(*fragment));
 
   RETURN_UNDEFINED();
 }
@@ -48,6 +48,7 @@ namespace piper {
 namespace cache {
 
 static constexpr size_t MAX_SIZE = 50 * 1024 * 1024;  // 50MB
+static constexpr size_t MAX_MEMORY_CACHE_SIZE = 8 * 1024 * 1024;  // 8MB
 
 constexpr char METADATA_FILE_NAME[] = "meta.json";
 constexpr auto MIN_ACCESS_TIME_UPDATE_INTERVAL = std::chrono::hours(24);
@@ -63,7 +64,8 @@ JsCacheManager &JsCacheManager::GetV8Instance() noexcept {
   return *instance;
 }
 
-JsCacheManager::JsCacheManager(JSRuntimeType type) : engine_type_(type) {}
+JsCacheManager::JsCacheManager(JSRuntimeType type)
+    : engine_type_(type), cache_(MAX_MEMORY_CACHE_SIZE) {}
 
 bool JsCacheManager::ReadFile(const std::string &filename,
                               std::string &contents) {
@@ -208,17 +210,16 @@ std::shared_ptr<Buffer> JsCacheManager::TryGetCache(
   std::scoped_lock<std::mutex> lock(cache_lock_);
 
   // try to load cache from memory
-  if (runtime::IsKernelJs(source_url) && !cache_.empty()) {
-    auto cache_it = cache_.find(source_url);
-    if (cache_it != cache_.end()) {
-      LOGI("cache loaded from memory, size: " << cache_it->second->size()
+  if (runtime::IsKernelJs(source_url) && !cache_.Empty()) {
+    auto *cache = cache_.Get(source_url);
+    if (cache != nullptr) {
+      LOGI("cache loaded from memory, size: " << (*cache)->size()
                                               << " bytes");
       JsCacheTracker::OnGetBytecode(
           runtime_id, engine_type_, source_url, true, true, true,
           JsCacheType::MEMORY, JsCacheErrorCode::NO_ERROR,
-          base::CurrentTimeMilliseconds() - cost_start,
-          cache_it->second->size());
-      return cache_it->second;
+          base::CurrentTimeMilliseconds() - cost_start, (*cache)->size());
+      return *cache;
     }
   }
 
@@ -11,7 +11,6 @@
 #include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_map>
 #include <utility>
 
 #ifdef QUICKJS_CACHE_UNITTEST
@@ -24,6 +23,7 @@
 #endif
 
 #include "base/include/closure.h"
+#include "base/include/lru_cache.h"
 #include "core/runtime/jscache/cache_generator.h"
 #include "core/runtime/jscache/js_cache_tracker.h"
 #include "core/runtime/jscache/meta_data.h"
@@ -243,9 +243,16 @@ UNITTEST_PUBLIC:
    */
   void SaveCacheToMemory(const std::string &source_url,
                          std::shared_ptr<Buffer> cache) {
-    cache_[source_url] = std::move(cache);
+    cache_.Put(source_url, std::move(cache));
   }
 
+  // Weighs caches in memory by their size in bytes.
+  struct BufferWeigher {
+    size_t operator()(const std::shared_ptr<Buffer> &cache) const {
+      return cache ? cache->size() : 0;
+    }
+  };
+
   bool IsCacheEnabledForTemplate(const std::string &source_url);
 
   JsFileIdentifier BuildIdentifier(const std::string &source_url,
@@ -261,7 +268,9 @@ UNITTEST_PUBLIC:
   std::list<TaskInfo> task_list_;
   std::mutex task_lock_;  // lock for task_list_
   bool background_thread_working_ = false;
-  std::unordered_map<std::string, std::shared_ptr<Buffer>> cache_;
+  // Caches of kernel js in memory, evicted when their total size exceeds
+  // MAX_MEMORY_CACHE_SIZE.
+  base::LRUCache<std::string, std::shared_ptr<Buffer>, BufferWeigher> cache_;
   std::mutex cache_lock_;
   std::unique_ptr<MetaData> meta_data_;
   std::string cache_path_;
@@ -168,6 +168,9 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public lepus::RefCounted {
   ~CArray() override = default;
 
   friend bool operator==(const CArray& left, const CArray& right) {
+    if (&left == &right) {
+      return true;
+    }
     return left.vec_ == right.vec_ &&
            left.is_regexp_match_result_ == right.is_regexp_match_result_;
   }
@@ -43,6 +43,9 @@ bool BaseBinaryReader::DeserializeFunction(fml::RefPtr<Function>& parent,
     instruction.op_code_ = static_cast<long>(op_code);
     function->AddInstruction(instruction);
   }
+#if ENABLE_LEPUS_THREADED_DISPATCH
+  function->FuseSuperInstructions();
+#endif
 
   // up value info
   DECODE_COMPACT_U32(update_value_size);
@@ -4,6 +4,15 @@
 
 #include "core/runtime/vm/lepus/binary_input_stream.h"
 
+#if OS_WIN
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace lynx {
 namespace lepus {
 
@@ -27,6 +36,65 @@ bool ByteArrayInputStream::ReadFromFile(const char* file) {
   return false;
 }
 
+std::unique_ptr<InputStream> InputStream::DeriveSubInputStream(size_t offset,
+                                                              size_t length) {
+  if (offset > size() || length > size() - offset) {
+    return std::make_unique<ByteArrayInputStream>(std::vector<uint8_t>{});
+  }
+  return std::make_unique<ByteArrayInputStream>(begin() + offset,
+                                                static_cast<int>(length));
+}
+
+std::unique_ptr<InputStream> MappedInputStream::DeriveSubInputStream(
+    size_t offset, size_t length) {
+  if (offset > size_ || length > size_ - offset) {
+    return std::make_unique<MappedInputStream>(nullptr);
+  }
+  return std::make_unique<MappedInputStream>(
+      buf_, begin_ - buf_->data + offset, length);
+}
+
+std::shared_ptr<MappedBuffer> MappedBuffer::MapFile(const char* filename) {
+#if OS_WIN
+  // No mapping on windows, fallback to read the whole file.
+  std::ifstream file(filename, std::ios::binary | std::ios::ate);
+  if (!file.is_open()) {
+    return nullptr;
+  }
+  std::streamsize size = file.tellg();
+  if (size <= 0) {
+    return nullptr;
+  }
+  auto data = std::make_shared<std::vector<uint8_t>>(size);
+  file.seekg(0, std::ios::beg);
+  if (!file.read(reinterpret_cast<char*>(data->data()), size)) {
+    return nullptr;
+  }
+  const uint8_t* ptr = data->data();
+  return Borrow(ptr, static_cast<size_t>(size), std::move(data));
+#else
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+  size_t size = static_cast<size_t>(st.st_size);
+  void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps its own reference to the file.
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return nullptr;
+  }
+  std::shared_ptr<void> owner(addr,
+                              [size](void* addr) { munmap(addr, size); });
+  return Borrow(static_cast<const uint8_t*>(addr), size, std::move(owner));
+#endif
+}
+
 size_t InputStream::ReadCompactU32(uint32_t* out_value) {
   if (!CheckSize(1)) {
     return 0;
@@ -97,6 +97,12 @@ class InputStream {
 
   virtual std::unique_ptr<InputStream> DeriveInputStream() = 0;
 
+  // Derive a stream which only covers [offset, offset + length) of this
+  // stream. The default implementation copies the range, streams backed by
+  // shared memory override it to share the underlying bytes.
+  virtual std::unique_ptr<InputStream> DeriveSubInputStream(size_t offset,
+                                                            size_t length);
+
  protected:
   size_t offset_;
 };
@@ -147,6 +153,64 @@ class ByteArrayInputStream : public InputStream {
   std::shared_ptr<InputBuffer> buf_;
 };
 
+// Read-only bytes which are not owned by the stream, e.g. a read-only file
+// mapping or a buffer owned by the platform layer. `owner` keeps the memory
+// alive as long as any stream derived from this buffer is alive.
+struct MappedBuffer {
+  MappedBuffer(const uint8_t* data, size_t size, std::shared_ptr<void> owner)
+      : data(data), size(size), owner(std::move(owner)) {}
+
+  // Map the whole file read-only. Returns nullptr if the file can not be
+  // opened, is empty or can not be mapped.
+  static std::shared_ptr<MappedBuffer> MapFile(const char* filename);
+
+  // Borrow the memory [data, data + size). The caller must guarantee that the
+  // memory stays valid and unchanged until `owner` is released.
+  static std::shared_ptr<MappedBuffer> Borrow(const uint8_t* data, size_t size,
+                                              std::shared_ptr<void> owner) {
+    return std::make_shared<MappedBuffer>(data, size, std::move(owner));
+  }
+
+  const uint8_t* const data;
+  const size_t size;
+  const std::shared_ptr<void> owner;
+};
+
+// InputStream which decodes directly from a MappedBuffer without copying it.
+// Derived streams share the same buffer.
+class MappedInputStream : public InputStream {
+ public:
+  explicit MappedInputStream(std::shared_ptr<MappedBuffer> buf)
+      : MappedInputStream(buf, 0, buf ? buf->size : 0) {}
+
+  MappedInputStream(std::shared_ptr<MappedBuffer> buf, size_t offset,
+                    size_t length)
+      : buf_(std::move(buf)),
+        begin_(buf_ ? const_cast<uint8_t*>(buf_->data) + offset : nullptr),
+        size_(begin_ ? length : 0) {}
+
+  MappedInputStream(const MappedInputStream& rhs) = delete;
+  MappedInputStream& operator=(const MappedInputStream& rhs) = delete;
+
+  // The mapping is read-only, the returned pointers must not be written.
+  virtual uint8_t* begin() override { return begin_; }
+  virtual uint8_t* end() override { return begin_ + size_; }
+  virtual size_t size() override { return size_; }
+
+  std::unique_ptr<InputStream> DeriveInputStream() override {
+    return std::make_unique<MappedInputStream>(
+        buf_, begin_ ? begin_ - buf_->data : 0, size_);
+  }
+
+  std::unique_ptr<InputStream> DeriveSubInputStream(size_t offset,
+                                                    size_t length) override;
+
+ private:
+  std::shared_ptr<MappedBuffer> buf_;
+  uint8_t* begin_;
+  size_t size_;
+};
+
 }  // namespace lepus
 }  // namespace lynx
 
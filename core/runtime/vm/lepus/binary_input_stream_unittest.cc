@@ -196,6 +196,58 @@ TEST_F(ByteArrayInputStreamTest, TestDeriveInputStream) {
             stream->buf_);
 }
 
+TEST_F(ByteArrayInputStreamTest, TestDeriveSubInputStream) {
+  std::string str = "test string";
+
+  auto stream = std::make_unique<ByteArrayInputStream>(
+      reinterpret_cast<const uint8_t*>(str.data()), str.size());
+
+  auto sub_stream = stream->DeriveSubInputStream(5, 3);
+  std::string target_str;
+  EXPECT_EQ(sub_stream->size(), 3);
+  EXPECT_TRUE(sub_stream->ReadString(target_str, 3));
+  EXPECT_EQ(target_str, "str");
+  EXPECT_FALSE(sub_stream->CheckSize(1));
+
+  EXPECT_EQ(stream->DeriveSubInputStream(5, 100)->size(), 0);
+}
+
+TEST_F(ByteArrayInputStreamTest, TestMappedInputStream) {
+  std::string str = "test string";
+  auto owner = std::make_shared<std::string>(str);
+  auto buf = MappedBuffer::Borrow(
+      reinterpret_cast<const uint8_t*>(owner->data()), owner->size(), owner);
+  std::weak_ptr<std::string> weak_owner = owner;
+  owner.reset();
+
+  auto stream = std::make_unique<MappedInputStream>(buf);
+  buf.reset();
+  EXPECT_EQ(stream->size(), str.size());
+  EXPECT_EQ(*stream->cursor(), 't');
+
+  // No copy, the stream reads from the borrowed memory.
+  EXPECT_EQ(stream->begin(),
+            reinterpret_cast<const uint8_t*>(weak_owner.lock()->data()));
+
+  auto sub_stream = stream->DeriveSubInputStream(5, 6);
+  EXPECT_EQ(sub_stream->begin(), stream->begin() + 5);
+  stream.reset();
+
+  // The derived stream keeps the memory alive.
+  EXPECT_FALSE(weak_owner.expired());
+  std::string target_str;
+  EXPECT_TRUE(sub_stream->ReadString(target_str, 6));
+  EXPECT_EQ(target_str, "string");
+  EXPECT_FALSE(sub_stream->CheckSize(1));
+
+  sub_stream.reset();
+  EXPECT_TRUE(weak_owner.expired());
+}
+
+TEST_F(ByteArrayInputStreamTest, TestMappedBufferMapFile) {
+  EXPECT_EQ(MappedBuffer::MapFile("/path/not/exist"), nullptr);
+}
+
 }  // namespace test
 }  // namespace lepus
 }  // namespace lynx
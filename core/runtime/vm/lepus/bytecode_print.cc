@@ -25,9 +25,29 @@ void Dumper::DumpFunction() {
     std::cout << "######## BEGIN #########: "
               << ", function name:" << func_ptr->GetFunctionName() << std::endl;
     func_ptr->DumpScope();
+    const PropertyCache* caches = func_ptr->GetPropertyCaches();
+    uint64_t total_hits = 0;
+    uint64_t total_misses = 0;
     for (size_t i = 0; i < func_ptr->OpCodeSize(); i++) {
       ins = func_ptr->GetInstruction(i);
       PrintOpCode(*ins, func_ptr, i);
+      if (caches == nullptr) {
+        continue;
+      }
+      uint32_t hits = caches[i].hits.load(std::memory_order_relaxed);
+      uint32_t misses = caches[i].misses.load(std::memory_order_relaxed);
+      if (hits + misses > 0) {
+        std::cout << "    property cache hits: " << hits
+                  << ", misses: " << misses << std::endl;
+        total_hits += hits;
+        total_misses += misses;
+      }
+    }
+    if (total_hits + total_misses > 0) {
+      std::cout << "property cache hit rate: "
+                << total_hits * 100.0 / (total_hits + total_misses) << "% ("
+                << total_hits << "/" << total_hits + total_misses << ")"
+                << std::endl;
     }
     std::cout << "######## END #########" << std::endl;
   }
@@ -324,6 +344,18 @@ void Dumper::PrintOpCode(Instruction i, Function* func_ptr, int index) {
     case TypeOp_Noop:
       PrintDetail("Noop", 0, offsets, id);
       break;
+    case TypeOp_LoadConstCall:
+      offsets[0] = Instruction::GetParamA(i);
+      offsets[1] = Instruction::GetParamBx(i);
+      id[1] = Constant;
+      PrintDetail("LoadConstCall", 2, offsets, id);
+      break;
+    case TypeOp_LoadConstGetTable:
+      offsets[0] = Instruction::GetParamA(i);
+      offsets[1] = Instruction::GetParamBx(i);
+      id[1] = Constant;
+      PrintDetail("LoadConstGetTable", 2, offsets, id);
+      break;
     default:
       break;
   }
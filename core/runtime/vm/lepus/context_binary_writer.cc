@@ -139,7 +139,8 @@ void ContextBinaryWriter::SerializeFunction(fml::RefPtr<Function> function) {
   WriteCompactU32(size);
 
   for (size_t i = 0; i < size; ++i) {
-    WriteCompactU64((uint64_t)function->op_codes_[i].op_code_);
+    WriteCompactU64(
+        (uint64_t)Instruction::Unfused(function->op_codes_[i]).op_code_);
   }
 
   func_vec.push_back(function);
@@ -259,6 +259,104 @@ TEST_F(ContextBinaryReaderTest, LynxBinaryReaderLepus) {
   }
 }
 
+TEST_F(ContextBinaryReaderTest, LynxBinaryReaderLepusSuperInstructions) {
+  std::string src = R"(
+    let obj = {a: {b: {c: 1}}};
+    function add(x, y) { return x + y; }
+    let sum = 0;
+    for (let i = 0; i < 10; i++) {
+      sum = add(sum, obj.a.b.c) + add(0, 0);
+    }
+    Assert(sum == 10);
+  )";
+  auto vm_ctx = lepus::VMContext();
+  TestUtils::RegisterBuiltin(&vm_ctx);
+  lepus::BytecodeGenerator::GenerateBytecode(&vm_ctx, src, target_sdk_version);
+  auto binary_writer = ContextBinaryWriterTest(&vm_ctx);
+  binary_writer.encode();
+  auto byte_array =
+      const_cast<lepus::OutputStream*>(binary_writer.stream())->byte_array();
+
+  auto binary_reader = LynxBinaryReaderTest(
+      std::make_unique<lepus::ByteArrayInputStream>(std::move(byte_array)),
+      false);
+  ASSERT_TRUE(binary_reader.DecodeContextTest());
+  std::shared_ptr<lepus::Context> decode_ctx =
+      std::make_shared<lepus::VMContext>();
+  auto entry = TemplateEntry(decode_ctx, target_sdk_version);
+  TestUtils::RegisterBuiltin(decode_ctx.get());
+  ASSERT_TRUE(decode_ctx->DeSerialize(
+      *binary_reader.GetTemplateBundle().context_bundle_, true, nullptr));
+
+  // Fused instructions are the same as the encoded ones once unfused.
+  auto origin = vm_ctx.GetRootFunction();
+  auto decoded =
+      static_cast<lepus::VMContext*>(decode_ctx.get())->GetRootFunction();
+  ASSERT_EQ(origin->op_codes_.size(), decoded->op_codes_.size());
+  size_t fused_count = 0;
+  for (size_t i = 0; i < origin->op_codes_.size(); ++i) {
+    auto instruction = decoded->op_codes_[i];
+    if (lepus::Instruction::GetOpCode(instruction) !=
+        lepus::Instruction::GetOpCode(
+            lepus::Instruction::Unfused(instruction))) {
+      ++fused_count;
+    }
+    EXPECT_EQ(origin->op_codes_[i].op_code_,
+              lepus::Instruction::Unfused(instruction).op_code_);
+  }
+#if ENABLE_LEPUS_THREADED_DISPATCH
+  EXPECT_GT(fused_count, 0u);
+#else
+  EXPECT_EQ(fused_count, 0u);
+#endif
+  ASSERT_TRUE(decode_ctx->Execute());
+}
+
+TEST_F(ContextBinaryReaderTest, LepusPropertyCache) {
+  std::string src = R"(
+    let sum = 0;
+    for (let i = 0; i < 100; i++) {
+      let item = {title: i, index: 1};
+      item.index = item.index + 1;
+      sum = sum + item.title + item.index;
+    }
+    Assert(sum == 5150);
+    // Tables with other layouts miss the cache but get the right values.
+    let items = [{a: 1, b: 2}, {b: 3, a: 4}, {c: 5, a: 6, b: 7}, {b: 8}];
+    let result = 0;
+    for (let i = 0; i < 4; i++) {
+      result = result * 10 + items[i].b;
+      items[i].b = 0;
+      Assert(items[i].b == 0);
+    }
+    Assert(result == 2378);
+  )";
+  auto vm_ctx = lepus::VMContext();
+  TestUtils::RegisterBuiltin(&vm_ctx);
+  lepus::BytecodeGenerator::GenerateBytecode(&vm_ctx, src, target_sdk_version);
+  ASSERT_TRUE(vm_ctx.Execute());
+
+  auto function = vm_ctx.GetRootFunction();
+  const lepus::PropertyCache* caches = function->GetPropertyCaches();
+  ASSERT_NE(caches, nullptr);
+  size_t cached_slots = 0;
+  for (size_t i = 0; i < function->OpCodeSize(); ++i) {
+    if (caches[i].Slot() != lepus::PropertyCache::kNoSlot) {
+      ++cached_slots;
+    }
+  }
+  EXPECT_GT(cached_slots, 0u);
+#ifdef LEPUS_TEST
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  for (size_t i = 0; i < function->OpCodeSize(); ++i) {
+    hits += caches[i].hits;
+    misses += caches[i].misses;
+  }
+  EXPECT_GT(hits, misses);
+#endif
+}
+
 TEST_F(ContextBinaryReaderTest, LynxBinaryReaderLepusNG) {
   auto all_test_file = TestUtils::GetTestFileLists(
       "core/runtime/vm/lepus/compiler/lepusng_unit_test");
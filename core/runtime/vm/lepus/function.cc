@@ -41,6 +41,39 @@ std::size_t Function::AddConstValue(const Value& v) {
   return const_values_.size() - 1;
 }
 
+Function::~Function() {
+  delete[] property_caches_.load(std::memory_order_relaxed);
+}
+
+PropertyCache* Function::AllocatePropertyCaches() {
+  PropertyCache* caches = new PropertyCache[op_codes_.size()];
+  PropertyCache* expected = nullptr;
+  if (!property_caches_.compare_exchange_strong(expected, caches,
+                                                std::memory_order_acq_rel)) {
+    // Allocated by another thread.
+    delete[] caches;
+    return expected;
+  }
+  return caches;
+}
+
+void Function::FuseSuperInstructions() {
+  // Property keys and the last constant argument of calls are loaded right
+  // before TypeOp_GetTable and TypeOp_Call by CodeGenerator.
+  for (size_t index = 0; index + 1 < op_codes_.size(); ++index) {
+    auto op_code = Instruction::GetOpCode(op_codes_[index]);
+    auto next_op_code = Instruction::GetOpCode(op_codes_[index + 1]);
+    if (op_code != TypeOp_LoadConst) {
+      continue;
+    }
+    if (next_op_code == TypeOp_Call) {
+      op_codes_[index].RefillsOpCode(TypeOp_LoadConstCall);
+    } else if (next_op_code == TypeOp_GetTable) {
+      op_codes_[index].RefillsOpCode(TypeOp_LoadConstGetTable);
+    }
+  }
+}
+
 void Function::DecodeLineCol(uint64_t line_col, int32_t& line, int32_t& col) {
   // line_col: bits[Function::kLineBitsShift-0]: col number
   // bits[63-Function::kLineBitsShift]: line number
@@ -4,6 +4,7 @@
 #ifndef CORE_RUNTIME_VM_LEPUS_FUNCTION_H_
 #define CORE_RUNTIME_VM_LEPUS_FUNCTION_H_
 
+#include <atomic>
 #include <memory>
 #include <stack>
 #include <string>
@@ -54,6 +55,43 @@ struct pair_hash {
   }
 };
 
+// Inline cache of a TypeOp_GetTable or TypeOp_SetTable instruction. It keeps
+// the slot where the key was found last time, see base::StringFlatMap. Tables
+// created by the same code keep their keys in the same slots, so accessing
+// the same property of every item of a list usually hits.
+//
+// Functions may be shared by contexts on different threads, so the fields are
+// relaxed atomics. A stale slot only causes a miss. The hit and miss counters
+// are only statistics for Dumper, so they are kept in LEPUS_TEST builds only
+// and may lose increments.
+struct PropertyCache {
+  static constexpr uint32_t kNoSlot = static_cast<uint32_t>(-1);
+
+  std::atomic<uint32_t> slot{kNoSlot};
+#ifdef LEPUS_TEST
+  std::atomic<uint32_t> hits{0};
+  std::atomic<uint32_t> misses{0};
+#endif
+
+  size_t Slot() const { return slot.load(std::memory_order_relaxed); }
+  void Update(size_t new_slot) {
+    slot.store(static_cast<uint32_t>(new_slot), std::memory_order_relaxed);
+  }
+#ifdef LEPUS_TEST
+  void RecordHit() { Increase(hits); }
+  void RecordMiss() { Increase(misses); }
+
+ private:
+  static void Increase(std::atomic<uint32_t>& counter) {
+    counter.store(counter.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
+  }
+#else
+  void RecordHit() {}
+  void RecordMiss() {}
+#endif
+};
+
 class Function : public fml::RefCountedThreadSafeStorage {
  public:
   constexpr static const char kFuncName[] = "__func_name__";
@@ -78,7 +116,7 @@ class Function : public fml::RefCountedThreadSafeStorage {
   static fml::RefPtr<Function> Create() {
     return fml::AdoptRef<Function>(new Function());
   }
-  ~Function() override = default;
+  ~Function() override;
 
   void SetParamsSize(int32_t params_size) { params_size_ = params_size; }
 
@@ -100,6 +138,26 @@ class Function : public fml::RefCountedThreadSafeStorage {
 
   Instruction* GetInstruction(std::size_t index) { return &op_codes_[index]; }
 
+  // Replaces hot pairs of instructions with super instructions, see
+  // op_code.h. Only for decoded functions which will not be encoded again.
+  void FuseSuperInstructions();
+
+  // Returns the inline cache of the instruction at pc. Caches of a function
+  // are allocated when it first accesses a property, no instruction should be
+  // added after that.
+  PropertyCache& GetPropertyCache(std::size_t pc) {
+    PropertyCache* caches = property_caches_.load(std::memory_order_acquire);
+    if (caches == nullptr) {
+      caches = AllocatePropertyCaches();
+    }
+    return caches[pc];
+  }
+
+  // Returns nullptr if no property is accessed yet.
+  const PropertyCache* GetPropertyCaches() const {
+    return property_caches_.load(std::memory_order_acquire);
+  }
+
   std::size_t AddConstNumber(double number);
 
   std::size_t AddConstString(const base::String& string);
@@ -233,8 +291,12 @@ class Function : public fml::RefCountedThreadSafeStorage {
   Function() = default;
 
  private:
+  PropertyCache* AllocatePropertyCaches();
+
   std::vector<Instruction> op_codes_;
 
+  std::atomic<PropertyCache*> property_caches_{nullptr};
+
   base::InlineVector<Value, 8> const_values_;
 
   base::InlineVector<UpvalueInfo, 4> upvalues_;
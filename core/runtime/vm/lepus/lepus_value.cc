@@ -732,11 +732,8 @@ void Value::MergeValue(lepus::Value& target, const lepus::Value& update) {
     } else if (result.size() > 1) {
       if (target_table != nullptr) {
         auto front_value = result.begin();
+        // UpdateValueByPath() copies old_value on write if it is const.
         lepus_value old_value = target_table->GetValue(*front_value);
-        if ((old_value.IsTable() && old_value.Table()->IsConst()) ||
-            (old_value.IsArray() && old_value.Array()->IsConst())) {
-          old_value = lepus_value::Clone(old_value);
-        }
         result.erase(front_value);
         UpdateValueByPath(old_value, it->second, result);
         target_table->SetValue(*front_value, old_value);
@@ -760,14 +757,32 @@ bool Value::UpdateValueByPath(lepus::Value& target, const lepus::Value& update,
    *         |    |    |    |
    *        get  get  get  set
    */
+  if (target.IsConstTableOrArray()) {
+    target = ShallowCopy(target);
+  }
   auto current = target;
   std::for_each(path.begin(), path.end() - 1, [&current](const auto& key) {
     auto next = current.GetPropertyFromTableOrArray(key);
+    if (next.IsConstTableOrArray()) {
+      next = ShallowCopy(next);
+      current.SetPropertyToTableOrArray(key, next);
+    }
     std::swap(current, next);
   });
   return current.SetPropertyToTableOrArray(path.back(), update);
 }
 
+bool Value::IsConstTableOrArray() const {
+  switch (type_) {
+    case Value_Table:
+      return val_table_ != nullptr && val_table_->IsConst();
+    case Value_Array:
+      return val_carray_ != nullptr && val_carray_->IsConst();
+    default:
+      return false;
+  }
+}
+
 Value Value::GetPropertyFromTableOrArray(const std::string& key) const {
   if (IsTable() || IsJSTable()) {
     return GetProperty(key);
@@ -983,9 +998,11 @@ bool operator==(const Value& left, const Value& right) {
     case Value_RefCounted:
       return left.RefCounted() == right.RefCounted();
     case Value_Table:
-      return *(left.Table().get()) == *(right.Table().get());
+      return left.val_table_ == right.val_table_ ||
+             *left.val_table_ == *right.val_table_;
     case Value_Array:
-      return *(left.Array().get()) == *(right.Array().get());
+      return left.val_carray_ == right.val_carray_ ||
+             *left.val_carray_ == *right.val_carray_;
 #if !ENABLE_JUST_LEPUSNG
     case Value_Closure:
       return left.GetClosure() == right.GetClosure();
@@ -426,6 +426,9 @@ class BASE_EXPORT_FOR_DEVTOOL Value {
   int GetLength() const;
   bool Contains(const base::String& key) const;
   static void MergeValue(lepus::Value& target, const lepus::Value& update);
+  // Tables and arrays marked const on the path are copied on write with
+  // ShallowCopy(), so that the subtrees not on the path are still shared with
+  // other values referring to them.
   static bool UpdateValueByPath(lepus::Value& target,
                                 const lepus::Value& update,
                                 const base::Vector<std::string>& path);
@@ -674,6 +677,7 @@ class BASE_EXPORT_FOR_DEVTOOL Value {
 
   void ConstructValueFromLepusRef(LEPUSContext* ctx, const LEPUSValue& val);
 
+  bool IsConstTableOrArray() const;
   Value GetPropertyFromTableOrArray(const std::string& key) const;
   bool SetPropertyToTableOrArray(const std::string& key, const Value& update);
 
@@ -76,6 +76,13 @@ enum TypeOpCode {
   TypeLabel_EnterBlock,
   TypeLabel_LeaveBlock,
   TypeOp_CreateBlockContext,
+
+  // Super instructions. They are fused from a pair of instructions by
+  // Function::FuseSuperInstructions() after decoding, and are never encoded.
+  // The fused instruction keeps the operands of the first one, and the second
+  // one is left in place so that jumps to it still work.
+  TypeOp_LoadConstCall,      // TypeOp_LoadConst followed by TypeOp_Call
+  TypeOp_LoadConstGetTable,  // TypeOp_LoadConst followed by TypeOp_GetTable
 };
 
 struct Instruction {
@@ -107,6 +114,23 @@ struct Instruction {
     op_code_ = (op_code_ & 0xFFFF0000) | (static_cast<int>(b) & 0xFFFF);
   }
 
+  void RefillsOpCode(TypeOpCode op_code) {
+    op_code_ = (op_code_ & 0x00FFFFFF) | ((op_code & 0xFF) << 24);
+  }
+
+  // Returns the instruction a super instruction is fused from.
+  static Instruction Unfused(Instruction i) {
+    switch (GetOpCode(i)) {
+      case TypeOp_LoadConstCall:
+      case TypeOp_LoadConstGetTable:
+        i.RefillsOpCode(TypeOp_LoadConst);
+        break;
+      default:
+        break;
+    }
+    return i;
+  }
+
   static Instruction ABCCode(TypeOpCode op, long a, long b, long c) {
     return Instruction(op, a, b, c);
   }
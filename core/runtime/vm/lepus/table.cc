@@ -23,8 +23,18 @@ bool Dictionary::Erase(const base::String& key) {
   return true;
 }
 
+bool Dictionary::SetValueSlow(const base::String& key, Value&& value) {
+  auto [target_ptr, inserted] = hash_map_.PrepareInsert(key);
+  if (inserted) {
+    new (target_ptr) Value(std::move(value));
+  } else {
+    *target_ptr = std::move(value);
+  }
+  return true;
+}
+
 const Value& Dictionary::GetValue(const base::String& key, bool forUndef) {
-  HashMap::iterator iter = hash_map_.find(key);
+  auto iter = hash_map_.find(key);
   if (iter != hash_map_.end()) {
     return iter->second;
   }
@@ -83,6 +93,10 @@ void Dictionary::dump() {
 }
 
 bool operator==(const Dictionary& left, const Dictionary& right) {
+  // Tables are shared by values after ShallowCopy().
+  if (&left == &right) {
+    return true;
+  }
   return left.hash_map_ == right.hash_map_;
 }
 
@@ -13,6 +13,7 @@
 
 #include "base/include/base_export.h"
 #include "base/include/value/base_string.h"
+#include "base/include/value/string_flat_map.h"
 #include "core/runtime/vm/lepus/lepus_value.h"
 #include "core/runtime/vm/lepus/ref_counted_class.h"
 #include "core/runtime/vm/lepus/ref_type.h"
@@ -21,17 +22,8 @@ namespace lynx {
 namespace lepus {
 class BASE_EXPORT_FOR_DEVTOOL Dictionary : public lepus::RefCounted {
  public:
-  using HashMap = std::unordered_map<base::String, Value>;
+  using HashMap = base::StringFlatMap<Value>;
 
- private:
-  class alignas(Value) ValueNoOpCtor {
-   private:
-    [[maybe_unused]] uint8_t buffer_[sizeof(Value)];
-  };
-
-  using ValueNoOpCtorHashMap = std::unordered_map<base::String, ValueNoOpCtor>;
-
- public:
   static fml::RefPtr<Dictionary> Create() {
     return fml::AdoptRef<Dictionary>(new Dictionary());
   }
@@ -61,18 +53,23 @@ class BASE_EXPORT_FOR_DEVTOOL Dictionary : public lepus::RefCounted {
   ///
   ///  The second way is better in performance but will cause severely binary
   ///  expansion for template specialization of try_emplace() method.
-  ///  By introducing ValueNoOpCtor and casting hash_map_ to
-  ///  ValueNoOpCtorHashMap, the emplace and construct of ValueNoOpCtor is
-  ///  cheap.
+  ///  HashMap::PrepareInsert() only depends on the key and leaves the Value
+  ///  uninitialized, so the Value is constructed in place with placement new.
+  ///
+  ///  HashMap stores Values inline and relocates them when it grows, while
+  ///  args may refer to a Value of this table. So when the table is about to
+  ///  grow, the Value is constructed before inserting in SetValueSlow().
   template <class... Args>
   bool SetValue(const base::String& key, Args&&... args) {
     if (IsConstLog()) {
       return false;
     }
 
-    auto& hash_map_no_op = reinterpret_cast<ValueNoOpCtorHashMap&>(hash_map_);
-    auto [iterator, inserted] = hash_map_no_op.try_emplace(key);
-    Value* target_ptr = reinterpret_cast<Value*>(&iterator->second);
+    if (!hash_map_.HasRoomForInsert()) {
+      return SetValueSlow(key, Value(std::forward<Args>(args)...));
+    }
+
+    auto [target_ptr, inserted] = hash_map_.PrepareInsert(key);
     if (!inserted) {
       // Insertion failed, destruct the existing Value.
       if constexpr (sizeof...(Args) == 1) {
@@ -96,6 +93,15 @@ class BASE_EXPORT_FOR_DEVTOOL Dictionary : public lepus::RefCounted {
 
   const Value& GetValue(const base::String& key, bool forUndef = false);
 
+  // Slot based lookup for inline caches of the VM, see
+  // base::StringFlatMap::FindSlot().
+  size_t FindSlot(const base::String& key) const {
+    return hash_map_.FindSlot(key);
+  }
+  Value* FindInSlot(size_t slot, const base::String& key) {
+    return hash_map_.FindInSlot(slot, key);
+  }
+
   std::optional<Value> GetProperty(const base::String& key) {
     if (const auto& result = hash_map_.find(key); result != hash_map_.end()) {
       return std::make_optional(result->second);
@@ -166,6 +172,8 @@ class BASE_EXPORT_FOR_DEVTOOL Dictionary : public lepus::RefCounted {
   HashMap hash_map_;
   bool is_const_ = false;
 
+  bool SetValueSlow(const base::String& key, Value&& value);
+
   LEPUS_INLINE bool IsConstLog() const {
     if (IsConst()) {
 #ifdef DEBUG
@@ -2792,6 +2792,112 @@ TEST_F(LepusValueMethods, UpdateValueByPath) {
   check(js_target, js_values);
 }
 
+TEST_F(LepusValueMethods, UpdateValueByPathCopyOnWrite) {
+  // data: { list : [{title : "0"}, {title : "1"}], other : {a : 1} }
+  auto list = lepus::CArray::Create();
+  for (int i = 0; i < 2; ++i) {
+    list->emplace_back(lepus::Dictionary::Create({
+        {base::String("title"), lepus::Value(std::to_string(i))},
+    }));
+  }
+  lepus::Value data(lepus::Dictionary::Create({
+      {base::String("list"), lepus::Value(list)},
+      {base::String("other"), lepus::Value(lepus::Dictionary::Create({
+                                  {base::String("a"), lepus::Value(1)},
+                              }))},
+  }));
+
+  // The snapshot shares the subtrees of data, which are marked const.
+  lepus::Value snapshot = lepus::Value::ShallowCopy(data);
+  ASSERT_TRUE(data.GetProperty("list").Array()->IsConst());
+
+  ASSERT_TRUE(lepus::Value::UpdateValueByPath(
+      data, lepus::Value("new"), lepus::ParseValuePath("list[1].title")));
+
+  // Only the tables and arrays on the path are copied.
+  ASSERT_TRUE(data.GetProperty("list").GetProperty(1).GetProperty("title") ==
+              lepus::Value("new"));
+  ASSERT_NE(data.GetProperty("list").Array(),
+            snapshot.GetProperty("list").Array());
+  ASSERT_EQ(data.GetProperty("list").GetProperty(0).Table(),
+            snapshot.GetProperty("list").GetProperty(0).Table());
+  ASSERT_EQ(data.GetProperty("other").Table(),
+            snapshot.GetProperty("other").Table());
+
+  // The snapshot is not modified.
+  ASSERT_TRUE(
+      snapshot.GetProperty("list").GetProperty(1).GetProperty("title") ==
+      lepus::Value("1"));
+
+  // Shared const subtrees are not updated in shadow check.
+  ASSERT_TRUE(tasm::CheckTableShadowUpdated(snapshot, data));
+  data.SetProperty(base::String("list"), snapshot.GetProperty("list"));
+  ASSERT_FALSE(tasm::CheckTableShadowUpdated(snapshot, data));
+}
+
+TEST_F(LepusValueMethods, UpdateConstValueByPath) {
+  lepus::Value target(lepus::Dictionary::Create({
+      {base::String("a"), lepus::Value(lepus::Dictionary::Create({
+                              {base::String("b"), lepus::Value(1)},
+                          }))},
+  }));
+  ASSERT_TRUE(target.MarkConst());
+  lepus::Value origin = target;
+
+  ASSERT_TRUE(lepus::Value::UpdateValueByPath(target, lepus::Value(2),
+                                              lepus::ParseValuePath("a.b")));
+  ASSERT_TRUE(target.GetProperty("a").GetProperty("b") == lepus::Value(2));
+  ASSERT_TRUE(origin.GetProperty("a").GetProperty("b") == lepus::Value(1));
+  ASSERT_FALSE(target.Table()->IsConst());
+}
+
+TEST_F(LepusValueMethods, UpdateConstTopLevelVariableByPath) {
+  lepus::VMContext vctx;
+  lepus::BytecodeGenerator::GenerateBytecode(&vctx, "let list = [];", "");
+  vctx.Execute();
+
+  // list: [{title : "0"}, {title : "1"}]
+  auto list = lepus::CArray::Create();
+  for (int i = 0; i < 2; ++i) {
+    list->emplace_back(lepus::Dictionary::Create({
+        {base::String("title"), lepus::Value(std::to_string(i))},
+    }));
+  }
+  lepus::Value origin(list);
+  ASSERT_TRUE(origin.MarkConst());
+  ASSERT_TRUE(vctx.UpdateTopLevelVariable("list", origin));
+
+  ASSERT_TRUE(
+      vctx.UpdateTopLevelVariable("list[1].title", lepus::Value("new")));
+  lepus::Value result;
+  ASSERT_TRUE(vctx.GetTopLevelVariableByName("list", &result));
+  ASSERT_TRUE(result.GetProperty(1).GetProperty("title") ==
+              lepus::Value("new"));
+
+  // Only the list and the updated item are copied, the other item is shared.
+  ASSERT_NE(result.Array(), origin.Array());
+  ASSERT_NE(result.GetProperty(1).Table(), origin.GetProperty(1).Table());
+  ASSERT_EQ(result.GetProperty(0).Table(), origin.GetProperty(0).Table());
+  ASSERT_TRUE(origin.GetProperty(1).GetProperty("title") == lepus::Value("1"));
+}
+
+TEST_F(LepusValueMethods, EqualSameTableOrArray) {
+  // NaN is not equal to itself, so only identity makes these equal.
+  lepus::Value nan(true, true);
+  lepus::Value table(lepus::Dictionary::Create({
+      {base::String("nan"), nan},
+  }));
+  lepus::Value array(lepus::CArray::Create());
+  array.Array()->push_back(nan);
+
+  lepus::Value same_table = table;
+  lepus::Value same_array = array;
+  ASSERT_TRUE(table == same_table);
+  ASSERT_TRUE(array == same_array);
+  ASSERT_FALSE(table == lepus::Value::Clone(table));
+  ASSERT_FALSE(array == lepus::Value::Clone(array));
+}
+
 TEST_F(LepusValueMethods, PrintErrorObject) {
   lepus::QuickContext qctx;
   std::string src = R"(
@@ -59,6 +59,166 @@ namespace lepus {
   b = GET_REGISTER_B_FROM_CTX(ctx);    \
   c = GET_REGISTER_C_FROM_CTX(ctx);
 
+// With threaded dispatch, RunFrame() jumps to the handler of each instruction
+// through a table of label addresses (computed goto), and hot handlers jump to
+// the next handler directly instead of going back to the top of the loop, so
+// that each of them has its own indirect branch to be predicted. Other
+// handlers and the slow paths, e.g. debugging, still go through the loop.
+#if ENABLE_LEPUS_THREADED_DISPATCH && (defined(__GNUC__) || defined(__clang__))
+#define LEPUS_THREADED_DISPATCH 1
+#else
+#define LEPUS_THREADED_DISPATCH 0
+#endif
+
+#define LEPUS_OP_LABEL(op) lepus_label_##op
+#define LEPUS_CASE_WITH_LABEL(op) \
+  case op:                        \
+  LEPUS_OP_LABEL(op) :
+
+#if LEPUS_THREADED_DISPATCH
+#define LEPUS_CASE(op) LEPUS_CASE_WITH_LABEL(op)
+#define LEPUS_DEFAULT_CASE() \
+  default:                   \
+  lepus_label_default:
+#define LEPUS_DISPATCH_ENTRY(op) &&LEPUS_OP_LABEL(op),
+#define LEPUS_DISPATCH_TARGET(i)                                  \
+  (static_cast<size_t>(Instruction::GetOpCode(i)) <               \
+           sizeof(kDispatchTable) / sizeof(kDispatchTable[0])     \
+       ? kDispatchTable[Instruction::GetOpCode(i)]                \
+       : &&lepus_label_default)
+#define LEPUS_DISPATCH()                             \
+  if (unlikely(pc >= length || is_debug_enabled_)) { \
+    break;                                           \
+  }                                                  \
+  i = *(base + pc);                                  \
+  run_frame_ctx.i = i;                               \
+  pc++;                                              \
+  goto* LEPUS_DISPATCH_TARGET(i)
+#else
+#define LEPUS_CASE(op) case op:
+#define LEPUS_DEFAULT_CASE() default:
+#define LEPUS_DISPATCH() break
+#endif
+
+// All TypeOpCode in order, the index in the dispatch table is the op code.
+#define LEPUS_FOR_EACH_OP_CODE(V) \
+  V(TypeOp_LoadNil)               \
+  V(TypeOp_LoadConst)             \
+  V(TypeOp_Move)                  \
+  V(TypeOp_GetUpvalue)            \
+  V(TypeOp_SetUpvalue)            \
+  V(TypeOp_GetGlobal)             \
+  V(TypeOp_SetGlobal)             \
+  V(TypeOp_Closure)               \
+  V(TypeOp_Call)                  \
+  V(TypeOp_Ret)                   \
+  V(TypeOp_JmpFalse)              \
+  V(TypeOp_Jmp)                   \
+  V(TypeOp_Neg)                   \
+  V(TypeOp_Not)                   \
+  V(TypeOp_Len)                   \
+  V(TypeOp_Add)                   \
+  V(TypeOp_Sub)                   \
+  V(TypeOp_Mul)                   \
+  V(TypeOp_Div)                   \
+  V(TypeOp_Pow)                   \
+  V(TypeOp_Mod)                   \
+  V(TypeOp_And)                   \
+  V(TypeOp_Or)                    \
+  V(TypeOp_Less)                  \
+  V(TypeOp_Greater)               \
+  V(TypeOp_Equal)                 \
+  V(TypeOp_UnEqual)               \
+  V(TypeOp_LessEqual)             \
+  V(TypeOp_GreaterEqual)          \
+  V(TypeOp_NewTable)              \
+  V(TypeOp_SetTable)              \
+  V(TypeOp_GetTable)              \
+  V(TypeOp_Switch)                \
+  V(TypeOp_Inc)                   \
+  V(TypeOp_Dec)                   \
+  V(TypeOp_Noop)                  \
+  V(TypeOp_NewArray)              \
+  V(TypeOp_GetBuiltin)            \
+  V(TypeOp_Typeof)                \
+  V(TypeOp_SetCatchId)            \
+  V(TypeLabel_Throw)              \
+  V(TypeLabel_Catch)              \
+  V(TypeOp_BitOr)                 \
+  V(TypeOp_BitAnd)                \
+  V(TypeOp_BitXor)                \
+  V(TypeOp_BitNot)                \
+  V(TypeOp_Pos)                   \
+  V(TypeOp_CreateContext)         \
+  V(TypeOp_SetContextSlotMove)    \
+  V(TypeOp_GetContextSlotMove)    \
+  V(TypeOp_PushContext)           \
+  V(TypeOp_PopContext)            \
+  V(TypeOp_GetContextSlot)        \
+  V(TypeOp_SetContextSlot)        \
+  V(TypeOp_AbsUnEqual)            \
+  V(TypeOp_AbsEqual)              \
+  V(TypeOp_JmpTrue)               \
+  V(TypeLabel_EnterBlock)         \
+  V(TypeLabel_LeaveBlock)         \
+  V(TypeOp_CreateBlockContext)    \
+  V(TypeOp_LoadConstCall)         \
+  V(TypeOp_LoadConstGetTable)
+
+namespace {
+#define LEPUS_OP_CODE_ENTRY(op) op,
+constexpr TypeOpCode kAllOpCodes[] = {
+    LEPUS_FOR_EACH_OP_CODE(LEPUS_OP_CODE_ENTRY)};
+#undef LEPUS_OP_CODE_ENTRY
+
+constexpr bool IsAllOpCodesInOrder() {
+  for (size_t index = 0; index < sizeof(kAllOpCodes) / sizeof(kAllOpCodes[0]);
+       ++index) {
+    if (static_cast<size_t>(kAllOpCodes[index]) != index + 1) {
+      return false;
+    }
+  }
+  return true;
+}
+static_assert(IsAllOpCodesInOrder(),
+              "LEPUS_FOR_EACH_OP_CODE must list all TypeOpCode in order");
+static_assert(kAllOpCodes[sizeof(kAllOpCodes) / sizeof(kAllOpCodes[0]) - 1] ==
+                  TypeOp_LoadConstGetTable,
+              "LEPUS_FOR_EACH_OP_CODE must list all TypeOpCode in order");
+
+// Property access of TypeOp_GetTable and TypeOp_SetTable with their inline
+// caches, see PropertyCache.
+const Value& GetTableValue(Dictionary* table, const base::String& key,
+                           PropertyCache& cache, bool for_undef) {
+  if (Value* value = table->FindInSlot(cache.Slot(), key)) {
+    cache.RecordHit();
+    return *value;
+  }
+  cache.RecordMiss();
+  size_t slot = table->FindSlot(key);
+  if (slot == Dictionary::HashMap::npos) {
+    return table->GetValue(key, for_undef);
+  }
+  cache.Update(slot);
+  return *table->FindInSlot(slot, key);
+}
+
+void SetTableValue(Dictionary* table, const base::String& key,
+                   const Value& value, PropertyCache& cache) {
+  if (!table->IsConst()) {
+    if (Value* target = table->FindInSlot(cache.Slot(), key)) {
+      cache.RecordHit();
+      *target = value;
+      return;
+    }
+  }
+  cache.RecordMiss();
+  if (table->SetValue(key, value)) {
+    cache.Update(table->FindSlot(key));
+  }
+}
+}  // namespace
+
 #define DECL_ABC_FROM_CTX(ctx) \
   auto& a = ctx.a;             \
   auto& b = ctx.b;             \
@@ -179,8 +339,8 @@ void VMContext::Dump() {
 
 // check target's first level variable.
 // 1. if update key is not path, simply add new k-v pair for the first level
-// 2. if update key is value path, clone the first level k-v pair and update
-//     the exact value.
+// 2. if update key is value path, update the exact value, copying the const
+//     tables and arrays on the path.
 bool VMContext::UpdateTopLevelVariableByPath(base::Vector<std::string>& path,
                                              const Value& value) {
   if (path.empty()) {
@@ -206,10 +366,7 @@ bool VMContext::UpdateTopLevelVariableByPath(base::Vector<std::string>& path,
   }
   path.erase(front_value_iter);
   Value* ptr = heap_.base() + reg + 1;
-  if (!path.empty() && ((ptr->IsTable() && ptr->Table()->IsConst()) ||
-                        (ptr->IsArray() && ptr->Array()->IsConst()))) {
-    *(heap_.base() + reg + 1) = Value::Clone(*ptr);
-  }
+  // Const tables and arrays on the path are copied on write.
   lepus::Value::UpdateValueByPath(*ptr, value, path);
   return true;
 }
@@ -759,8 +916,13 @@ void VMContext::RunFrame() {
   int length =
       static_cast<int>(current_frame_->end_ - current_frame_->instruction_);
   int pc = 0;
+  Instruction i;
   VMContext::ContextScope vcs(this, closure);
   RunFrameContext run_frame_ctx{.a = a, .b = b, .c = c, .regs = regs};
+#if LEPUS_THREADED_DISPATCH
+  static const void* const kDispatchTable[] = {
+      &&lepus_label_default, LEPUS_FOR_EACH_OP_CODE(LEPUS_DISPATCH_ENTRY)};
+#endif
   while (pc < length) {
     if (is_debug_enabled_) {
       auto debug_delegate = debug_delegate_.lock();
@@ -768,11 +930,14 @@ void VMContext::RunFrame() {
         debug_delegate->UpdateCurrentPC(pc);
       }
     }
-    const Instruction i = *(base + pc);
+    i = *(base + pc);
     run_frame_ctx.i = i;
     pc++;
+#if LEPUS_THREADED_DISPATCH
+    goto* LEPUS_DISPATCH_TARGET(i);
+#endif
     switch (Instruction::GetOpCode(i)) {
-      case TypeOp_LoadNil: {
+      LEPUS_CASE(TypeOp_LoadNil) {
         // LoadNil is not extracted as RunFrame_Op_LoadNil() because it is
         // definitely executed frequently.
         // LoadNil use reg_b to decide actions:
@@ -807,24 +972,24 @@ void VMContext::RunFrame() {
         } else {
           a->SetNil();
         }
-        break;
+        LEPUS_DISPATCH();
       }
-      case TypeOp_SetCatchId:
+      LEPUS_CASE(TypeOp_SetCatchId)
         a = GET_REGISTER_A(i);
         a->SetString(std::move(exception_info_));
         break;
-      case TypeOp_LoadConst:
+      LEPUS_CASE(TypeOp_LoadConst)
         a = GET_REGISTER_A(i);
         b = GET_CONST_VALUE(i);
         *a = *b;
-        break;
-      case TypeOp_Move:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Move)
         a = GET_REGISTER_A(i);
         b = GET_REGISTER_B(i);
         *a = *b;
-        break;
-      case TypeOp_GetContextSlot:
-      case TypeOp_SetContextSlot: {
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_GetContextSlot)
+      LEPUS_CASE(TypeOp_SetContextSlot) {
         a = GET_REGISTER_A(i);
         long index = Instruction::GetParamB(i);
         long offset = Instruction::GetParamC(i);
@@ -841,36 +1006,36 @@ void VMContext::RunFrame() {
         }
         break;
       }
-      case TypeOp_GetUpvalue: {
+      LEPUS_CASE(TypeOp_GetUpvalue) {
         a = GET_REGISTER_A(i);
         b = GET_UPVALUE_B(i);
         *a = *b;
-        break;
+        LEPUS_DISPATCH();
       }
-      case TypeOp_SetUpvalue: {
+      LEPUS_CASE(TypeOp_SetUpvalue) {
         a = GET_REGISTER_A(i);
         b = GET_UPVALUE_B(i);
         *b = *a;
-        break;
+        LEPUS_DISPATCH();
       }
-      case TypeOp_GetGlobal:
+      LEPUS_CASE(TypeOp_GetGlobal)
         a = GET_REGISTER_A(i);
         b = GET_Global_VALUE(i);
         *a = *b;
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_SetGlobal)
         break;
-      case TypeOp_SetGlobal:
-        break;
-      case TypeOp_GetBuiltin:
+      LEPUS_CASE(TypeOp_GetBuiltin)
         a = GET_REGISTER_A(i);
         b = GET_Builtin_VALUE(i);
         *a = *b;
-        break;
-      case TypeOp_Closure: {
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Closure) {
         a = GET_REGISTER_A(i);
         long index = Instruction::GetParamBx(i);
         GenerateClosure(a, index);
       } break;
-      case TypeOp_Call: {
+      LEPUS_CASE_WITH_LABEL(TypeOp_Call) {
         a = GET_REGISTER_A(i);
         long argc = Instruction::GetParamB(i);
         c = GET_REGISTER_C(i);
@@ -897,28 +1062,28 @@ void VMContext::RunFrame() {
         } else if (pc < current_frame_->current_pc_) {
           pc = length;
         }
-        break;
+        LEPUS_DISPATCH();
       }
-      case TypeOp_Ret:
+      LEPUS_CASE(TypeOp_Ret)
         a = GET_REGISTER_A(i);
         if (current_frame_->return_ != nullptr) {
           *current_frame_->return_ = *a;
         }
         return;
-      case TypeOp_JmpFalse:
+      LEPUS_CASE(TypeOp_JmpFalse)
         a = GET_REGISTER_A(i);
         if (a->IsFalse()) pc += -1 + Instruction::GetParamsBx(i);
-        break;
-      case TypeOp_JmpTrue:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_JmpTrue)
         a = GET_REGISTER_A(i);
         if (a->IsTrue()) pc += -1 + Instruction::GetParamsBx(i);
-        break;
-      case TypeOp_Jmp:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Jmp)
         pc += -1 + Instruction::GetParamsBx(i);
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeLabel_Catch)
         break;
-      case TypeLabel_Catch:
-        break;
-      case TypeLabel_Throw: {
+      LEPUS_CASE(TypeLabel_Throw) {
         a = GET_REGISTER_A(i);
         std::ostringstream msg;
         msg << a;
@@ -926,21 +1091,21 @@ void VMContext::RunFrame() {
                         false);
         break;
       }
-      case TypeOp_SetContextSlotMove: {
+      LEPUS_CASE(TypeOp_SetContextSlotMove) {
         a = GET_REGISTER_A(i);
         long array_index = Instruction::GetParamB(i);
         c = GET_REGISTER_C(i);
         a->Array()->set(static_cast<int>(array_index), *c);
         break;
       }
-      case TypeOp_GetContextSlotMove: {
+      LEPUS_CASE(TypeOp_GetContextSlotMove) {
         a = GET_REGISTER_A(i);
         long array_index = Instruction::GetParamB(i);
         c = GET_REGISTER_C(i);
         *a = c->Array()->get(array_index);
         break;
       }
-      case TypeOp_Typeof: {
+      LEPUS_CASE(TypeOp_Typeof) {
         static constexpr const char kUndefined[] = "undefined";
         static constexpr const char kObject[] = "object";
         static constexpr const char kBoolean[] = "boolean";
@@ -984,7 +1149,7 @@ void VMContext::RunFrame() {
         }
         break;
       }
-      case TypeOp_Neg:
+      LEPUS_CASE(TypeOp_Neg)
         a = GET_REGISTER_A(i);
         if (a->IsInt64()) {
           a->SetNumber(-a->Int64());
@@ -994,15 +1159,15 @@ void VMContext::RunFrame() {
           RunFrame_Op_Neg_UnlikelyPath(a);
         }
         break;
-      case TypeOp_Pos:
+      LEPUS_CASE(TypeOp_Pos)
         a = GET_REGISTER_A(i);
         RunFrame_Op_Pos(a);
         break;
-      case TypeOp_Not:
+      LEPUS_CASE(TypeOp_Not)
         a = GET_REGISTER_A(i);
         a->SetBool(!a->Bool());
-        break;
-      case TypeOp_BitNot:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_BitNot)
         a = GET_REGISTER_A(i);
         if (a->IsNumber()) {
           if (a->IsInt64())
@@ -1013,7 +1178,7 @@ void VMContext::RunFrame() {
           }
         }
         break;
-      case TypeOp_And:
+      LEPUS_CASE(TypeOp_And)
         //&&
         GET_REGISTER_ABC(i);
         if (b->IsTrue()) {
@@ -1021,8 +1186,8 @@ void VMContext::RunFrame() {
         } else {
           *a = *b;
         }
-        break;
-      case TypeOp_Or:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Or)
         //||
         GET_REGISTER_ABC(i);
         if (!b->IsFalse()) {
@@ -1030,10 +1195,10 @@ void VMContext::RunFrame() {
         } else {
           *a = *c;
         }
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Len)
         break;
-      case TypeOp_Len:
-        break;
-      case TypeOp_Add:
+      LEPUS_CASE(TypeOp_Add)
         GET_REGISTER_ABC(i);
         // most cases are string + string
         // some cases are int + string
@@ -1060,24 +1225,24 @@ void VMContext::RunFrame() {
           // may string + null or null + string
           a->SetString(b->StdString() + c->StdString());
         }
-        break;
-      case TypeOp_Sub:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Sub)
         GET_REGISTER_ABC(i);
         if (b->IsInt64() && c->IsInt64()) {
           a->SetNumber(b->Int64() - c->Int64());
         } else {
           a->SetNumber(b->Number() - c->Number());
         }
-        break;
-      case TypeOp_Mul:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Mul)
         GET_REGISTER_ABC(i);
         if (b->IsInt64() && c->IsInt64()) {
           a->SetNumber(b->Int64() * c->Int64());
         } else {
           a->SetNumber(b->Number() * c->Number());
         }
-        break;
-      case TypeOp_Div: {
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Div) {
         GET_REGISTER_ABC(i);
         if (c->Number() == 0) {
           *a = Value();
@@ -1092,22 +1257,22 @@ void VMContext::RunFrame() {
         }
         break;
       }
-      case TypeOp_Pow:
+      LEPUS_CASE(TypeOp_Pow)
         RunFrame_Op_Pow(run_frame_ctx);
         break;
-      case TypeOp_Mod:
+      LEPUS_CASE(TypeOp_Mod)
         RunFrame_Op_Mod(run_frame_ctx);
         break;
-      case TypeOp_BitOr:
+      LEPUS_CASE(TypeOp_BitOr)
         RunFrame_Op_BitOr(run_frame_ctx);
         break;
-      case TypeOp_BitAnd:
+      LEPUS_CASE(TypeOp_BitAnd)
         RunFrame_Op_BitAnd(run_frame_ctx);
         break;
-      case TypeOp_BitXor:
+      LEPUS_CASE(TypeOp_BitXor)
         RunFrame_Op_BitXor(run_frame_ctx);
         break;
-      case TypeOp_Less:
+      LEPUS_CASE(TypeOp_Less)
         GET_REGISTER_ABC(i);
         if (b->IsNumber() && c->IsNumber()) {
           a->SetBool(b->Number() < c->Number());
@@ -1116,8 +1281,8 @@ void VMContext::RunFrame() {
         } else {
           a->SetBool(false);
         }
-        break;
-      case TypeOp_Greater:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Greater)
         GET_REGISTER_ABC(i);
         if (b->IsNumber() && c->IsNumber()) {
           a->SetBool(b->Number() > c->Number());
@@ -1126,32 +1291,32 @@ void VMContext::RunFrame() {
         } else {
           a->SetBool(false);
         }
-        break;
-      case TypeOp_Equal:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Equal)
         GET_REGISTER_ABC(i);
         if (b->IsString() && c->IsString()) {
           a->SetBool(b->StdString() == c->StdString());
         } else {
           a->SetBool(*b == *c);
         }
-        break;
-      case TypeOp_AbsEqual:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_AbsEqual)
         GET_REGISTER_ABC(i);
         if (b->IsString() && c->IsString()) {
           a->SetBool(b->StdString() == c->StdString());
         } else {
           a->SetBool(*b == *c);
         }
-        break;
-      case TypeOp_UnEqual:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_UnEqual)
         GET_REGISTER_ABC(i);
         a->SetBool(*b != *c);
-        break;
-      case TypeOp_AbsUnEqual:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_AbsUnEqual)
         GET_REGISTER_ABC(i);
         a->SetBool(*b != *c);
-        break;
-      case TypeOp_LessEqual:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_LessEqual)
         GET_REGISTER_ABC(i);
         if (b->IsNumber() && c->IsNumber()) {
           a->SetBool((b->Number() <= c->Number()));
@@ -1160,8 +1325,8 @@ void VMContext::RunFrame() {
         } else {
           a->SetBool(false);
         }
-        break;
-      case TypeOp_GreaterEqual:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_GreaterEqual)
         GET_REGISTER_ABC(i);
         if (b->IsNumber() && c->IsNumber()) {
           a->SetBool((b->Number() >= c->Number()));
@@ -1170,8 +1335,8 @@ void VMContext::RunFrame() {
         } else {
           a->SetBool(false);
         }
-        break;
-      case TypeOp_NewArray: {
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_NewArray) {
         a = GET_REGISTER_A(i);
         long argc = Instruction::GetParamB(i);
         auto arr = CArray::Create();
@@ -1181,7 +1346,7 @@ void VMContext::RunFrame() {
         }
         *a = Value(std::move(arr));
       } break;
-      case TypeOp_CreateContext: {
+      LEPUS_CASE(TypeOp_CreateContext) {
         a = GET_REGISTER_A(i);
         // context + data
         long array_size = Instruction::GetParamB(i) + 1;
@@ -1194,23 +1359,24 @@ void VMContext::RunFrame() {
         closure_context_ = *a;
         break;
       }
-      case TypeOp_PushContext: {
+      LEPUS_CASE(TypeOp_PushContext) {
         a = GET_REGISTER_A(i);
         context_.push(*a);
         break;
       }
-      case TypeOp_PopContext: {
+      LEPUS_CASE(TypeOp_PopContext) {
         context_.pop();
         break;
       }
-      case TypeOp_NewTable:
+      LEPUS_CASE(TypeOp_NewTable)
         a = GET_REGISTER_A(i);
         a->SetTable(Dictionary::Create());
-        break;
-      case TypeOp_SetTable:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_SetTable)
         GET_REGISTER_ABC(i);
         if (a->IsTable() && b->IsString()) {
-          a->Table()->SetValue(b->String(), *c);
+          SetTableValue(a->Table().get(), b->String(), *c,
+                        function->GetPropertyCache(pc - 1));
         } else if (a->IsArray() && b->IsNumber()) {
           a->Array()->set(static_cast<int>(b->Number()), *c);
         } else if (a->IsTable() && b->IsNumber()) {
@@ -1218,8 +1384,8 @@ void VMContext::RunFrame() {
           s << b->Number();
           a->Table()->SetValue(s.str(), *c);
         }
-        break;
-      case TypeOp_GetTable:
+        LEPUS_DISPATCH();
+      LEPUS_CASE_WITH_LABEL(TypeOp_GetTable)
         GET_REGISTER_ABC(i);
 
         if (b->IsNil() || b->IsUndefined()) {
@@ -1252,8 +1418,9 @@ void VMContext::RunFrame() {
         switch (b->Type()) {
           case Value_Table:
             if (c->IsString()) {
-              *a =
-                  b->Table()->GetValue(c->String(), enable_null_prop_as_undef_);
+              *a = GetTableValue(b->Table().get(), c->String(),
+                                 function->GetPropertyCache(pc - 1),
+                                 enable_null_prop_as_undef_);
             } else if (c->IsNumber()) {
               std::ostringstream s;
               s << c->Number();
@@ -1327,14 +1494,14 @@ void VMContext::RunFrame() {
             }
             break;
         }
-        break;
-      case TypeOp_Switch: {
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Switch) {
         a = GET_REGISTER_A(i);
         long index = Instruction::GetParamBx(i);
         long jmp = function->GetSwitch(index)->Switch(a);
         pc += -1 + jmp;
       } break;
-      case TypeOp_Inc:
+      LEPUS_CASE(TypeOp_Inc)
         a = GET_REGISTER_A(i);
         if (a->IsNumber()) {
           if (a->IsInt64()) {
@@ -1343,8 +1510,8 @@ void VMContext::RunFrame() {
             a->SetNumber(a->Number() + 1);
           }
         }
-        break;
-      case TypeOp_Dec:
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Dec)
         a = GET_REGISTER_A(i);
         if (a->IsNumber()) {
           if (a->IsInt64()) {
@@ -1353,19 +1520,38 @@ void VMContext::RunFrame() {
             a->SetNumber(a->Number() - 1);
           }
         }
+        LEPUS_DISPATCH();
+      LEPUS_CASE(TypeOp_Noop)
         break;
-      case TypeOp_Noop:
-        break;
-      case TypeLabel_EnterBlock:
+      LEPUS_CASE(TypeLabel_EnterBlock)
         RunFrame_Label_EnterBlock(closure);
         break;
-      case TypeLabel_LeaveBlock:
+      LEPUS_CASE(TypeLabel_LeaveBlock)
         RunFrame_Label_LeaveBlock();
         break;
-      case TypeOp_CreateBlockContext:
+      LEPUS_CASE(TypeOp_CreateBlockContext)
         RunFrame_Op_CreateBlockContext(run_frame_ctx);
         break;
-      default:
+      LEPUS_CASE(TypeOp_LoadConstCall)
+      LEPUS_CASE(TypeOp_LoadConstGetTable)
+        a = GET_REGISTER_A(i);
+        b = GET_CONST_VALUE(i);
+        *a = *b;
+        if (unlikely(is_debug_enabled_)) {
+          break;
+        }
+        // Runs the second instruction of the pair without dispatching.
+        if (Instruction::GetOpCode(i) == TypeOp_LoadConstCall) {
+          i = *(base + pc);
+          run_frame_ctx.i = i;
+          pc++;
+          goto LEPUS_OP_LABEL(TypeOp_Call);
+        }
+        i = *(base + pc);
+        run_frame_ctx.i = i;
+        pc++;
+        goto LEPUS_OP_LABEL(TypeOp_GetTable);
+      LEPUS_DEFAULT_CASE()
         break;
     }
   }
@@ -0,0 +1,566 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/services/recorder/binary_record_format.h"
+
+#include <cstring>
+#include <utility>
+
+#include "core/services/recorder/recorder_constants.h"
+#include "third_party/modp_b64/modp_b64.h"
+#include "third_party/rapidjson/stringbuffer.h"
+#include "third_party/rapidjson/writer.h"
+#include "third_party/zlib/zlib.h"
+
+namespace lynx {
+namespace tasm {
+namespace recorder {
+
+namespace {
+
+enum ValueTag : uint8_t {
+  kTagNull = 0,
+  kTagFalse,
+  kTagTrue,
+  kTagInt,
+  kTagUint,
+  kTagDouble,
+  kTagString,
+  kTagArray,
+  kTagObject,
+};
+
+// Deeper values are not recorded by the json recorder either.
+constexpr int kMaxValueDepth = 128;
+
+uint64_t ZigZagEncode(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^
+         static_cast<uint64_t>(value >> 63);
+}
+
+int64_t ZigZagDecode(uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+}  // namespace
+
+std::unique_ptr<uint8_t[]> Compress(const char* source, size_t source_size,
+                                    unsigned long* compressed_size_in) {
+  *compressed_size_in = compressBound(source_size);
+  std::unique_ptr<uint8_t[]> compressed_data =
+      std::make_unique<uint8_t[]>(*compressed_size_in);
+  int z_result =
+      compress(compressed_data.get(), compressed_size_in,
+               reinterpret_cast<const Cr_z_Bytef*>(source), source_size);
+  if (z_result == Z_OK) {
+    return compressed_data;
+  } else {
+    return nullptr;
+  }
+}
+
+std::unique_ptr<char[]> ModpB64Encode(const char* source, size_t source_size,
+                                      unsigned long* base64_size_in) {
+  *base64_size_in = modp_b64_encode_len(source_size);
+  std::unique_ptr<char[]> base64_data =
+      std::make_unique<char[]>(*base64_size_in);
+  *base64_size_in = modp_b64_encode(base64_data.get(), source, source_size);
+  return base64_data;
+}
+
+// static
+void BinaryRecordEncoder::WriteHeader(std::vector<uint8_t>& buffer) {
+  buffer.insert(buffer.end(), kBinaryRecordMagic,
+                kBinaryRecordMagic + sizeof(kBinaryRecordMagic));
+  for (int i = 0; i < 4; ++i) {
+    buffer.push_back(static_cast<uint8_t>(kBinaryRecordVersion >> (i * 8)));
+  }
+}
+
+void BinaryRecordEncoder::BeginRecord(BinaryRecordType type,
+                                      int64_t record_id, int64_t time_in_ms) {
+  buffer_.clear();
+  // The size is written by EndRecord().
+  buffer_.resize(sizeof(uint32_t));
+  buffer_.push_back(static_cast<uint8_t>(type));
+  WriteSignedVarint(record_id);
+  WriteSignedVarint(time_in_ms);
+}
+
+void BinaryRecordEncoder::EndRecord() {
+  WriteFixed32(static_cast<uint32_t>(buffer_.size() - sizeof(uint32_t)), 0);
+}
+
+void BinaryRecordEncoder::WriteFixed32(uint32_t value, size_t offset) {
+  for (int i = 0; i < 4; ++i) {
+    buffer_[offset + i] = static_cast<uint8_t>(value >> (i * 8));
+  }
+}
+
+void BinaryRecordEncoder::WriteVarint(uint64_t value) {
+  while (value >= 0x80) {
+    buffer_.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  buffer_.push_back(static_cast<uint8_t>(value));
+}
+
+void BinaryRecordEncoder::WriteSignedVarint(int64_t value) {
+  WriteVarint(ZigZagEncode(value));
+}
+
+void BinaryRecordEncoder::WriteDouble(double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  for (int i = 0; i < 8; ++i) {
+    buffer_.push_back(static_cast<uint8_t>(bits >> (i * 8)));
+  }
+}
+
+void BinaryRecordEncoder::WriteString(const char* str, size_t length) {
+  WriteVarint(length);
+  buffer_.insert(buffer_.end(), str, str + length);
+}
+
+void BinaryRecordEncoder::WriteValue(const rapidjson::Value& value) {
+  switch (value.GetType()) {
+    case rapidjson::kNullType:
+      buffer_.push_back(kTagNull);
+      break;
+    case rapidjson::kFalseType:
+      buffer_.push_back(kTagFalse);
+      break;
+    case rapidjson::kTrueType:
+      buffer_.push_back(kTagTrue);
+      break;
+    case rapidjson::kNumberType:
+      if (value.IsInt64()) {
+        buffer_.push_back(kTagInt);
+        WriteSignedVarint(value.GetInt64());
+      } else if (value.IsUint64()) {
+        buffer_.push_back(kTagUint);
+        WriteVarint(value.GetUint64());
+      } else {
+        buffer_.push_back(kTagDouble);
+        WriteDouble(value.GetDouble());
+      }
+      break;
+    case rapidjson::kStringType:
+      buffer_.push_back(kTagString);
+      WriteString(value.GetString(), value.GetStringLength());
+      break;
+    case rapidjson::kArrayType:
+      buffer_.push_back(kTagArray);
+      WriteVarint(value.Size());
+      for (const auto& item : value.GetArray()) {
+        WriteValue(item);
+      }
+      break;
+    case rapidjson::kObjectType:
+      buffer_.push_back(kTagObject);
+      WriteVarint(value.MemberCount());
+      for (const auto& member : value.GetObject()) {
+        WriteString(member.name.GetString(), member.name.GetStringLength());
+        WriteValue(member.value);
+      }
+      break;
+  }
+}
+
+bool BinaryRecordDecoder::ReadHeader() {
+  if (size_ - offset_ < kBinaryRecordHeaderSize ||
+      std::memcmp(data_ + offset_, kBinaryRecordMagic,
+                  sizeof(kBinaryRecordMagic)) != 0) {
+    return false;
+  }
+  uint32_t version = 0;
+  for (int i = 0; i < 4; ++i) {
+    version |= static_cast<uint32_t>(data_[offset_ + 4 + i]) << (i * 8);
+  }
+  offset_ += kBinaryRecordHeaderSize;
+  return version == kBinaryRecordVersion;
+}
+
+bool BinaryRecordDecoder::ReadRecord(BinaryRecordDecoder* body) {
+  if (size_ - offset_ < sizeof(uint32_t)) {
+    return false;
+  }
+  uint32_t body_size = 0;
+  for (int i = 0; i < 4; ++i) {
+    body_size |= static_cast<uint32_t>(data_[offset_ + i]) << (i * 8);
+  }
+  if (size_ - offset_ - sizeof(uint32_t) < body_size) {
+    // Truncated, e.g. the writer has not been closed.
+    return false;
+  }
+  offset_ += sizeof(uint32_t);
+  *body = BinaryRecordDecoder(data_ + offset_, body_size);
+  offset_ += body_size;
+  return true;
+}
+
+bool BinaryRecordDecoder::ReadVarint(uint64_t* value) {
+  uint64_t result = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (offset_ == size_) {
+      return false;
+    }
+    uint8_t byte = data_[offset_++];
+    result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BinaryRecordDecoder::ReadSignedVarint(int64_t* value) {
+  uint64_t result;
+  if (!ReadVarint(&result)) {
+    return false;
+  }
+  *value = ZigZagDecode(result);
+  return true;
+}
+
+bool BinaryRecordDecoder::ReadDouble(double* value) {
+  if (size_ - offset_ < sizeof(uint64_t)) {
+    return false;
+  }
+  uint64_t bits = 0;
+  for (int i = 0; i < 8; ++i) {
+    bits |= static_cast<uint64_t>(data_[offset_ + i]) << (i * 8);
+  }
+  offset_ += sizeof(uint64_t);
+  std::memcpy(value, &bits, sizeof(bits));
+  return true;
+}
+
+bool BinaryRecordDecoder::ReadString(std::string* str) {
+  uint64_t length;
+  if (!ReadVarint(&length) || size_ - offset_ < length) {
+    return false;
+  }
+  str->assign(reinterpret_cast<const char*>(data_ + offset_), length);
+  offset_ += length;
+  return true;
+}
+
+bool BinaryRecordDecoder::ReadValue(
+    rapidjson::Value* value, rapidjson::Document::AllocatorType& allocator,
+    int depth) {
+  if (offset_ == size_ || depth > kMaxValueDepth) {
+    return false;
+  }
+  switch (data_[offset_++]) {
+    case kTagNull:
+      value->SetNull();
+      return true;
+    case kTagFalse:
+      value->SetBool(false);
+      return true;
+    case kTagTrue:
+      value->SetBool(true);
+      return true;
+    case kTagInt: {
+      int64_t number;
+      if (!ReadSignedVarint(&number)) {
+        return false;
+      }
+      value->SetInt64(number);
+      return true;
+    }
+    case kTagUint: {
+      uint64_t number;
+      if (!ReadVarint(&number)) {
+        return false;
+      }
+      value->SetUint64(number);
+      return true;
+    }
+    case kTagDouble: {
+      double number;
+      if (!ReadDouble(&number)) {
+        return false;
+      }
+      value->SetDouble(number);
+      return true;
+    }
+    case kTagString: {
+      uint64_t length;
+      if (!ReadVarint(&length) || size_ - offset_ < length) {
+        return false;
+      }
+      value->SetString(reinterpret_cast<const char*>(data_ + offset_),
+                       static_cast<rapidjson::SizeType>(length), allocator);
+      offset_ += length;
+      return true;
+    }
+    case kTagArray: {
+      uint64_t count;
+      // Each item takes a byte at least.
+      if (!ReadVarint(&count) || size_ - offset_ < count) {
+        return false;
+      }
+      value->SetArray();
+      value->Reserve(static_cast<rapidjson::SizeType>(count), allocator);
+      for (uint64_t i = 0; i < count; ++i) {
+        rapidjson::Value item;
+        if (!ReadValue(&item, allocator, depth + 1)) {
+          return false;
+        }
+        value->PushBack(item, allocator);
+      }
+      return true;
+    }
+    case kTagObject: {
+      uint64_t count;
+      if (!ReadVarint(&count) || size_ - offset_ < count) {
+        return false;
+      }
+      value->SetObject();
+      std::string name;
+      for (uint64_t i = 0; i < count; ++i) {
+        rapidjson::Value member;
+        if (!ReadString(&name) || !ReadValue(&member, allocator, depth + 1)) {
+          return false;
+        }
+        value->AddMember(rapidjson::Value(name.c_str(),
+                                          static_cast<rapidjson::SizeType>(
+                                              name.length()),
+                                          allocator),
+                         member, allocator);
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+namespace {
+
+// The same layout as TestBenchBaseRecorder::CreateRecordedFile().
+void CreateRecordedFile(rapidjson::Document& document) {
+  auto& allocator = document.GetAllocator();
+  document.SetObject();
+  document.AddMember(rapidjson::StringRef(kActionList),
+                     rapidjson::Value(rapidjson::kArrayType), allocator);
+  document.AddMember(rapidjson::StringRef(kInvokedMethodData),
+                     rapidjson::Value(rapidjson::kArrayType), allocator);
+  document.AddMember(rapidjson::StringRef(kCallback),
+                     rapidjson::Value(rapidjson::kObjectType), allocator);
+  document.AddMember(rapidjson::StringRef(kComponentList),
+                     rapidjson::Value(rapidjson::kArrayType), allocator);
+}
+
+// The same as TestBenchBaseRecorder::RecordTime().
+void AddRecordTime(rapidjson::Value& value, int64_t time_in_ms,
+                   rapidjson::Document::AllocatorType& allocator) {
+  rapidjson::Value time_val;
+  time_val.SetString(std::to_string(time_in_ms / 1000).c_str(), allocator);
+  value.AddMember(rapidjson::StringRef(kParamRecordTime), time_val, allocator);
+  value.AddMember(rapidjson::StringRef(kParamRecordMillisecond),
+                  rapidjson::Value(time_in_ms), allocator);
+}
+
+bool ReadStringValue(BinaryRecordDecoder& decoder, rapidjson::Value* value,
+                     rapidjson::Document::AllocatorType& allocator) {
+  std::string str;
+  if (!decoder.ReadString(&str)) {
+    return false;
+  }
+  value->SetString(str.c_str(), static_cast<rapidjson::SizeType>(str.length()),
+                   allocator);
+  return true;
+}
+
+}  // namespace
+
+bool ConvertBinaryRecordsToJSON(
+    const uint8_t* data, size_t size,
+    std::map<int64_t, rapidjson::Document>& documents) {
+  BinaryRecordDecoder decoder(data, size);
+  if (!decoder.ReadHeader()) {
+    return false;
+  }
+
+  // The scripts are shared by all the documents.
+  std::vector<std::pair<std::string, std::string>> scripts;
+  BinaryRecordDecoder body(nullptr, 0);
+  while (decoder.ReadRecord(&body)) {
+    uint64_t type;
+    int64_t record_id;
+    int64_t time_in_ms;
+    if (!body.ReadVarint(&type) || !body.ReadSignedVarint(&record_id) ||
+        !body.ReadSignedVarint(&time_in_ms)) {
+      return false;
+    }
+    auto it = documents.find(record_id);
+    // Only the actions create the document of a record id, the same as
+    // TestBenchBaseRecorder.
+    if (it == documents.end() &&
+        type == static_cast<uint64_t>(BinaryRecordType::kAction)) {
+      it = documents.emplace(record_id, rapidjson::Document()).first;
+      CreateRecordedFile(it->second);
+    }
+
+    switch (static_cast<BinaryRecordType>(type)) {
+      case BinaryRecordType::kAction: {
+        auto& allocator = it->second.GetAllocator();
+        rapidjson::Value function_name;
+        rapidjson::Value params;
+        if (!ReadStringValue(body, &function_name, allocator) ||
+            !body.ReadValue(&params, allocator)) {
+          return false;
+        }
+        rapidjson::Value val(rapidjson::kObjectType);
+        val.AddMember(rapidjson::StringRef(kFunctionName), function_name,
+                      allocator);
+        AddRecordTime(val, time_in_ms, allocator);
+        val.AddMember(rapidjson::StringRef(kParams), params, allocator);
+        it->second[kActionList].PushBack(val, allocator);
+        break;
+      }
+      case BinaryRecordType::kInvokedMethod:
+      case BinaryRecordType::kCallback: {
+        if (it == documents.end()) {
+          break;
+        }
+        auto& allocator = it->second.GetAllocator();
+        rapidjson::Value module_name;
+        rapidjson::Value method_name;
+        int64_t callback_id = 0;
+        rapidjson::Value params;
+        if (!ReadStringValue(body, &module_name, allocator) ||
+            !ReadStringValue(body, &method_name, allocator) ||
+            (type == static_cast<uint64_t>(BinaryRecordType::kCallback) &&
+             !body.ReadSignedVarint(&callback_id)) ||
+            !body.ReadValue(&params, allocator)) {
+          return false;
+        }
+        rapidjson::Value val(rapidjson::kObjectType);
+        val.AddMember(rapidjson::StringRef(kModuleName), module_name,
+                      allocator);
+        val.AddMember(rapidjson::StringRef(kMethodName), method_name,
+                      allocator);
+        AddRecordTime(val, time_in_ms, allocator);
+        val.AddMember(rapidjson::StringRef(kParams), params, allocator);
+        if (type == static_cast<uint64_t>(BinaryRecordType::kCallback)) {
+          rapidjson::Value callback;
+          callback.SetString(std::to_string(callback_id).c_str(), allocator);
+          it->second[kCallback].AddMember(callback, val, allocator);
+        } else {
+          it->second[kInvokedMethodData].PushBack(val, allocator);
+        }
+        break;
+      }
+      case BinaryRecordType::kComponent: {
+        if (it == documents.end()) {
+          break;
+        }
+        auto& allocator = it->second.GetAllocator();
+        rapidjson::Value component_name;
+        int64_t component_type;
+        if (!ReadStringValue(body, &component_name, allocator) ||
+            !body.ReadSignedVarint(&component_type)) {
+          return false;
+        }
+        rapidjson::Value val(rapidjson::kObjectType);
+        val.AddMember(rapidjson::StringRef(kComponentName), component_name,
+                      allocator);
+        val.AddMember(rapidjson::StringRef(kComponentType),
+                      rapidjson::Value(static_cast<int>(component_type)),
+                      allocator);
+        it->second[kComponentList].PushBack(val, allocator);
+        break;
+      }
+      case BinaryRecordType::kScript: {
+        std::string url;
+        std::string source;
+        if (!body.ReadString(&url) || !body.ReadString(&source)) {
+          return false;
+        }
+        scripts.emplace_back(std::move(url), std::move(source));
+        break;
+      }
+      case BinaryRecordType::kConfig: {
+        if (it == documents.end()) {
+          break;
+        }
+        auto& allocator = it->second.GetAllocator();
+        rapidjson::Value config;
+        if (!body.ReadValue(&config, allocator)) {
+          return false;
+        }
+        it->second.RemoveMember(kConfig);
+        it->second.AddMember(rapidjson::StringRef(kConfig), config, allocator);
+        break;
+      }
+      default:
+        // Written by a newer recorder.
+        break;
+    }
+  }
+
+  // The sources are compressed and encoded the same as
+  // TestBenchBaseRecorder::RecordScripts(), once for all the documents. A
+  // source failed to compress is left empty.
+  for (auto& script : scripts) {
+    unsigned long compressed_size;
+    std::unique_ptr<uint8_t[]> compressed_data = Compress(
+        script.second.c_str(), script.second.length(), &compressed_size);
+    if (compressed_data == nullptr) {
+      script.second.clear();
+      continue;
+    }
+    unsigned long base64_size;
+    std::unique_ptr<char[]> base64_data =
+        ModpB64Encode(reinterpret_cast<const char*>(compressed_data.get()),
+                      compressed_size, &base64_size);
+    script.second.assign(base64_data.get(), base64_size);
+  }
+
+  for (auto& pair : documents) {
+    auto& allocator = pair.second.GetAllocator();
+    rapidjson::Value scripts_table(rapidjson::kObjectType);
+    for (const auto& script : scripts) {
+      scripts_table.AddMember(
+          rapidjson::Value(script.first.c_str(), allocator),
+          rapidjson::Value(script.second.c_str(),
+                           static_cast<rapidjson::SizeType>(
+                               script.second.length()),
+                           allocator),
+          allocator);
+    }
+    pair.second.AddMember(rapidjson::StringRef(kScripts), scripts_table,
+                          allocator);
+  }
+  return decoder.AtEnd();
+}
+
+std::string EncodeRecordedFile(const rapidjson::Value& document) {
+  rapidjson::StringBuffer os;
+  rapidjson::Writer<rapidjson::StringBuffer, rapidjson::UTF8<>,
+                    rapidjson::UTF8<>, rapidjson::CrtAllocator,
+                    rapidjson::kWriteNanAndInfFlag>
+      writer(os);
+  document.Accept(writer);
+  unsigned long compressed_size;
+  std::unique_ptr<uint8_t[]> compressed_data =
+      Compress(os.GetString(), os.GetSize(), &compressed_size);
+  if (compressed_data == nullptr) {
+    return std::string();
+  }
+  unsigned long base64_size;
+  std::unique_ptr<char[]> base64_data =
+      ModpB64Encode(reinterpret_cast<const char*>(compressed_data.get()),
+                    compressed_size, &base64_size);
+  return std::string(base64_data.get(), base64_size);
+}
+
+}  // namespace recorder
+}  // namespace tasm
+}  // namespace lynx
@@ -0,0 +1,130 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_SERVICES_RECORDER_BINARY_RECORD_FORMAT_H_
+#define CORE_SERVICES_RECORDER_BINARY_RECORD_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "third_party/rapidjson/document.h"
+
+namespace lynx {
+namespace tasm {
+namespace recorder {
+
+// The binary format of the records of TestBenchBaseRecorder, which is cheaper
+// to write than the json document and is streamed to the file while
+// recording.
+//
+// A file starts with kBinaryRecordMagic and the version as a little-endian
+// uint32, followed by the records. A record is the size of its body as a
+// little-endian uint32, then the body: the BinaryRecordType, the record id
+// and the time in milliseconds as signed varints, and the fields of the type.
+// Records of unknown types are skipped by the size.
+constexpr char kBinaryRecordMagic[4] = {'L', 'X', 'R', 'C'};
+constexpr uint32_t kBinaryRecordVersion = 1;
+constexpr size_t kBinaryRecordHeaderSize = 8;
+constexpr const char* kBinaryRecordFileName = "record.lynxrec";
+
+enum class BinaryRecordType : uint8_t {
+  // Function name, params.
+  kAction = 1,
+  // Module name, method name, params.
+  kInvokedMethod = 2,
+  // Module name, method name, callback id, params.
+  kCallback = 3,
+  // Component name, component type.
+  kComponent = 4,
+  // Url, source.
+  kScript = 5,
+  // The replay config of the record id.
+  kConfig = 6,
+};
+
+// Encodes a record into a buffer, which is cleared by BeginRecord().
+class BinaryRecordEncoder {
+ public:
+  explicit BinaryRecordEncoder(std::vector<uint8_t>& buffer)
+      : buffer_(buffer) {}
+
+  static void WriteHeader(std::vector<uint8_t>& buffer);
+
+  void BeginRecord(BinaryRecordType type, int64_t record_id,
+                   int64_t time_in_ms);
+  void EndRecord();
+
+  void WriteVarint(uint64_t value);
+  void WriteSignedVarint(int64_t value);
+  void WriteDouble(double value);
+  void WriteString(const char* str, size_t length);
+  void WriteString(const std::string& str) {
+    WriteString(str.c_str(), str.length());
+  }
+  void WriteValue(const rapidjson::Value& value);
+
+ private:
+  void WriteFixed32(uint32_t value, size_t offset);
+
+  std::vector<uint8_t>& buffer_;
+};
+
+class BinaryRecordDecoder {
+ public:
+  BinaryRecordDecoder(const uint8_t* data, size_t size)
+      : data_(data), size_(size) {}
+
+  bool ReadHeader();
+
+  // Returns a decoder of the body of the next record, or false at the end or
+  // if the record is truncated.
+  bool ReadRecord(BinaryRecordDecoder* body);
+
+  bool ReadVarint(uint64_t* value);
+  bool ReadSignedVarint(int64_t* value);
+  bool ReadDouble(double* value);
+  bool ReadString(std::string* str);
+  bool ReadValue(rapidjson::Value* value,
+                 rapidjson::Document::AllocatorType& allocator) {
+    return ReadValue(value, allocator, 0);
+  }
+
+  bool AtEnd() const { return offset_ == size_; }
+
+ private:
+  bool ReadValue(rapidjson::Value* value,
+                 rapidjson::Document::AllocatorType& allocator, int depth);
+
+  const uint8_t* data_;
+  size_t size_;
+  size_t offset_ = 0;
+};
+
+// Converts the binary records into the json documents written by
+// TestBenchBaseRecorder, one for each record id, so that they are replayed
+// the same as the recorded json files. Returns false if the data is not in
+// the binary format or a record is malformed, in which case the documents
+// hold the records before it.
+bool ConvertBinaryRecordsToJSON(
+    const uint8_t* data, size_t size,
+    std::map<int64_t, rapidjson::Document>& documents);
+
+// Returns the content of the recorded json file of the document, which is
+// compressed by zlib and encoded in base64.
+std::string EncodeRecordedFile(const rapidjson::Value& document);
+
+std::unique_ptr<uint8_t[]> Compress(const char* source, size_t source_size,
+                                    unsigned long* compressed_size_in);
+std::unique_ptr<char[]> ModpB64Encode(const char* source, size_t source_size,
+                                      unsigned long* base64_size_in);
+
+}  // namespace recorder
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_SERVICES_RECORDER_BINARY_RECORD_FORMAT_H_
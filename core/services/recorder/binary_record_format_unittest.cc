@@ -0,0 +1,154 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/services/recorder/binary_record_format.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "core/services/recorder/binary_record_writer.h"
+#include "core/services/recorder/recorder_constants.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace recorder {
+
+namespace {
+
+void AppendRecord(std::vector<uint8_t>& file,
+                  const std::vector<uint8_t>& record) {
+  file.insert(file.end(), record.begin(), record.end());
+}
+
+rapidjson::Value CreateParams(rapidjson::Document::AllocatorType& allocator) {
+  rapidjson::Value params(rapidjson::kObjectType);
+  params.AddMember("int", -3, allocator);
+  params.AddMember("uint", UINT64_MAX, allocator);
+  params.AddMember("double", 1.5, allocator);
+  params.AddMember("bool", true, allocator);
+  params.AddMember("null", rapidjson::Value(), allocator);
+  rapidjson::Value array(rapidjson::kArrayType);
+  array.PushBack(rapidjson::Value("item", allocator), allocator);
+  params.AddMember("array", array, allocator);
+  return params;
+}
+
+}  // namespace
+
+TEST(BinaryRecordFormat, ConvertToJSON) {
+  rapidjson::Document params_doc;
+  rapidjson::Value params = CreateParams(params_doc.GetAllocator());
+
+  std::vector<uint8_t> file;
+  BinaryRecordEncoder::WriteHeader(file);
+  std::vector<uint8_t> record;
+  BinaryRecordEncoder encoder(record);
+
+  // Not recorded since the view has no action yet.
+  encoder.BeginRecord(BinaryRecordType::kComponent, 1, 0);
+  encoder.WriteString("component");
+  encoder.WriteSignedVarint(0);
+  encoder.EndRecord();
+  AppendRecord(file, record);
+
+  encoder.BeginRecord(BinaryRecordType::kAction, 1, 1700000000123);
+  encoder.WriteString(kFuncLoadTemplate);
+  encoder.WriteValue(params);
+  encoder.EndRecord();
+  AppendRecord(file, record);
+
+  encoder.BeginRecord(BinaryRecordType::kCallback, 1, 0);
+  encoder.WriteString("module");
+  encoder.WriteString("method");
+  encoder.WriteSignedVarint(7);
+  encoder.WriteValue(params);
+  encoder.EndRecord();
+  AppendRecord(file, record);
+
+  encoder.BeginRecord(BinaryRecordType::kScript, kRecordIDForGlobalEvent, 0);
+  encoder.WriteString("url");
+  encoder.WriteString("content");
+  encoder.EndRecord();
+  AppendRecord(file, record);
+
+  std::map<int64_t, rapidjson::Document> documents;
+  ASSERT_TRUE(ConvertBinaryRecordsToJSON(file.data(), file.size(), documents));
+  ASSERT_EQ(documents.size(), 1);
+  rapidjson::Document& document = documents[1];
+
+  rapidjson::Value& action_list = document[kActionList];
+  ASSERT_EQ(action_list.Size(), 1);
+  rapidjson::Value& action = action_list[0];
+  EXPECT_STREQ(action[kFunctionName].GetString(), kFuncLoadTemplate);
+  EXPECT_STREQ(action[kParamRecordTime].GetString(), "1700000000");
+  EXPECT_EQ(action[kParamRecordMillisecond].GetInt64(), 1700000000123);
+  EXPECT_TRUE(action[kParams] == params);
+
+  EXPECT_EQ(document[kComponentList].Size(), 0);
+  ASSERT_TRUE(document[kCallback].HasMember("7"));
+  EXPECT_STREQ(document[kCallback]["7"][kModuleName].GetString(), "module");
+
+  // The same as TestBenchBaseRecorder::RecordScripts().
+  EXPECT_STREQ(document[kScripts]["url"].GetString(), "eJxLzs8rSc0rAQALywL8");
+}
+
+TEST(BinaryRecordFormat, Malformed) {
+  std::map<int64_t, rapidjson::Document> documents;
+  const uint8_t json[] = "{}";
+  EXPECT_FALSE(ConvertBinaryRecordsToJSON(json, sizeof(json), documents));
+
+  std::vector<uint8_t> file;
+  BinaryRecordEncoder::WriteHeader(file);
+  std::vector<uint8_t> record;
+  BinaryRecordEncoder encoder(record);
+  encoder.BeginRecord(BinaryRecordType::kAction, 1, 0);
+  encoder.WriteString(kFuncLoadTemplate);
+  encoder.WriteValue(rapidjson::Value(rapidjson::kObjectType));
+  encoder.EndRecord();
+  AppendRecord(file, record);
+  AppendRecord(file, record);
+  // Truncated.
+  file.pop_back();
+  EXPECT_FALSE(ConvertBinaryRecordsToJSON(file.data(), file.size(), documents));
+  EXPECT_EQ(documents[1][kActionList].Size(), 1);
+}
+
+TEST(BinaryRecordWriter, WriteAndDrop) {
+  std::string path = ::testing::TempDir() + kBinaryRecordFileName;
+  std::vector<uint8_t> record;
+  BinaryRecordEncoder encoder(record);
+  encoder.BeginRecord(BinaryRecordType::kAction, 1, 0);
+  encoder.WriteString(kFuncLoadTemplate);
+  encoder.WriteValue(rapidjson::Value(rapidjson::kObjectType));
+  encoder.EndRecord();
+
+  BinaryRecordWriter writer(record.size() * 4);
+  EXPECT_FALSE(writer.Append(record));
+  ASSERT_TRUE(writer.Open(path));
+  size_t written_count = 0;
+  for (int i = 0; i < 100; ++i) {
+    if (writer.Append(record)) {
+      ++written_count;
+    }
+  }
+  writer.Close();
+  EXPECT_EQ(written_count + writer.dropped_count(), 100);
+
+  std::ifstream ifs(path, std::ios::binary);
+  std::vector<uint8_t> file((std::istreambuf_iterator<char>(ifs)),
+                            std::istreambuf_iterator<char>());
+  std::map<int64_t, rapidjson::Document> documents;
+  ASSERT_TRUE(ConvertBinaryRecordsToJSON(file.data(), file.size(), documents));
+  EXPECT_EQ(documents[1][kActionList].Size(), written_count);
+  std::remove(path.c_str());
+}
+
+}  // namespace recorder
+}  // namespace tasm
+}  // namespace lynx
@@ -0,0 +1,120 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/services/recorder/binary_record_writer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "base/include/log/logging.h"
+#include "core/services/recorder/binary_record_format.h"
+
+namespace lynx {
+namespace tasm {
+namespace recorder {
+
+BinaryRecordWriter::BinaryRecordWriter(size_t capacity)
+    : capacity_(capacity), ring_(std::make_unique<uint8_t[]>(capacity)) {}
+
+BinaryRecordWriter::~BinaryRecordWriter() { Close(); }
+
+bool BinaryRecordWriter::Open(const std::string& path) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (open_ || closing_) {
+    return false;
+  }
+  file_ = std::fopen(path.c_str(), "wb");
+  if (file_ == nullptr) {
+    LOGE("BinaryRecordWriter failed to open " << path);
+    return false;
+  }
+  std::vector<uint8_t> header;
+  BinaryRecordEncoder::WriteHeader(header);
+  std::fwrite(header.data(), 1, header.size(), file_);
+  read_offset_ = 0;
+  size_ = 0;
+  dropped_count_ = 0;
+  open_ = true;
+  thread_ = std::thread(&BinaryRecordWriter::Run, this);
+  return true;
+}
+
+bool BinaryRecordWriter::IsOpen() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return open_;
+}
+
+bool BinaryRecordWriter::Append(const std::vector<uint8_t>& record) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!open_) {
+    return false;
+  }
+  if (record.size() > capacity_ - size_) {
+    ++dropped_count_;
+    return false;
+  }
+  size_t write_offset = (read_offset_ + size_) % capacity_;
+  size_t first = std::min(record.size(), capacity_ - write_offset);
+  std::memcpy(ring_.get() + write_offset, record.data(), first);
+  std::memcpy(ring_.get(), record.data() + first, record.size() - first);
+  bool was_empty = size_ == 0;
+  size_ += record.size();
+  if (was_empty) {
+    condition_.notify_one();
+  }
+  return true;
+}
+
+void BinaryRecordWriter::Close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!open_) {
+      return;
+    }
+    open_ = false;
+    closing_ = true;
+  }
+  condition_.notify_one();
+  thread_.join();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::fclose(file_);
+  file_ = nullptr;
+  closing_ = false;
+  if (dropped_count_ != 0) {
+    LOGW("BinaryRecordWriter dropped " << dropped_count_
+                                       << " records, the buffer is full.");
+  }
+}
+
+uint64_t BinaryRecordWriter::dropped_count() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return dropped_count_;
+}
+
+void BinaryRecordWriter::Run() {
+  std::vector<uint8_t> chunk;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return size_ != 0 || closing_; });
+      if (size_ == 0) {
+        return;
+      }
+      // Copy the records out so that the recording threads can append while
+      // the file is written.
+      size_t first = std::min(size_, capacity_ - read_offset_);
+      chunk.assign(ring_.get() + read_offset_,
+                   ring_.get() + read_offset_ + first);
+      chunk.insert(chunk.end(), ring_.get(), ring_.get() + size_ - first);
+      read_offset_ = (read_offset_ + size_) % capacity_;
+      size_ = 0;
+    }
+    std::fwrite(chunk.data(), 1, chunk.size(), file_);
+  }
+}
+
+}  // namespace recorder
+}  // namespace tasm
+}  // namespace lynx
@@ -0,0 +1,73 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_SERVICES_RECORDER_BINARY_RECORD_WRITER_H_
+#define CORE_SERVICES_RECORDER_BINARY_RECORD_WRITER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lynx {
+namespace tasm {
+namespace recorder {
+
+// Streams the binary records to a file on a background thread. The recording
+// threads copy the encoded records into a bounded ring buffer, which is
+// drained by the writer thread, so that recording never waits for the file.
+// A record that does not fit in the free space of the buffer is dropped and
+// counted instead of blocking the recording thread.
+class BinaryRecordWriter {
+ public:
+  static constexpr size_t kDefaultCapacity = 4 * 1024 * 1024;
+
+  explicit BinaryRecordWriter(size_t capacity = kDefaultCapacity);
+  ~BinaryRecordWriter();
+
+  BinaryRecordWriter(const BinaryRecordWriter&) = delete;
+  BinaryRecordWriter& operator=(const BinaryRecordWriter&) = delete;
+
+  // Creates the file with the header and starts the writer thread.
+  bool Open(const std::string& path);
+
+  bool IsOpen() const;
+
+  // Appends a record encoded by BinaryRecordEncoder. Returns false if the
+  // writer is not open or the record is dropped.
+  bool Append(const std::vector<uint8_t>& record);
+
+  // Writes the buffered records and closes the file.
+  void Close();
+
+  uint64_t dropped_count() const;
+
+ private:
+  void Run();
+
+  const size_t capacity_;
+  std::unique_ptr<uint8_t[]> ring_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  // The records in the ring buffer start at read_offset_.
+  size_t read_offset_ = 0;
+  size_t size_ = 0;
+  bool open_ = false;
+  bool closing_ = false;
+  uint64_t dropped_count_ = 0;
+
+  std::FILE* file_ = nullptr;
+  std::thread thread_;
+};
+
+}  // namespace recorder
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_SERVICES_RECORDER_BINARY_RECORD_WRITER_H_
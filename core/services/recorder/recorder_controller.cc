@@ -25,6 +25,13 @@ void RecorderController::StartRecord() {
 #endif
 }
 
+void RecorderController::SetBinaryFormat(bool binary_format) {
+#if ENABLE_TESTBENCH_RECORDER
+  lynx::tasm::recorder::TestBenchBaseRecorder::GetInstance().SetBinaryFormat(
+      binary_format);
+#endif
+}
+
 void RecorderController::EndRecord(
     base::MoveOnlyClosure<void, std::vector<std::string>&,
                           std::vector<int64_t>&>
@@ -28,6 +28,9 @@ class RecorderController {
  public:
   BASE_EXPORT_FOR_DEVTOOL static bool Enable();
   BASE_EXPORT_FOR_DEVTOOL static void StartRecord();
+  // Records in the binary format from the next StartRecord(), which is
+  // converted to the json files at EndRecord().
+  BASE_EXPORT_FOR_DEVTOOL static void SetBinaryFormat(bool binary_format);
   BASE_EXPORT_FOR_DEVTOOL static void EndRecord(
       base::MoveOnlyClosure<void, std::vector<std::string>&,
                             std::vector<int64_t>&>
@@ -4,18 +4,22 @@
 
 #include "core/services/recorder/testbench_base_recorder.h"
 
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <map>
 #include <sstream>
 #include <utility>
 
 #include "base/include/closure.h"
-#include "third_party/modp_b64/modp_b64.h"
+#include "base/include/log/logging.h"
 #include "third_party/rapidjson/filewritestream.h"
 #include "third_party/rapidjson/prettywriter.h"
 #include "third_party/rapidjson/stringbuffer.h"
-#include "third_party/zlib/zlib.h"
 
 #if OS_IOS
 #include <TargetConditionals.h>
@@ -27,30 +31,6 @@ namespace recorder {
 
 thread_local rapidjson::Document dumped_document;
 
-std::unique_ptr<Byte[]> Compress(const char* source, size_t source_size,
-                                 unsigned long* compressed_size_in) {
-  *compressed_size_in = compressBound(source_size);
-  std::unique_ptr<Byte[]> compressed_data =
-      std::make_unique<Byte[]>(*compressed_size_in);
-  int z_result =
-      compress(compressed_data.get(), compressed_size_in,
-               reinterpret_cast<const Cr_z_Bytef*>(source), source_size);
-  if (z_result == Z_OK) {
-    return compressed_data;
-  } else {
-    return nullptr;
-  }
-}
-
-std::unique_ptr<char[]> ModpB64Encode(const char* source, size_t source_size,
-                                      unsigned long* base64_size_in) {
-  *base64_size_in = modp_b64_encode_len(source_size);
-  std::unique_ptr<char[]> base64_data =
-      std::make_unique<char[]>(*base64_size_in);
-  *base64_size_in = modp_b64_encode(base64_data.get(), source, source_size);
-  return base64_data;
-}
-
 TestBenchBaseRecorder::TestBenchBaseRecorder() : thread_("ark_recorder") {
   is_recording_ = false;
 }
@@ -100,12 +80,104 @@ rapidjson::Document::AllocatorType& TestBenchBaseRecorder::GetAllocator() {
   return dumped_document.GetAllocator();
 };
 
-void TestBenchBaseRecorder::StartRecord() { is_recording_ = true; }
+void TestBenchBaseRecorder::StartRecord() {
+  is_recording_ = true;
+  binary_recording_ = false;
+  if (binary_format_) {
+    binary_recording_ =
+        binary_writer_.Open(file_path_ + kBinaryRecordFileName);
+    if (!binary_recording_) {
+      LOGE("TestBenchBaseRecorder failed to open the binary record file, "
+           "records in json instead.");
+    }
+  }
+}
+
+template <typename Callback>
+void TestBenchBaseRecorder::RecordBinary(BinaryRecordType type,
+                                         int64_t record_id,
+                                         Callback write_fields) {
+  // Reused by the records of the thread.
+  thread_local std::vector<uint8_t> buffer;
+  int64_t time_in_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::system_clock::now().time_since_epoch())
+                           .count();
+  BinaryRecordEncoder encoder(buffer);
+  encoder.BeginRecord(type, record_id, time_in_ms);
+  write_fields(encoder);
+  encoder.EndRecord();
+  binary_writer_.Append(buffer);
+}
+
+void TestBenchBaseRecorder::EndBinaryRecord(
+    base::MoveOnlyClosure<void, std::vector<std::string>&,
+                          std::vector<int64_t>&>
+        send_complete) {
+  auto writer_task = [this,
+                      complete_func = std::move(send_complete)]() mutable {
+    if (!is_recording_) {
+      return;
+    }
+    is_recording_ = false;
+    for (auto& config_pair : replay_config_map_) {
+      RecordBinary(BinaryRecordType::kConfig, config_pair.first,
+                   [&config_pair](BinaryRecordEncoder& encoder) {
+                     encoder.WriteValue(config_pair.second);
+                   });
+    }
+    binary_writer_.Close();
+    // Converts to the recorded json files, which are what the devtool and
+    // the replay consume.
+    std::string binary_filename = file_path_ + kBinaryRecordFileName;
+    std::vector<uint8_t> data;
+    {
+      std::ifstream ifs(binary_filename, std::ios::binary | std::ios::in);
+      data.assign(std::istreambuf_iterator<char>(ifs),
+                  std::istreambuf_iterator<char>());
+    }
+    std::remove(binary_filename.c_str());
+    std::map<int64_t, rapidjson::Document> documents;
+    if (!ConvertBinaryRecordsToJSON(data.data(), data.size(), documents)) {
+      LOGE("TestBenchBaseRecorder failed to convert the binary records, "
+           "dropped count: "
+           << binary_writer_.dropped_count());
+    }
+    std::vector<std::string> filenames;
+    std::vector<int64_t> sessions;
+    for (const auto& document_pair : documents) {
+      int64_t shell_id = document_pair.first;
+      std::string filename = file_path_ + std::to_string(shell_id) + ".json";
+      {
+        std::ofstream ifs;
+        ifs.open(filename, std::ios::binary | std::ios::out);
+        if (ifs.is_open()) {
+          std::string content = EncodeRecordedFile(document_pair.second);
+          ifs.write(content.data(), content.size());
+          ifs.flush();
+          ifs.close();
+        }
+      }
+      auto session_iter = session_ids_.find(shell_id);
+      sessions.push_back(session_iter != session_ids_.end()
+                             ? session_iter->second
+                             : -1);
+      filenames.push_back(filename);
+    }
+    complete_func(filenames, sessions);
+    this->Clear();
+  };
+
+  thread_.GetTaskRunner()->PostTask(std::move(writer_task));
+}
 
 void TestBenchBaseRecorder::EndRecord(
     base::MoveOnlyClosure<void, std::vector<std::string>&,
                           std::vector<int64_t>&>
         send_complete) {
+  if (binary_recording_) {
+    EndBinaryRecord(std::move(send_complete));
+    return;
+  }
   auto writer_task = [this,
                       complete_func = std::move(send_complete)]() mutable {
     if (!is_recording_) {
@@ -127,23 +199,9 @@ void TestBenchBaseRecorder::EndRecord(
           doc.AddMember(rapidjson::StringRef(kScripts), scripts_table_,
                         allocator);
           doc.AddMember(rapidjson::StringRef(kConfig), config, allocator);
-          rapidjson::StringBuffer os;
-          rapidjson::Writer<rapidjson::StringBuffer, rapidjson::UTF8<>,
-                            rapidjson::UTF8<>, rapidjson::CrtAllocator,
-                            rapidjson::kWriteNanAndInfFlag>
-              writer(os);
-          doc.Accept(writer);
-          unsigned long compressed_size;
-          std::unique_ptr<Byte[]> compressed_data =
-              Compress(os.GetString(), os.GetSize(), &compressed_size);
-          if (compressed_data != nullptr) {
-            unsigned long base64_size;
-            std::unique_ptr<char[]> base64_data = ModpB64Encode(
-                reinterpret_cast<const char*>(compressed_data.get()),
-                compressed_size, &base64_size);
-            ifs.write(base64_data.get(), base64_size);
-            ifs.flush();
-          }
+          std::string content = EncodeRecordedFile(doc);
+          ifs.write(content.data(), content.size());
+          ifs.flush();
           ifs.close();
         }
       }
@@ -170,6 +228,14 @@ void TestBenchBaseRecorder::AddLynxViewSessionID(int64_t record_id,
 void TestBenchBaseRecorder::RecordAction(const char* function_name,
                                          rapidjson::Value& params,
                                          int64_t record_id) {
+  if (binary_recording_) {
+    RecordBinary(BinaryRecordType::kAction, record_id,
+                 [function_name, &params](BinaryRecordEncoder& encoder) {
+                   encoder.WriteString(function_name, strlen(function_name));
+                   encoder.WriteValue(params);
+                 });
+    return;
+  }
   auto record_action_task =
       [this, function_name = std::string(function_name), record_id,
        params = rapidjson::Value(params, GetAllocator())]() {
@@ -214,6 +280,16 @@ void TestBenchBaseRecorder::RecordInvokedMethodData(const char* module_name,
                                                     const char* method_name,
                                                     rapidjson::Value& params,
                                                     int64_t record_id) {
+  if (binary_recording_) {
+    RecordBinary(
+        BinaryRecordType::kInvokedMethod, record_id,
+        [module_name, method_name, &params](BinaryRecordEncoder& encoder) {
+          encoder.WriteString(module_name, strlen(module_name));
+          encoder.WriteString(method_name, strlen(method_name));
+          encoder.WriteValue(params);
+        });
+    return;
+  }
   auto record_invoked_method_task =
       [this, module_name = std::string(module_name),
        method_name = std::string(method_name),
@@ -263,6 +339,17 @@ void TestBenchBaseRecorder::RecordCallback(const char* module_name,
                                            rapidjson::Value& params,
                                            int64_t callback_id,
                                            int64_t record_id) {
+  if (binary_recording_) {
+    RecordBinary(BinaryRecordType::kCallback, record_id,
+                 [module_name, method_name, callback_id,
+                  &params](BinaryRecordEncoder& encoder) {
+                   encoder.WriteString(module_name, strlen(module_name));
+                   encoder.WriteString(method_name, strlen(method_name));
+                   encoder.WriteSignedVarint(callback_id);
+                   encoder.WriteValue(params);
+                 });
+    return;
+  }
   auto record_callback_task = [this, module_name = std::string(module_name),
                                method_name = std::string(method_name),
                                params =
@@ -308,6 +395,14 @@ void TestBenchBaseRecorder::RecordCallback(const char* module_name,
 
 void TestBenchBaseRecorder::RecordComponent(const char* component_name,
                                             int type, int64_t record_id) {
+  if (binary_recording_) {
+    RecordBinary(BinaryRecordType::kComponent, record_id,
+                 [component_name, type](BinaryRecordEncoder& encoder) {
+                   encoder.WriteString(component_name, strlen(component_name));
+                   encoder.WriteSignedVarint(type);
+                 });
+    return;
+  }
   auto record_component_task =
       [this, component_name = std::string(component_name), type, record_id]() {
         if (!is_recording_) {
@@ -340,6 +435,15 @@ void TestBenchBaseRecorder::RecordComponent(const char* component_name,
 }
 
 void TestBenchBaseRecorder::RecordScripts(const char* url, const char* source) {
+  if (binary_recording_) {
+    // The sources are compressed by the converter, not the recording thread.
+    RecordBinary(BinaryRecordType::kScript, kRecordIDForGlobalEvent,
+                 [url, source](BinaryRecordEncoder& encoder) {
+                   encoder.WriteString(url, strlen(url));
+                   encoder.WriteString(source, strlen(source));
+                 });
+    return;
+  }
   auto record_scripts_task = [this, url = std::string(url),
                               source = std::string(source)]() {
     if (!is_recording_) {
@@ -353,7 +457,7 @@ void TestBenchBaseRecorder::RecordScripts(const char* url, const char* source) {
     rapidjson::Value source_val(rapidjson::kStringType);
 
     unsigned long compressed_size;
-    std::unique_ptr<Byte[]> compressed_data =
+    std::unique_ptr<uint8_t[]> compressed_data =
         Compress(source.c_str(), source.length(), &compressed_size);
     if (compressed_data != nullptr) {
       unsigned long base64_size;
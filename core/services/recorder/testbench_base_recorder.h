@@ -14,6 +14,8 @@
 #include "base/include/closure.h"
 #include "base/include/fml/thread.h"
 #include "base/include/no_destructor.h"
+#include "core/services/recorder/binary_record_format.h"
+#include "core/services/recorder/binary_record_writer.h"
 #include "core/services/recorder/recorder_constants.h"
 #include "third_party/rapidjson/document.h"
 
@@ -45,6 +47,11 @@ class TestBenchBaseRecorder {
   void SetScreenSize(int64_t record_id, float screen_width,
                      float screen_height);
   void AddLynxViewSessionID(int64_t record_id, int64_t session);
+  // Records in the binary format, see binary_record_format.h, which is
+  // streamed to kBinaryRecordFileName under the recorder path and converted
+  // to the recorded json files at EndRecord(). Takes effect from the next
+  // StartRecord(), which falls back to json if the file fails to open.
+  void SetBinaryFormat(bool binary_format) { binary_format_ = binary_format; }
   void StartRecord();
   void EndRecord(base::MoveOnlyClosure<void, std::vector<std::string>&,
                                        std::vector<int64_t>&>
@@ -58,6 +65,14 @@ class TestBenchBaseRecorder {
   TestBenchBaseRecorder& operator=(const TestBenchBaseRecorder&) = delete;
 
   void RecordTime(rapidjson::Value& val);
+  // Encodes a record on the calling thread and appends it to the binary
+  // writer.
+  template <typename Callback>
+  void RecordBinary(BinaryRecordType type, int64_t record_id,
+                    Callback write_fields);
+  void EndBinaryRecord(base::MoveOnlyClosure<void, std::vector<std::string>&,
+                                             std::vector<int64_t>&>
+                           send_complete);
   rapidjson::Value& GetRecordedFileField(int64_t record_id,
                                          const std::string& filed_name);
   rapidjson::Value& GetRecordedFile(int64_t record_id);
@@ -75,6 +90,10 @@ class TestBenchBaseRecorder {
   std::unordered_map<int64_t, std::string> url_map_;
   std::unordered_map<int64_t, int64_t> session_ids_;
   fml::Thread thread_;
+  bool binary_format_ = false;
+  // Whether the current recording is in the binary format.
+  bool binary_recording_ = false;
+  BinaryRecordWriter binary_writer_;
   void RecordActionKernel(const char* function_name, rapidjson::Value params,
                           int64_t record_id,
                           rapidjson::Document::AllocatorType& allocator);
@@ -7,7 +7,11 @@
 #include "core/services/recorder/testbench_base_recorder.h"
 #undef private
 
+#include <cstdio>
+#include <fstream>
 #include <mutex>
+#include <string>
+#include <vector>
 
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
 
@@ -271,6 +275,60 @@ TEST(TestBenchBaseRecorder, RecordComponent) {
   ark.Clear();
 }
 
+TEST(TestBenchBaseRecorder, BinaryRecordFallsBackToJson) {
+  TestBenchBaseRecorder& ark = TestBenchBaseRecorder::GetInstance();
+  ark.SetRecorderPath("/not/exist/path");
+  ark.SetBinaryFormat(true);
+  ark.StartRecord();
+  EXPECT_TRUE(ark.is_recording_);
+  EXPECT_FALSE(ark.binary_recording_);
+
+  int64_t record_id = 1;
+  rapidjson::Value params(rapidjson::kObjectType);
+  ark.RecordAction("TestFunction", params, record_id);
+  wait(ark.thread_);
+  EXPECT_EQ(ark.GetRecordedFileField(record_id, kActionList).Size(), 1);
+  ark.SetBinaryFormat(false);
+  ark.Clear();
+}
+
+TEST(TestBenchBaseRecorder, BinaryRecordEndsInJson) {
+  TestBenchBaseRecorder& ark = TestBenchBaseRecorder::GetInstance();
+  std::string path = ::testing::TempDir();
+  ark.SetRecorderPath(path);
+  ark.SetBinaryFormat(true);
+  ark.StartRecord();
+  ASSERT_TRUE(ark.binary_recording_);
+
+  int64_t record_id = 2;
+  ark.AddLynxViewSessionID(record_id, 10);
+  rapidjson::Value params(rapidjson::kObjectType);
+  ark.RecordAction("TestFunction", params, record_id);
+
+  std::vector<std::string> recorded_files;
+  std::vector<int64_t> recorded_sessions;
+  ark.EndRecord([&recorded_files, &recorded_sessions](
+                    std::vector<std::string>& files,
+                    std::vector<int64_t>& sessions) {
+    recorded_files = files;
+    recorded_sessions = sessions;
+  });
+  wait(ark.thread_);
+
+  ASSERT_EQ(recorded_files.size(), 1u);
+  EXPECT_EQ(recorded_files[0], ark.file_path_ + "2.json");
+  ASSERT_EQ(recorded_sessions.size(), 1u);
+  EXPECT_EQ(recorded_sessions[0], 10);
+  std::ifstream json_file(recorded_files[0]);
+  EXPECT_TRUE(json_file.good());
+  std::ifstream binary_file(ark.file_path_ + kBinaryRecordFileName);
+  EXPECT_FALSE(binary_file.good());
+
+  std::remove(recorded_files[0].c_str());
+  ark.SetBinaryFormat(false);
+  ark.Clear();
+}
+
 }  // namespace recorder
 }  // namespace tasm
 }  // namespace lynx
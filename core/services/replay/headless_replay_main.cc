@@ -0,0 +1,152 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+// Replays a recorded session headless for N times and reports the time spent
+// in each phase of the pipeline, e.g.
+//   headless_replay_benchmark --session=record.json --bundle=template.js \
+//       --iterations=20
+// The session is a decoded recorded json file or a binary record file. The
+// bundle replaces the recorded template bundle, and is optional.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "core/runtime/vm/lepus/binary_input_stream.h"
+#include "core/services/replay/headless_replay_runner.h"
+
+namespace {
+
+constexpr char kSessionFlag[] = "--session=";
+constexpr char kBundleFlag[] = "--bundle=";
+constexpr char kIterationsFlag[] = "--iterations=";
+constexpr char kWidthFlag[] = "--width=";
+constexpr char kHeightFlag[] = "--height=";
+
+// The file is mapped and copied once, which is faster than reading it through
+// a stream byte by byte. The engine takes the ownership of the bytes it
+// loads, so they can not be decoded from the mapping in place.
+bool ReadFile(const std::string& path, std::vector<uint8_t>& data) {
+  auto buffer = lynx::lepus::MappedBuffer::MapFile(path.c_str());
+  if (buffer == nullptr) {
+    return false;
+  }
+  data.assign(buffer->data, buffer->data + buffer->size);
+  return true;
+}
+
+bool MatchFlag(const char* arg, const char* flag, const char** value) {
+  size_t length = std::strlen(flag);
+  if (std::strncmp(arg, flag, length) != 0) {
+    return false;
+  }
+  *value = arg + length;
+  return true;
+}
+
+void PrintUsage() {
+  std::fprintf(stderr,
+               "Usage: headless_replay_benchmark --session=<path> "
+               "[--bundle=<path>] [--iterations=<n>] [--width=<px>] "
+               "[--height=<px>]\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  using lynx::tasm::replay::ReplayPhase;
+  using lynx::tasm::replay::ReplayPhaseTimings;
+
+  std::string session_path;
+  std::string bundle_path;
+  int iterations = 10;
+  lynx::tasm::replay::HeadlessReplayOptions options;
+  for (int i = 1; i < argc; ++i) {
+    const char* value = nullptr;
+    if (MatchFlag(argv[i], kSessionFlag, &value)) {
+      session_path = value;
+    } else if (MatchFlag(argv[i], kBundleFlag, &value)) {
+      bundle_path = value;
+    } else if (MatchFlag(argv[i], kIterationsFlag, &value)) {
+      iterations = std::max(1, std::atoi(value));
+    } else if (MatchFlag(argv[i], kWidthFlag, &value)) {
+      options.screen_width = std::atoi(value);
+    } else if (MatchFlag(argv[i], kHeightFlag, &value)) {
+      options.screen_height = std::atoi(value);
+    } else {
+      PrintUsage();
+      return 1;
+    }
+  }
+  if (session_path.empty()) {
+    PrintUsage();
+    return 1;
+  }
+
+  lynx::tasm::replay::HeadlessReplayRunner runner(options);
+  std::vector<uint8_t> session;
+  if (!ReadFile(session_path, session) || !runner.LoadSession(session)) {
+    std::fprintf(stderr, "Failed to load the session %s\n",
+                 session_path.c_str());
+    return 1;
+  }
+  if (!bundle_path.empty()) {
+    std::vector<uint8_t> bundle;
+    if (!ReadFile(bundle_path, bundle)) {
+      std::fprintf(stderr, "Failed to read the bundle %s\n",
+                   bundle_path.c_str());
+      return 1;
+    }
+    runner.SetTemplateBundle(std::move(bundle));
+  }
+
+  // The durations of each phase in every iteration, in microseconds. The last
+  // one is the wall time of the iteration.
+  constexpr size_t kColumnCount = ReplayPhaseTimings::kPhaseCount + 1;
+  std::vector<std::array<uint64_t, kColumnCount>> results(iterations);
+  for (int i = 0; i < iterations; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    const ReplayPhaseTimings& timings = runner.Replay();
+    auto end = std::chrono::steady_clock::now();
+    for (size_t phase = 0; phase < ReplayPhaseTimings::kPhaseCount; ++phase) {
+      results[i][phase] =
+          timings.GetDuration(static_cast<ReplayPhase>(phase));
+    }
+    results[i][kColumnCount - 1] =
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+            .count();
+  }
+
+  std::printf("Replayed %zu actions (%zu skipped) for %d iterations.\n",
+              runner.action_count(), runner.skipped_action_count(),
+              iterations);
+  std::printf("%-16s %12s %12s %12s %12s\n", "phase(us)", "mean", "median",
+              "min", "max");
+  for (size_t column = 0; column < kColumnCount; ++column) {
+    std::vector<uint64_t> durations;
+    durations.reserve(iterations);
+    uint64_t total = 0;
+    for (const auto& result : results) {
+      durations.push_back(result[column]);
+      total += result[column];
+    }
+    std::sort(durations.begin(), durations.end());
+    const char* name =
+        column < ReplayPhaseTimings::kPhaseCount
+            ? ReplayPhaseTimings::GetPhaseName(static_cast<ReplayPhase>(column))
+            : "total";
+    std::printf("%-16s %12" PRIu64 " %12" PRIu64 " %12" PRIu64 " %12" PRIu64
+                "\n",
+                name, total / durations.size(),
+                durations[durations.size() / 2], durations.front(),
+                durations.back());
+  }
+  return 0;
+}
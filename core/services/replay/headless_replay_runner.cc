@@ -0,0 +1,312 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/services/replay/headless_replay_runner.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/include/log/logging.h"
+#include "core/base/threading/task_runner_manufactor.h"
+#include "core/renderer/data/template_data.h"
+#include "core/renderer/lynx_env_config.h"
+#include "core/renderer/ui_wrapper/layout/empty/layout_context_empty_implementation.h"
+#include "core/renderer/ui_wrapper/painting/empty/painting_context_implementation.h"
+#include "core/runtime/vm/lepus/json_parser.h"
+#include "core/services/recorder/binary_record_format.h"
+#include "core/services/recorder/recorder_constants.h"
+#include "core/services/timing_handler/timing_constants.h"
+#include "core/services/timing_handler/timing_handler.h"
+#include "core/shell/lynx_shell.h"
+#include "core/shell/lynx_shell_builder.h"
+#include "core/shell/native_facade_empty_implementation.h"
+#include "third_party/modp_b64/modp_b64.h"
+
+namespace lynx {
+namespace tasm {
+namespace replay {
+
+namespace {
+
+struct PhaseTimingKeys {
+  const char* start;
+  const char* end;
+  ReplayPhase phase;
+};
+
+// The UI operations are executed in two batches, after the tasm and after the
+// layout, which are both counted as the UI operation phase.
+constexpr PhaseTimingKeys kPhaseTimingKeys[] = {
+    {timing::kParseStart, timing::kParseEnd, ReplayPhase::kDecode},
+    {timing::kMtsRenderStart, timing::kMtsRenderEnd,
+     ReplayPhase::kLepusRender},
+    {timing::kResolveStart, timing::kResolveEnd, ReplayPhase::kStyleResolve},
+    {timing::kLayoutStart, timing::kLayoutEnd, ReplayPhase::kLayout},
+    {timing::kPaintingUiOperationExecuteStart,
+     timing::kPaintingUiOperationExecuteEnd, ReplayPhase::kUIOperation},
+    {timing::kLayoutUiOperationExecuteStart,
+     timing::kLayoutUiOperationExecuteEnd, ReplayPhase::kUIOperation},
+};
+
+std::shared_ptr<TemplateData> CreateTemplateData(
+    const rapidjson::Value& value, const rapidjson::Value& params) {
+  if (!value.IsObject()) {
+    return nullptr;
+  }
+  std::string preprocessor_name;
+  if (params.HasMember(recorder::kParamPreprocessorName) &&
+      params[recorder::kParamPreprocessorName].IsString()) {
+    preprocessor_name = params[recorder::kParamPreprocessorName].GetString();
+  }
+  bool read_only = params.HasMember(recorder::kParamReadOnly) &&
+                   params[recorder::kParamReadOnly].IsBool() &&
+                   params[recorder::kParamReadOnly].GetBool();
+  return std::make_shared<TemplateData>(lepus::jsonValueTolepusValue(value),
+                                        read_only, preprocessor_name);
+}
+
+// The tags of the events are recorded with the tag of the root, which is
+// different in the replay.
+int32_t GetReplayTag(shell::LynxShell& shell, const rapidjson::Value& params) {
+  int32_t tag = params[recorder::kEventTag].GetInt();
+  auto* root = shell.GetTasm()->page_proxy()->element_manager()->root();
+  if (root == nullptr || !params.HasMember(recorder::kEventRootTag) ||
+      !params[recorder::kEventRootTag].IsInt()) {
+    return tag;
+  }
+  return root->impl_id() + tag - params[recorder::kEventRootTag].GetInt();
+}
+
+// The getters of rapidjson assert the type of the value, so the members read
+// by them are checked with is_type first.
+bool HasMembersOfType(const rapidjson::Value& params,
+                      std::initializer_list<const char*> names,
+                      bool (rapidjson::Value::*is_type)() const) {
+  for (const char* name : names) {
+    auto it = params.FindMember(name);
+    if (it == params.MemberEnd() || !(it->value.*is_type)()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+const char* ReplayPhaseTimings::GetPhaseName(ReplayPhase phase) {
+  switch (phase) {
+    case ReplayPhase::kDecode:
+      return "decode";
+    case ReplayPhase::kLepusRender:
+      return "lepus_render";
+    case ReplayPhase::kStyleResolve:
+      return "style_resolve";
+    case ReplayPhase::kLayout:
+      return "layout";
+    case ReplayPhase::kUIOperation:
+      return "ui_operation";
+    default:
+      return "";
+  }
+}
+
+void ReplayPhaseTimings::OnTiming(const std::string& timing_key,
+                                  uint64_t us_timestamp,
+                                  const std::string& pipeline_id) {
+  for (const auto& keys : kPhaseTimingKeys) {
+    if (timing_key == keys.start) {
+      start_timestamps_[pipeline_id + keys.start] = us_timestamp;
+      return;
+    }
+    if (timing_key == keys.end) {
+      auto it = start_timestamps_.find(pipeline_id + keys.start);
+      if (it == start_timestamps_.end()) {
+        return;
+      }
+      if (us_timestamp > it->second) {
+        durations_[static_cast<size_t>(keys.phase)] +=
+            us_timestamp - it->second;
+      }
+      start_timestamps_.erase(it);
+      return;
+    }
+  }
+}
+
+void ReplayPhaseTimings::Reset() {
+  start_timestamps_.clear();
+  durations_.fill(0);
+}
+
+HeadlessReplayRunner::HeadlessReplayRunner(
+    const HeadlessReplayOptions& options)
+    : options_(options) {
+  // The calling thread is used as the UI thread, on which all the other
+  // threads are merged with ALL_ON_UI.
+  base::UIThread::Init();
+}
+
+bool HeadlessReplayRunner::LoadSession(const std::vector<uint8_t>& session) {
+  actions_.SetArray();
+  if (session.size() >= recorder::kBinaryRecordHeaderSize &&
+      std::equal(std::begin(recorder::kBinaryRecordMagic),
+                 std::end(recorder::kBinaryRecordMagic), session.begin())) {
+    std::map<int64_t, rapidjson::Document> documents;
+    if (!recorder::ConvertBinaryRecordsToJSON(session.data(), session.size(),
+                                              documents) ||
+        documents.empty()) {
+      LOGE("HeadlessReplayRunner failed to convert the binary records.");
+      return false;
+    }
+    session_.Swap(documents.begin()->second);
+  } else {
+    session_.Parse(reinterpret_cast<const char*>(session.data()),
+                   session.size());
+  }
+  if (session_.HasParseError() || !session_.IsObject() ||
+      !session_.HasMember(recorder::kActionList) ||
+      !session_[recorder::kActionList].IsArray()) {
+    LOGE("HeadlessReplayRunner failed to load the session.");
+    return false;
+  }
+  actions_ = session_[recorder::kActionList].Move();
+  return true;
+}
+
+const ReplayPhaseTimings& HeadlessReplayRunner::Replay() {
+  timings_.Reset();
+  skipped_action_count_ = 0;
+
+  // The timings are observed synchronously since the timing actor runs on the
+  // calling thread as well.
+  auto timing_actor =
+      std::make_shared<shell::LynxActor<timing::TimingHandler>>(
+          std::make_unique<timing::TimingHandler>(),
+          base::UIThread::GetRunner());
+  timing_actor->Impl()->SetTimingObserver(
+      [this](const timing::TimestampKey& timing_key,
+             timing::TimestampUs us_timestamp, const PipelineID& pipeline_id) {
+        timings_.OnTiming(timing_key, us_timestamp, pipeline_id);
+      });
+
+  LynxEnvConfig lynx_env_config(options_.screen_width, options_.screen_height,
+                                options_.layouts_unit_per_px,
+                                options_.physical_pixels_per_layout_unit);
+  shell::ShellOption shell_option;
+  shell_option.enable_js_ = false;
+  std::unique_ptr<shell::LynxShell> shell(
+      shell::LynxShellBuilder()
+          .SetNativeFacade(std::make_unique<shell::NativeFacadeEmptyImpl>())
+          .SetPaintingContextPlatformImpl(
+              std::make_unique<PaintingContextPlatformImpl>())
+          .SetLayoutContextPlatformImpl(
+              std::make_unique<PlatformImplEmptyImpl>())
+          .SetLynxEnvConfig(lynx_env_config)
+          .SetStrategy(base::ThreadStrategyForRendering::ALL_ON_UI)
+          .SetEngineActor([](auto& actor) {})
+          .SetTimingActor(timing_actor)
+          .SetShellOption(shell_option)
+          .build());
+  shell->InitRuntimeWithRuntimeDisabled(nullptr);
+
+  for (auto& action : actions_.GetArray()) {
+    if (!action.IsObject() || !action.HasMember(recorder::kFunctionName) ||
+        !action[recorder::kFunctionName].IsString() ||
+        !action.HasMember(recorder::kParams) ||
+        !action[recorder::kParams].IsObject()) {
+      ++skipped_action_count_;
+      continue;
+    }
+    const std::string function_name =
+        action[recorder::kFunctionName].GetString();
+    const rapidjson::Value& params = action[recorder::kParams];
+
+    if ((function_name == recorder::kFuncLoadTemplate ||
+         function_name == recorder::kFuncLoadTemplateBundle) &&
+        HasMembersOfType(params, {recorder::kParamUrl, recorder::kParamSource},
+                         &rapidjson::Value::IsString)) {
+      std::vector<uint8_t> source = template_bundle_;
+      if (source.empty()) {
+        std::string encoded = params[recorder::kParamSource].GetString();
+        const std::string& decoded = modp_b64_decode(encoded);
+        source.assign(decoded.begin(), decoded.end());
+      }
+      std::shared_ptr<TemplateData> template_data;
+      if (params.HasMember(recorder::kParamTemplateData)) {
+        const auto& data = params[recorder::kParamTemplateData];
+        template_data = CreateTemplateData(data, data);
+      }
+      shell->LoadTemplate(params[recorder::kParamUrl].GetString(),
+                          std::move(source), template_data);
+    } else if (function_name == recorder::kFuncUpdateDataByPreParsedData &&
+               params.HasMember(recorder::kParamValue)) {
+      auto template_data =
+          CreateTemplateData(params[recorder::kParamValue], params);
+      if (template_data == nullptr) {
+        ++skipped_action_count_;
+        continue;
+      }
+      shell->UpdateDataByParsedData(template_data);
+    } else if (function_name == recorder::kFuncSetGlobalProps &&
+               params.HasMember(recorder::kParamGlobalProps)) {
+      shell->UpdateGlobalProps(
+          lepus::jsonValueTolepusValue(params[recorder::kParamGlobalProps]));
+    } else if (function_name == recorder::kFuncUpdateConfig &&
+               params.HasMember(recorder::kParamConfig)) {
+      shell->UpdateConfig(
+          lepus::jsonValueTolepusValue(params[recorder::kParamConfig]));
+    } else if (function_name == recorder::kFuncUpdateFontScale &&
+               params.HasMember(recorder::kFontScale) &&
+               params[recorder::kFontScale].IsNumber()) {
+      shell->UpdateFontScale(params[recorder::kFontScale].GetFloat());
+    } else if (function_name == recorder::kFuncSendTouchEvent &&
+               HasMembersOfType(params, {recorder::kEventName},
+                                &rapidjson::Value::IsString) &&
+               HasMembersOfType(params, {recorder::kEventTag},
+                                &rapidjson::Value::IsInt) &&
+               HasMembersOfType(
+                   params,
+                   {recorder::kEventX, recorder::kEventY,
+                    recorder::kEventClientX, recorder::kEventClientY,
+                    recorder::kEventPageX, recorder::kEventPageY},
+                   &rapidjson::Value::IsNumber)) {
+      shell->SendTouchEvent(params[recorder::kEventName].GetString(),
+                            GetReplayTag(*shell, params),
+                            params[recorder::kEventX].GetFloat(),
+                            params[recorder::kEventY].GetFloat(),
+                            params[recorder::kEventClientX].GetFloat(),
+                            params[recorder::kEventClientY].GetFloat(),
+                            params[recorder::kEventPageX].GetFloat(),
+                            params[recorder::kEventPageY].GetFloat());
+    } else if (function_name == recorder::kFuncSendCustomEvent &&
+               HasMembersOfType(
+                   params, {recorder::kEventName, recorder::kEventParaName},
+                   &rapidjson::Value::IsString) &&
+               HasMembersOfType(params, {recorder::kEventTag},
+                                &rapidjson::Value::IsInt) &&
+               params.HasMember(recorder::kEventParams)) {
+      shell->SendCustomEvent(
+          params[recorder::kEventName].GetString(),
+          GetReplayTag(*shell, params),
+          lepus::jsonValueTolepusValue(params[recorder::kEventParams]),
+          params[recorder::kEventParaName].GetString());
+    } else {
+      ++skipped_action_count_;
+      continue;
+    }
+    // Execute the UI operations of the action, which are flushed by the
+    // platform otherwise.
+    shell->Flush();
+  }
+  return timings_;
+}
+
+}  // namespace replay
+}  // namespace tasm
+}  // namespace lynx
@@ -0,0 +1,104 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_SERVICES_REPLAY_HEADLESS_REPLAY_RUNNER_H_
+#define CORE_SERVICES_REPLAY_HEADLESS_REPLAY_RUNNER_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "third_party/rapidjson/document.h"
+
+namespace lynx {
+namespace tasm {
+namespace replay {
+
+enum class ReplayPhase : uint8_t {
+  kDecode = 0,
+  kLepusRender,
+  kStyleResolve,
+  kLayout,
+  kUIOperation,
+  kCount,
+};
+
+// Accumulates the durations of the pipeline phases from the timestamps marked
+// by the engine, which are paired by the pipeline id.
+class ReplayPhaseTimings {
+ public:
+  static constexpr size_t kPhaseCount =
+      static_cast<size_t>(ReplayPhase::kCount);
+
+  static const char* GetPhaseName(ReplayPhase phase);
+
+  void OnTiming(const std::string& timing_key, uint64_t us_timestamp,
+                const std::string& pipeline_id);
+
+  // The total duration of the phase in microseconds.
+  uint64_t GetDuration(ReplayPhase phase) const {
+    return durations_[static_cast<size_t>(phase)];
+  }
+
+  void Reset();
+
+ private:
+  std::unordered_map<std::string, uint64_t> start_timestamps_;
+  std::array<uint64_t, kPhaseCount> durations_{};
+};
+
+struct HeadlessReplayOptions {
+  int32_t screen_width = 1080;
+  int32_t screen_height = 1920;
+  float layouts_unit_per_px = 1.f;
+  double physical_pixels_per_layout_unit = 1.f;
+};
+
+// Replays the recorded actions of TemplateAssemblerRecorder on a LynxShell
+// with the empty painting and layout platform implementations, so that the
+// engine can be benchmarked with the real sessions on Linux. All the threads
+// of the shell are merged into the calling thread, which becomes the UI
+// thread, and the JS runtime is disabled, so the native module calls of the
+// session are not replayed.
+class HeadlessReplayRunner {
+ public:
+  explicit HeadlessReplayRunner(
+      const HeadlessReplayOptions& options = HeadlessReplayOptions());
+
+  // Loads the session from a recorded json file that has been decoded, or
+  // from a binary record file, in which case the first view is replayed.
+  bool LoadSession(const std::vector<uint8_t>& session);
+
+  // Replaces the sources of the recorded loadTemplate actions, which is used
+  // to compare the template bundles built by different versions.
+  void SetTemplateBundle(std::vector<uint8_t> bundle) {
+    template_bundle_ = std::move(bundle);
+  }
+
+  // Replays the session on a new shell. Returns the timings of the phases,
+  // which are reset on each replay.
+  const ReplayPhaseTimings& Replay();
+
+  size_t action_count() const { return actions_.Size(); }
+  // The number of the actions skipped by the last replay since they can not be
+  // replayed headless.
+  size_t skipped_action_count() const { return skipped_action_count_; }
+
+ private:
+  HeadlessReplayOptions options_;
+  rapidjson::Document session_;
+  rapidjson::Value actions_{rapidjson::kArrayType};
+  std::vector<uint8_t> template_bundle_;
+  ReplayPhaseTimings timings_;
+  size_t skipped_action_count_ = 0;
+};
+
+}  // namespace replay
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_SERVICES_REPLAY_HEADLESS_REPLAY_RUNNER_H_
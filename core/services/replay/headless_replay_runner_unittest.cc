@@ -0,0 +1,109 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/services/replay/headless_replay_runner.h"
+
+#include <string>
+#include <vector>
+
+#include "core/services/timing_handler/timing_constants.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace replay {
+
+TEST(ReplayPhaseTimings, OnTiming) {
+  ReplayPhaseTimings timings;
+  timings.OnTiming(timing::kParseStart, 100, "1");
+  timings.OnTiming(timing::kParseEnd, 150, "1");
+  // Paired by the pipeline id.
+  timings.OnTiming(timing::kLayoutStart, 200, "1");
+  timings.OnTiming(timing::kLayoutStart, 210, "2");
+  timings.OnTiming(timing::kLayoutEnd, 230, "2");
+  timings.OnTiming(timing::kLayoutEnd, 260, "1");
+  // Both batches of the UI operations are counted.
+  timings.OnTiming(timing::kPaintingUiOperationExecuteStart, 300, "1");
+  timings.OnTiming(timing::kPaintingUiOperationExecuteEnd, 305, "1");
+  timings.OnTiming(timing::kLayoutUiOperationExecuteStart, 400, "1");
+  timings.OnTiming(timing::kLayoutUiOperationExecuteEnd, 410, "1");
+  // Ignored without the start.
+  timings.OnTiming(timing::kResolveEnd, 500, "1");
+  timings.OnTiming(timing::kLoadBundleStart, 600, "1");
+
+  EXPECT_EQ(timings.GetDuration(ReplayPhase::kDecode), 50u);
+  EXPECT_EQ(timings.GetDuration(ReplayPhase::kLepusRender), 0u);
+  EXPECT_EQ(timings.GetDuration(ReplayPhase::kStyleResolve), 0u);
+  EXPECT_EQ(timings.GetDuration(ReplayPhase::kLayout), 80u);
+  EXPECT_EQ(timings.GetDuration(ReplayPhase::kUIOperation), 15u);
+
+  timings.Reset();
+  EXPECT_EQ(timings.GetDuration(ReplayPhase::kLayout), 0u);
+  timings.OnTiming(timing::kLayoutEnd, 700, "1");
+  EXPECT_EQ(timings.GetDuration(ReplayPhase::kLayout), 0u);
+}
+
+TEST(HeadlessReplayRunner, LoadSession) {
+  HeadlessReplayRunner runner;
+  std::string invalid = "{\"Config\": {}}";
+  EXPECT_FALSE(runner.LoadSession(
+      std::vector<uint8_t>(invalid.begin(), invalid.end())));
+  EXPECT_EQ(runner.action_count(), 0u);
+
+  std::string session = R"({
+    "Action List": [
+      {"Function Name": "setGlobalProps", "Params": {"global_props": {}}},
+      {"Function Name": "updateConfig",
+       "Params": {"config": {}, "noticeDelegate": true}}
+    ]
+  })";
+  EXPECT_TRUE(runner.LoadSession(
+      std::vector<uint8_t>(session.begin(), session.end())));
+  EXPECT_EQ(runner.action_count(), 2u);
+}
+
+TEST(HeadlessReplayRunner, Replay) {
+  // The actions with the members of wrong types are skipped instead of
+  // asserting in the getters of rapidjson.
+  std::string session = R"({
+    "Action List": [
+      {"Function Name": "loadTemplate",
+       "Params": {"url": "replay.js", "source": "AAAA"}},
+      {"Function Name": "loadTemplate",
+       "Params": {"url": "replay.js", "source": 1}},
+      {"Function Name": "setGlobalProps", "Params": {"global_props": {}}},
+      {"Function Name": "updateConfig", "Params": {"config": {}}},
+      {"Function Name": "updateFontScale", "Params": {"scale": "1"}},
+      {"Function Name": "SendTouchEvent",
+       "Params": {"name": "tap", "tag": 1, "x": "0", "y": 0, "client_x": 0,
+                  "client_y": 0, "page_x": 0, "page_y": 0}},
+      {"Function Name": "SendTouchEvent",
+       "Params": {"name": "tap", "tag": 1.5, "x": 0, "y": 0, "client_x": 0,
+                  "client_y": 0, "page_x": 0, "page_y": 0}},
+      {"Function Name": "SendCustomEvent",
+       "Params": {"name": 1, "tag": 1, "pname": "detail", "params": {}}},
+      {"Function Name": "callJSFunction", "Params": {}},
+      "loadTemplate"
+    ]
+  })";
+  HeadlessReplayRunner runner;
+  ASSERT_TRUE(runner.LoadSession(
+      std::vector<uint8_t>(session.begin(), session.end())));
+  EXPECT_EQ(runner.action_count(), 10u);
+
+  // The bundle replaces the recorded sources. It is a stub that the decoder
+  // rejects, which is reported by the shell without stopping the replay.
+  std::string bundle = "stub bundle";
+  runner.SetTemplateBundle(std::vector<uint8_t>(bundle.begin(), bundle.end()));
+  runner.Replay();
+  EXPECT_EQ(runner.skipped_action_count(), 7u);
+
+  // The count is reset on each replay.
+  runner.Replay();
+  EXPECT_EQ(runner.skipped_action_count(), 7u);
+}
+
+}  // namespace replay
+}  // namespace tasm
+}  // namespace lynx
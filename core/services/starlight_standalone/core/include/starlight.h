@@ -67,6 +67,14 @@ bool IsRTL(const SLNodeRef node);
 void SetDisplay(const SLNodeRef node, SLDisplayType type);
 void SetAspectRatio(const SLNodeRef node, float value);
 
+// attribute
+/**
+ * @brief Set the column count of a node, the same as the column-count
+ * attribute of list. A node with linear display and a column count is laid
+ * out as a staggered grid. A count less than 1 removes the column count.
+ */
+void SetColumnCount(const SLNodeRef node, int32_t count);
+
 // flex
 void SetFlexGrow(const SLNodeRef node, float value);
 void SetFlexShrink(const SLNodeRef node, float value);
@@ -158,6 +166,36 @@ bool HasMeasureDelegate(SLNodeRef node);
  */
 void SetMeasureDelegate(SLNodeRef node, MeasureDelegate* delegate);
 
+// batch
+/**
+ * @brief Set the styles in a packed style blob to a node. The node is marked
+ * dirty once if any of the styles changed.
+ * @return Returns true if any of the styles changed.
+ */
+bool SetStyles(SLNodeRef node, const SLStyleValue* styles, uint32_t count);
+
+/**
+ * @brief Create a tree of nodes in one call.
+ *
+ * @param parent_indices The parent of node i is node parent_indices[i], which
+ * must be less than i, or -1 for a root. Children are appended in order.
+ * @param styles The packed styles of all the nodes, or nullptr if there are no
+ * styles. The styles of node i are styles[style_offsets[i]] to
+ * styles[style_offsets[i + 1]], so style_offsets has count + 1 entries.
+ * @param nodes The created nodes, which has count entries. Users need to free
+ * them with Free.
+ */
+void CreateTree(const LayoutConfig& config, const int32_t* parent_indices,
+                uint32_t count, const SLStyleValue* styles,
+                const uint32_t* style_offsets, SLNodeRef* nodes);
+
+/**
+ * @brief Read the layout results of the nodes into a contiguous array, which
+ * has kSLLayoutResultCount floats per node in the order of
+ * SLLayoutResultIndex.
+ */
+void GetLayoutResults(const SLNodeRef* nodes, uint32_t count, float* results);
+
 }  // namespace starlight
 
 #endif  // CORE_SERVICES_STARLIGHT_STANDALONE_CORE_INCLUDE_STARLIGHT_H_
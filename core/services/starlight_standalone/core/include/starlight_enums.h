@@ -110,6 +110,53 @@ typedef enum StarlightMeasureMode {
   kStarlightMeasureModeAtMost
 } StarlightMeasureMode;
 
+typedef enum SLStyleProperty {
+  kSLStylePropertyDisplay = 0,
+  kSLStylePropertyPosition,
+  kSLStylePropertyDirection,
+  kSLStylePropertyFlexDirection,
+  kSLStylePropertyFlexWrap,
+  kSLStylePropertyJustifyContent,
+  kSLStylePropertyAlignItems,
+  kSLStylePropertyAlignSelf,
+  kSLStylePropertyAlignContent,
+  kSLStylePropertyFlexGrow,
+  kSLStylePropertyFlexShrink,
+  kSLStylePropertyFlexBasis,
+  kSLStylePropertyAspectRatio,
+  kSLStylePropertyWidth,
+  kSLStylePropertyHeight,
+  kSLStylePropertyMinWidth,
+  kSLStylePropertyMinHeight,
+  kSLStylePropertyMaxWidth,
+  kSLStylePropertyMaxHeight,
+  kSLStylePropertyLeft,
+  kSLStylePropertyTop,
+  kSLStylePropertyRight,
+  kSLStylePropertyBottom,
+  kSLStylePropertyMarginLeft,
+  kSLStylePropertyMarginTop,
+  kSLStylePropertyMarginRight,
+  kSLStylePropertyMarginBottom,
+  kSLStylePropertyPaddingLeft,
+  kSLStylePropertyPaddingTop,
+  kSLStylePropertyPaddingRight,
+  kSLStylePropertyPaddingBottom,
+  kSLStylePropertyBorderLeft,
+  kSLStylePropertyBorderTop,
+  kSLStylePropertyBorderRight,
+  kSLStylePropertyBorderBottom,
+  kSLStylePropertyCount,
+} SLStyleProperty;
+
+typedef enum SLLayoutResultIndex {
+  kSLLayoutResultLeft = 0,
+  kSLLayoutResultTop,
+  kSLLayoutResultWidth,
+  kSLLayoutResultHeight,
+  kSLLayoutResultCount,
+} SLLayoutResultIndex;
+
 }  // namespace starlight
 
 #endif  // CORE_SERVICES_STARLIGHT_STANDALONE_CORE_INCLUDE_STARLIGHT_ENUMS_H_
@@ -48,6 +48,20 @@ struct SLPoint {
   SLPoint(float x, float y) : x_(x), y_(y) {}
 };
 
+// An entry of a packed style blob. The value is the number of a number
+// property, the value of an enum property, or the value of a length property
+// with the length type. A NaN value resets the property.
+struct SLStyleValue {
+  SLStyleProperty property_{kSLStylePropertyDisplay};
+  float value_{0.0f};
+  SLLengthType type_{SLLengthType::kSLLengthPPX};
+
+  SLStyleValue() = default;
+  constexpr SLStyleValue(SLStyleProperty property, float value,
+                         SLLengthType type = kSLLengthPPX)
+      : property_(property), value_(value), type_(type) {}
+};
+
 inline constexpr SLLength kSLUndefinedLength{NAN, kSLLengthPPX};
 inline constexpr SLLength kSLAutoLength{0, kSLLengthAuto};
 constexpr float kSLUndefinedValue = NAN;
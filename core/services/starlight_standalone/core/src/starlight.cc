@@ -6,6 +6,7 @@
 
 #include <cmath>
 #include <list>
+#include <optional>
 
 #include "base/include/no_destructor.h"
 #include "core/renderer/css/computed_css_style.h"
@@ -503,6 +504,18 @@ void SetAspectRatio(const SLNodeRef node, float value) {
   SetValueTypeByPropertyID(node, lynx::tasm::kPropertyIDAspectRatio, value);
 }
 
+// attribute
+void SetColumnCount(const SLNodeRef node, int32_t count) {
+  LayoutObject *layout_object = GET_LAYOUT_NODE(node);
+  // The staggered grid divides the width by the column count, so a count less
+  // than 1 removes the attribute instead.
+  const std::optional<int> column_count =
+      count > 0 ? std::optional<int>(count) : std::nullopt;
+  if (layout_object->attr_map().setColumnCount(column_count)) {
+    layout_object->MarkDirty();
+  }
+}
+
 // length
 SLSize GetLayoutSize(SLNodeRef node) {
   LayoutObject *layout_object = GET_LAYOUT_NODE(node);
@@ -699,4 +712,134 @@ void SetPosition(const SLNodeRef node, SLPositionType type) {
   SetEnumTypeByPropertyID(node, lynx::tasm::kPropertyIDPosition, type);
 }
 
+// batch
+namespace {
+enum class StyleValueKind { kEnum, kNumber, kLength };
+
+struct StyleProperty {
+  lynx::tasm::CSSPropertyID id;
+  StyleValueKind kind;
+};
+
+// Indexed by SLStyleProperty.
+constexpr StyleProperty kStyleProperties[] = {
+    {lynx::tasm::kPropertyIDDisplay, StyleValueKind::kEnum},
+    {lynx::tasm::kPropertyIDPosition, StyleValueKind::kEnum},
+    {lynx::tasm::kPropertyIDDirection, StyleValueKind::kEnum},
+    {lynx::tasm::kPropertyIDFlexDirection, StyleValueKind::kEnum},
+    {lynx::tasm::kPropertyIDFlexWrap, StyleValueKind::kEnum},
+    {lynx::tasm::kPropertyIDJustifyContent, StyleValueKind::kEnum},
+    {lynx::tasm::kPropertyIDAlignItems, StyleValueKind::kEnum},
+    {lynx::tasm::kPropertyIDAlignSelf, StyleValueKind::kEnum},
+    {lynx::tasm::kPropertyIDAlignContent, StyleValueKind::kEnum},
+    {lynx::tasm::kPropertyIDFlexGrow, StyleValueKind::kNumber},
+    {lynx::tasm::kPropertyIDFlexShrink, StyleValueKind::kNumber},
+    {lynx::tasm::kPropertyIDFlexBasis, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDAspectRatio, StyleValueKind::kNumber},
+    {lynx::tasm::kPropertyIDWidth, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDHeight, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDMinWidth, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDMinHeight, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDMaxWidth, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDMaxHeight, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDLeft, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDTop, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDRight, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDBottom, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDMarginLeft, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDMarginTop, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDMarginRight, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDMarginBottom, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDPaddingLeft, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDPaddingTop, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDPaddingRight, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDPaddingBottom, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDBorderLeftWidth, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDBorderTopWidth, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDBorderRightWidth, StyleValueKind::kLength},
+    {lynx::tasm::kPropertyIDBorderBottomWidth, StyleValueKind::kLength},
+};
+static_assert(sizeof(kStyleProperties) / sizeof(kStyleProperties[0]) ==
+                  kSLStylePropertyCount,
+              "kStyleProperties must match SLStyleProperty");
+}  // namespace
+
+// Sets the styles without marking the node dirty.
+static bool SetStylesWithoutMarkDirty(StarlightLayoutNode *node,
+                                      const SLStyleValue *styles,
+                                      uint32_t count) {
+  lynx::starlight::ComputedCSSStyle *css_style = node->GetCSSMutableStyle();
+  bool changed = false;
+  for (uint32_t i = 0; i < count; ++i) {
+    const SLStyleValue &style = styles[i];
+    if (style.property_ < 0 || style.property_ >= kSLStylePropertyCount) {
+      continue;
+    }
+    const StyleProperty &property = kStyleProperties[style.property_];
+    const bool reset = std::isnan(style.value_);
+    switch (property.kind) {
+      case StyleValueKind::kEnum:
+        changed |= css_style->SetValue(
+            property.id,
+            lynx::tasm::CSSValue::MakeEnum(
+                reset ? 0 : static_cast<int>(style.value_)),
+            reset);
+        break;
+      case StyleValueKind::kNumber:
+        changed |= css_style->SetValue(
+            property.id, GetNumberCSSValue(style.value_), reset);
+        break;
+      case StyleValueKind::kLength:
+        changed |= css_style->SetValue(
+            property.id,
+            GetLengthCSSValue(SLLength(style.value_, style.type_)), reset);
+        break;
+    }
+  }
+  return changed;
+}
+
+bool SetStyles(SLNodeRef node, const SLStyleValue *styles, uint32_t count) {
+  if (SetStylesWithoutMarkDirty(GET_NODE(node), styles, count)) {
+    GET_LAYOUT_NODE(node)->MarkDirty();
+    return true;
+  }
+  return false;
+}
+
+void CreateTree(const LayoutConfig &config, const int32_t *parent_indices,
+                uint32_t count, const SLStyleValue *styles,
+                const uint32_t *style_offsets, SLNodeRef *nodes) {
+  for (uint32_t i = 0; i < count; ++i) {
+    StarlightLayoutNode *node = new StarlightLayoutNode(config);
+    nodes[i] = node;
+    if (styles) {
+      SetStylesWithoutMarkDirty(node, styles + style_offsets[i],
+                                style_offsets[i + 1] - style_offsets[i]);
+    }
+    const int32_t parent_index = parent_indices[i];
+    if (parent_index >= 0 && static_cast<uint32_t>(parent_index) < i) {
+      StarlightLayoutNode *parent = GET_NODE(nodes[parent_index]);
+      parent->GetLayoutObject()->AppendChild(node->GetLayoutObject());
+      parent->children_.push_back(node);
+      node->parent_ = parent;
+    }
+    // Stops at the parent, which is already dirty, so that the tree is
+    // marked dirty in linear time.
+    node->GetLayoutObject()->MarkDirty();
+  }
+}
+
+void GetLayoutResults(const SLNodeRef *nodes, uint32_t count,
+                      float *results) {
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto &result = GET_LAYOUT_NODE(nodes[i])->GetLayoutResult();
+    float *node_results = results + i * kSLLayoutResultCount;
+    node_results[kSLLayoutResultLeft] = result.offset_.X();
+    node_results[kSLLayoutResultTop] = result.offset_.Y();
+    node_results[kSLLayoutResultWidth] = result.size_.width_;
+    node_results[kSLLayoutResultHeight] = result.size_.height_;
+  }
+}
+
 }  // namespace starlight
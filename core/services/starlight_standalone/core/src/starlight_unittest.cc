@@ -0,0 +1,237 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/services/starlight_standalone/core/include/starlight.h"
+
+#include <cmath>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace starlight {
+
+namespace {
+
+constexpr int32_t kScreenWidth = 1080;
+constexpr int32_t kScreenHeight = 1920;
+constexpr int32_t kSectionCount = 2;
+constexpr int32_t kItemCountPerSection = 3;
+
+// A flex column of sections, each a wrapping flex row of items.
+void GenerateFlexTree(std::vector<int32_t>& parent_indices,
+                      std::vector<SLStyleValue>& styles,
+                      std::vector<uint32_t>& style_offsets) {
+  parent_indices.push_back(-1);
+  style_offsets.push_back(0);
+  styles.emplace_back(kSLStylePropertyDisplay, kSLDisplayTypeFlex);
+  styles.emplace_back(kSLStylePropertyWidth, 300.f);
+  styles.emplace_back(kSLStylePropertyFlexDirection, kSLFlexDirectionColumn);
+  style_offsets.push_back(styles.size());
+  for (int32_t i = 0; i < kSectionCount; ++i) {
+    const int32_t section = static_cast<int32_t>(parent_indices.size());
+    parent_indices.push_back(0);
+    styles.emplace_back(kSLStylePropertyDisplay, kSLDisplayTypeFlex);
+    styles.emplace_back(kSLStylePropertyFlexDirection, kSLFlexDirectionRow);
+    styles.emplace_back(kSLStylePropertyFlexWrap, kSLFlexWrapTypeWrap);
+    styles.emplace_back(kSLStylePropertyMarginTop, 8.f);
+    styles.emplace_back(kSLStylePropertyPaddingLeft, 4.f);
+    style_offsets.push_back(styles.size());
+    for (int32_t j = 0; j < kItemCountPerSection; ++j) {
+      parent_indices.push_back(section);
+      styles.emplace_back(kSLStylePropertyWidth, 120.f);
+      styles.emplace_back(kSLStylePropertyHeight, 40.f + j * 10.f);
+      styles.emplace_back(kSLStylePropertyFlexGrow, 1.f + j % 2);
+      style_offsets.push_back(styles.size());
+    }
+  }
+}
+
+void FreeNodes(std::vector<SLNodeRef>& nodes) {
+  // Children are freed before their parents.
+  for (size_t i = nodes.size(); i > 0; --i) {
+    Free(nodes[i - 1]);
+  }
+  nodes.clear();
+}
+
+}  // namespace
+
+TEST(StarlightTest, CreateTreeMatchesSetters) {
+  std::vector<int32_t> parent_indices;
+  std::vector<SLStyleValue> styles;
+  std::vector<uint32_t> style_offsets;
+  GenerateFlexTree(parent_indices, styles, style_offsets);
+  const uint32_t count = static_cast<uint32_t>(parent_indices.size());
+  const LayoutConfig config(kScreenWidth, kScreenHeight);
+
+  std::vector<SLNodeRef> expected_nodes(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    SLNodeRef node = CreateWithConfig(config);
+    expected_nodes[i] = node;
+    for (uint32_t j = style_offsets[i]; j < style_offsets[i + 1]; ++j) {
+      const SLStyleValue& style = styles[j];
+      const SLLength length(style.value_, style.type_);
+      switch (style.property_) {
+        case kSLStylePropertyDisplay:
+          SetDisplay(node, static_cast<SLDisplayType>(style.value_));
+          break;
+        case kSLStylePropertyFlexDirection:
+          SetFlexDirection(node, static_cast<SLFlexDirection>(style.value_));
+          break;
+        case kSLStylePropertyFlexWrap:
+          SetFlexWrap(node, static_cast<SLFlexWrapType>(style.value_));
+          break;
+        case kSLStylePropertyFlexGrow:
+          SetFlexGrow(node, style.value_);
+          break;
+        case kSLStylePropertyWidth:
+          SetWidth(node, length);
+          break;
+        case kSLStylePropertyHeight:
+          SetHeight(node, length);
+          break;
+        case kSLStylePropertyMarginTop:
+          SetMarginTop(node, length);
+          break;
+        case kSLStylePropertyPaddingLeft:
+          SetPaddingLeft(node, length);
+          break;
+        default:
+          FAIL() << "Unexpected property " << style.property_;
+      }
+    }
+    if (parent_indices[i] >= 0) {
+      InsertChild(expected_nodes[parent_indices[i]], node);
+    }
+  }
+  CalculateLayout(expected_nodes[0]);
+
+  std::vector<SLNodeRef> nodes(count);
+  CreateTree(config, parent_indices.data(), count, styles.data(),
+             style_offsets.data(), nodes.data());
+  EXPECT_TRUE(IsDirty(nodes[0]));
+  CalculateLayout(nodes[0]);
+  std::vector<float> results(count * kSLLayoutResultCount);
+  GetLayoutResults(nodes.data(), count, results.data());
+
+  EXPECT_EQ(nullptr, GetParent(nodes[0]));
+  EXPECT_EQ(static_cast<uint32_t>(kSectionCount), GetChildCount(nodes[0]));
+  for (uint32_t i = 0; i < count; ++i) {
+    if (parent_indices[i] >= 0) {
+      EXPECT_EQ(nodes[parent_indices[i]], GetParent(nodes[i]));
+    }
+    const SLPoint offset = GetLayoutOffset(expected_nodes[i]);
+    const SLSize size = GetLayoutSize(expected_nodes[i]);
+    const float* node_results = &results[i * kSLLayoutResultCount];
+    EXPECT_FLOAT_EQ(offset.x_, node_results[kSLLayoutResultLeft]);
+    EXPECT_FLOAT_EQ(offset.y_, node_results[kSLLayoutResultTop]);
+    EXPECT_FLOAT_EQ(size.width_, node_results[kSLLayoutResultWidth]);
+    EXPECT_FLOAT_EQ(size.height_, node_results[kSLLayoutResultHeight]);
+  }
+  EXPECT_FLOAT_EQ(300.f, results[kSLLayoutResultWidth]);
+
+  FreeNodes(nodes);
+  FreeNodes(expected_nodes);
+}
+
+TEST(StarlightTest, CreateTreeTreatsInvalidParentAsRoot) {
+  // The parent of a node must come before it, so node 2 (itself), node 3
+  // (after it) and node 4 (below -1) are created as roots.
+  const int32_t parent_indices[] = {-1, 0, 2, 7, -3};
+  const uint32_t count = sizeof(parent_indices) / sizeof(parent_indices[0]);
+  std::vector<SLNodeRef> nodes(count);
+  CreateTree(LayoutConfig(kScreenWidth, kScreenHeight), parent_indices, count,
+             nullptr, nullptr, nodes.data());
+
+  EXPECT_EQ(1u, GetChildCount(nodes[0]));
+  EXPECT_EQ(nodes[0], GetParent(nodes[1]));
+  for (uint32_t i = 2; i < count; ++i) {
+    EXPECT_EQ(nullptr, GetParent(nodes[i]));
+    EXPECT_EQ(0u, GetChildCount(nodes[i]));
+  }
+
+  FreeNodes(nodes);
+}
+
+TEST(StarlightTest, SetStylesSkipsInvalidProperties) {
+  SLNodeRef node = CreateWithConfig(LayoutConfig(kScreenWidth, kScreenHeight));
+  CalculateLayout(node);
+  ASSERT_FALSE(IsDirty(node));
+  const float default_height = GetLayoutSize(node).height_;
+
+  const SLStyleValue invalid_styles[] = {
+      SLStyleValue(kSLStylePropertyCount, 50.f),
+      SLStyleValue(static_cast<SLStyleProperty>(-1), 50.f),
+  };
+  EXPECT_FALSE(SetStyles(node, invalid_styles, 2));
+  EXPECT_FALSE(IsDirty(node));
+
+  const SLStyleValue styles[] = {
+      SLStyleValue(kSLStylePropertyCount, 10.f),
+      SLStyleValue(kSLStylePropertyWidth, 50.f),
+      SLStyleValue(kSLStylePropertyHeight, 20.f),
+  };
+  EXPECT_TRUE(SetStyles(node, styles, 3));
+  EXPECT_TRUE(IsDirty(node));
+  CalculateLayout(node);
+  float results[kSLLayoutResultCount];
+  GetLayoutResults(&node, 1, results);
+  EXPECT_FLOAT_EQ(50.f, results[kSLLayoutResultWidth]);
+  EXPECT_FLOAT_EQ(20.f, results[kSLLayoutResultHeight]);
+
+  // Setting the same styles again changes nothing.
+  EXPECT_FALSE(SetStyles(node, styles, 3));
+  EXPECT_FALSE(IsDirty(node));
+
+  // A NaN value resets the property.
+  const SLStyleValue reset_styles[] = {
+      SLStyleValue(kSLStylePropertyHeight, NAN),
+  };
+  EXPECT_TRUE(SetStyles(node, reset_styles, 1));
+  CalculateLayout(node);
+  GetLayoutResults(&node, 1, results);
+  EXPECT_FLOAT_EQ(50.f, results[kSLLayoutResultWidth]);
+  EXPECT_FLOAT_EQ(default_height, results[kSLLayoutResultHeight]);
+
+  Free(node);
+}
+
+TEST(StarlightTest, SetColumnCount) {
+  const LayoutConfig config(kScreenWidth, kScreenHeight);
+  SLNodeRef list = CreateWithConfig(config);
+  SetWidth(list, SLLength(200.f, kSLLengthPPX));
+  SetDisplay(list, kSLDisplayTypeLinear);
+  std::vector<SLNodeRef> items;
+  for (int32_t i = 0; i < 2; ++i) {
+    SLNodeRef item = CreateWithConfig(config);
+    SetHeight(item, SLLength(40.f, kSLLengthPPX));
+    InsertChild(list, item);
+    items.push_back(item);
+  }
+
+  // The staggered grid lays out each item with the width of a column.
+  SetColumnCount(list, 2);
+  CalculateLayout(list);
+  EXPECT_FLOAT_EQ(100.f, GetLayoutSize(items[0]).width_);
+  EXPECT_FLOAT_EQ(100.f, GetLayoutSize(items[1]).width_);
+
+  // A count less than 1 removes the column count, so the items are laid out
+  // with the width of the list.
+  SetColumnCount(list, 0);
+  EXPECT_TRUE(IsDirty(list));
+  CalculateLayout(list);
+  EXPECT_FLOAT_EQ(200.f, GetLayoutSize(items[0]).width_);
+  EXPECT_FLOAT_EQ(200.f, GetLayoutSize(items[1]).width_);
+  EXPECT_FLOAT_EQ(40.f, GetLayoutOffset(items[1]).y_);
+
+  // The column count is already removed.
+  SetColumnCount(list, -1);
+  EXPECT_FALSE(IsDirty(list));
+
+  Free(items[1]);
+  Free(items[0]);
+  Free(list);
+}
+
+}  // namespace starlight
@@ -167,6 +167,35 @@ static constexpr const char kTemplateBundleParseStart[] =
     "templateBundleParseStart";
 static constexpr const char kTemplateBundleParseEnd[] =
     "templateBundleParseEnd";
+// decode timing of template bundle sections
+static constexpr const char kTemplateBundleParseCSSStart[] =
+    "templateBundleParseCSSStart";
+static constexpr const char kTemplateBundleParseCSSEnd[] =
+    "templateBundleParseCSSEnd";
+static constexpr const char kTemplateBundleParseJSStart[] =
+    "templateBundleParseJSStart";
+static constexpr const char kTemplateBundleParseJSEnd[] =
+    "templateBundleParseJSEnd";
+static constexpr const char kTemplateBundleParseJSBytecodeStart[] =
+    "templateBundleParseJSBytecodeStart";
+static constexpr const char kTemplateBundleParseJSBytecodeEnd[] =
+    "templateBundleParseJSBytecodeEnd";
+static constexpr const char kTemplateBundleParseLepusStart[] =
+    "templateBundleParseLepusStart";
+static constexpr const char kTemplateBundleParseLepusEnd[] =
+    "templateBundleParseLepusEnd";
+static constexpr const char kTemplateBundleParseLepusChunkStart[] =
+    "templateBundleParseLepusChunkStart";
+static constexpr const char kTemplateBundleParseLepusChunkEnd[] =
+    "templateBundleParseLepusChunkEnd";
+static constexpr const char kTemplateBundleParseElementTemplateStart[] =
+    "templateBundleParseElementTemplateStart";
+static constexpr const char kTemplateBundleParseElementTemplateEnd[] =
+    "templateBundleParseElementTemplateEnd";
+static constexpr const char kTemplateBundleParseParsedStylesStart[] =
+    "templateBundleParseParsedStylesStart";
+static constexpr const char kTemplateBundleParseParsedStylesEnd[] =
+    "templateBundleParseParsedStylesEnd";
 // ================== UNSPECIFIED ==================
 
 }  // namespace timing
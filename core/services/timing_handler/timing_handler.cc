@@ -65,6 +65,9 @@ void TimingHandler::SetTiming(TimestampKey& timing_key,
     LOGE("Invalid timing key or timestamp in TimingHandler::SetTiming");
     return;
   }
+  if (timing_observer_) {
+    timing_observer_(timing_key, us_timestamp, pipeline_id);
+  }
   TimestampKey polyfillKey = GetPolyfillTimingKey(timing_key);
   if (IsInitTiming(polyfillKey)) {
     ProcessInitTiming(polyfillKey, us_timestamp);
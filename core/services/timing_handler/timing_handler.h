@@ -5,6 +5,7 @@
 #ifndef CORE_SERVICES_TIMING_HANDLER_TIMING_HANDLER_H_
 #define CORE_SERVICES_TIMING_HANDLER_TIMING_HANDLER_H_
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -118,6 +119,14 @@ class TimingHandler {
   };
   inline void SetURL(const std::string& url) { timing_info_.SetURL(url); }
 
+  // Observes every valid timestamp set to the handler, e.g. to accumulate the
+  // durations of the pipeline phases in the headless replay benchmark.
+  using TimingObserver = std::function<void(
+      const TimestampKey&, TimestampUs, const PipelineID&)>;
+  inline void SetTimingObserver(TimingObserver observer) {
+    timing_observer_ = std::move(observer);
+  }
+
   // Don't store this raw ptr
   // Used in RuntimeMediator::AttachToLynxShell only
   TimingHandlerDelegate* GetDelegate() { return delegate_.get(); }
@@ -127,6 +136,7 @@ class TimingHandler {
   // Internal storage and delegate for timing information.
   TimingInfo timing_info_;
   std::unique_ptr<TimingHandlerDelegate> delegate_;
+  TimingObserver timing_observer_;
   bool has_dispatched_setup_timing_{false};
   std::unordered_map<PipelineID, base::InlineVector<TimingFlag, 2>>
       pipeline_id_to_timing_flags_map_;
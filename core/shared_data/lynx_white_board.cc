@@ -27,20 +27,34 @@ WhiteBoard::WhiteBoard() {
       std::unique_ptr<fml::SharedMutex>(fml::SharedMutex::Create()));
 }
 
-void WhiteBoard::SetGlobalSharedData(const std::string& key,
-                                     const std::shared_ptr<pub::Value>& value) {
+bool WhiteBoard::SetGlobalSharedData(
+    const std::string& key, const std::shared_ptr<const pub::Value>& value) {
+  std::shared_ptr<const WhiteBoardSnapshot> snapshot;
   {
     fml::UniqueLock lock(*data_center_lock_);
-    data_center_[key] = value;
+    auto& current = data_center_[key];
+    if (current && current->value == value) {
+      return false;
+    }
+    snapshot = std::make_shared<WhiteBoardSnapshot>(
+        WhiteBoardSnapshot{value, ++version_});
+    current = snapshot;
   }
 
-  TriggerListener(WhiteBoardStorageType::TYPE_LEPUS, key, *value);
-  TriggerListener(WhiteBoardStorageType::TYPE_CLIENT, key, *value);
-  TriggerListener(WhiteBoardStorageType::TYPE_JS, key, *value);
+  TriggerListener(WhiteBoardStorageType::TYPE_LEPUS, key, *snapshot);
+  TriggerListener(WhiteBoardStorageType::TYPE_CLIENT, key, *snapshot);
+  TriggerListener(WhiteBoardStorageType::TYPE_JS, key, *snapshot);
+  return true;
 }
 
-std::shared_ptr<pub::Value> WhiteBoard::GetGlobalSharedData(
+std::shared_ptr<const pub::Value> WhiteBoard::GetGlobalSharedData(
     const std::string& key) {
+  auto snapshot = GetGlobalSharedDataSnapshot(key);
+  return snapshot ? snapshot->value : nullptr;
+}
+
+std::shared_ptr<const WhiteBoardSnapshot>
+WhiteBoard::GetGlobalSharedDataSnapshot(const std::string& key) {
   fml::SharedLock lock(*data_center_lock_);
   auto iter = data_center_.find(key);
   if (iter != data_center_.end()) {
@@ -49,9 +63,23 @@ std::shared_ptr<pub::Value> WhiteBoard::GetGlobalSharedData(
   return nullptr;
 }
 
+bool WhiteBoard::IsCurrentSnapshot(const std::string& key,
+                                   const WhiteBoardSnapshot& snapshot) {
+  fml::SharedLock lock(*data_center_lock_);
+  auto iter = data_center_.find(key);
+  return iter != data_center_.end() &&
+         iter->second->version == snapshot.version;
+}
+
 void WhiteBoard::TriggerListener(const WhiteBoardStorageType& type,
                                  const std::string& key,
-                                 const pub::Value& value) {
+                                 const WhiteBoardSnapshot& snapshot) {
+  // The data may be set on the TASM threads of several LynxViews at the same
+  // time. A snapshot replaced before its listeners are triggered is skipped,
+  // so that the listeners never go back to an older version.
+  if (!IsCurrentSnapshot(key, snapshot)) {
+    return;
+  }
   fml::SharedLock lock(*listener_lock_[type]);
   auto& listener_map = listener_map_[type];
   auto listener_iter = listener_map.find(key);
@@ -59,7 +87,7 @@ void WhiteBoard::TriggerListener(const WhiteBoardStorageType& type,
     // iterator over listeners and trigger callbacks;
     auto& listener = listener_iter->second;
     for (auto& listener : listener) {
-      listener.trigger_callback(value);
+      listener.trigger_callback(*snapshot.value);
     }
   }
 }
@@ -5,6 +5,7 @@
 #ifndef CORE_SHARED_DATA_LYNX_WHITE_BOARD_H_
 #define CORE_SHARED_DATA_LYNX_WHITE_BOARD_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -25,6 +26,15 @@ namespace tasm {
  */
 enum class WhiteBoardStorageType : uint8_t { TYPE_LEPUS, TYPE_JS, TYPE_CLIENT };
 
+// An immutable version of the shared data. Readers and subscribers of all the
+// LynxViews share the same snapshot, so the value must not be modified after
+// being set to the WhiteBoard.
+struct WhiteBoardSnapshot {
+  std::shared_ptr<const pub::Value> value;
+  // Increases on each change of the WhiteBoard, starting from 1.
+  uint64_t version;
+};
+
 struct WhiteBoardListener {
   double callback_id;
   // invoked while new data is received.
@@ -43,9 +53,14 @@ class WhiteBoard final {
   WhiteBoard& operator=(WhiteBoard&&) = delete;
 
   // set & get operation
-  void SetGlobalSharedData(const std::string& key,
-                           const std::shared_ptr<pub::Value>& value);
-  std::shared_ptr<pub::Value> GetGlobalSharedData(const std::string& key);
+  // Returns false if the value is already the current one of the key, in
+  // which case the version is not changed and no listener is triggered.
+  bool SetGlobalSharedData(const std::string& key,
+                           const std::shared_ptr<const pub::Value>& value);
+  std::shared_ptr<const pub::Value> GetGlobalSharedData(
+      const std::string& key);
+  std::shared_ptr<const WhiteBoardSnapshot> GetGlobalSharedDataSnapshot(
+      const std::string& key);
 
   // subscribe & unsubscribe operation
   void RegisterSharedDataListener(const WhiteBoardStorageType& type,
@@ -58,14 +73,19 @@ class WhiteBoard final {
 
  private:
   using LynxWhiteBoardMap =
-      std::unordered_map<std::string, std::shared_ptr<pub::Value>>;
+      std::unordered_map<std::string,
+                         std::shared_ptr<const WhiteBoardSnapshot>>;
   using WhiteBoardListenerMap =
       std::unordered_map<std::string, std::vector<WhiteBoardListener>>;
 
   void TriggerListener(const WhiteBoardStorageType& type,
-                       const std::string& key, const pub::Value& value);
+                       const std::string& key,
+                       const WhiteBoardSnapshot& snapshot);
+  bool IsCurrentSnapshot(const std::string& key,
+                         const WhiteBoardSnapshot& snapshot);
 
   LynxWhiteBoardMap data_center_;
+  uint64_t version_{0};
   std::unique_ptr<fml::SharedMutex> data_center_lock_;
   std::unordered_map<WhiteBoardStorageType, std::unique_ptr<fml::SharedMutex>>
       listener_lock_;
@@ -36,6 +36,66 @@ TEST_F(LynxWhiteBoardTest, SetAndGetSharedDataRule0) {
   ASSERT_EQ(gotValue, value);
 }
 
+TEST_F(LynxWhiteBoardTest, SharedDataSnapshotVersion) {
+  WhiteBoard white_board;
+  int trigger_count = 0;
+  WhiteBoardListener listener = {
+      0, [&trigger_count](const pub::Value& value) { ++trigger_count; },
+      []() {}};
+  white_board.RegisterSharedDataListener(WhiteBoardStorageType::TYPE_LEPUS,
+                                         "name", std::move(listener));
+  EXPECT_EQ(white_board.GetGlobalSharedDataSnapshot("name"), nullptr);
+
+  auto value = std::make_shared<pub::ValueImplLepus>(lepus::Value("value"));
+  EXPECT_TRUE(white_board.SetGlobalSharedData("name", value));
+  auto snapshot = white_board.GetGlobalSharedDataSnapshot("name");
+  ASSERT_NE(snapshot, nullptr);
+  EXPECT_EQ(snapshot->version, 1u);
+  // Readers share the same value.
+  EXPECT_EQ(snapshot->value, white_board.GetGlobalSharedData("name"));
+  EXPECT_EQ(trigger_count, 1);
+
+  // The current value does not change the version.
+  EXPECT_FALSE(white_board.SetGlobalSharedData("name", value));
+  EXPECT_EQ(white_board.GetGlobalSharedDataSnapshot("name"), snapshot);
+  EXPECT_EQ(trigger_count, 1);
+
+  EXPECT_TRUE(white_board.SetGlobalSharedData(
+      "other", std::make_shared<pub::ValueImplLepus>(lepus::Value(1))));
+  EXPECT_TRUE(white_board.SetGlobalSharedData(
+      "name", std::make_shared<pub::ValueImplLepus>(lepus::Value("new"))));
+  EXPECT_EQ(white_board.GetGlobalSharedDataSnapshot("name")->version, 3u);
+  EXPECT_EQ(trigger_count, 2);
+  // The old snapshot is still valid for the readers holding it.
+  EXPECT_EQ(pub::ValueUtils::ConvertValueToLepusValue(*snapshot->value),
+            lepus::Value("value"));
+}
+
+TEST(WhiteBoardDelegateTest, SetSessionStorageItem) {
+  auto white_board = std::make_shared<WhiteBoard>();
+  WhiteBoardRuntimeDelegate delegate(white_board);
+
+  auto table = lepus::Dictionary::Create();
+  table->SetValue("key", lepus::Value("value"));
+  lepus::Value value(table);
+  delegate.SetSessionStorageItem("name", value);
+  auto snapshot = white_board->GetGlobalSharedDataSnapshot("name");
+  ASSERT_NE(snapshot, nullptr);
+
+  // Stored as a const copy, which is not changed by the setter.
+  lepus::Value shared_value = delegate.GetSessionStorageItem("name");
+  EXPECT_TRUE(shared_value.Table()->IsConst());
+  EXPECT_EQ(shared_value, value);
+  table->SetValue("key", lepus::Value("changed"));
+  EXPECT_EQ(shared_value.GetProperty("key"), lepus::Value("value"));
+
+  // An equal value is not set again.
+  delegate.SetSessionStorageItem("name", shared_value);
+  EXPECT_EQ(white_board->GetGlobalSharedDataSnapshot("name"), snapshot);
+  delegate.SetSessionStorageItem("name", value);
+  EXPECT_EQ(white_board->GetGlobalSharedDataSnapshot("name")->version, 2u);
+}
+
 TEST_F(LynxWhiteBoardTest, RegisterLepusSharedDataListenerRule0) {
   WhiteBoard white_board;
   base::String key = base::String("name");
@@ -61,10 +61,23 @@ void WhiteBoardDelegate::SetSessionStorageItem(const std::string& key,
                 ctx.event()->add_debug_annotations("key", key);
                 ctx.event()->add_debug_annotations("value", ss.str());
               });
-  if (white_board_) {
-    auto shared_data = std::make_shared<pub::ValueImplLepus>(value);
-    white_board_->SetGlobalSharedData(key, std::move(shared_data));
+  if (!white_board_) {
+    return;
+  }
+  // Setting an equal value does not change the version, so that the listeners
+  // of all the LynxViews are not triggered.
+  auto current = white_board_->GetGlobalSharedData(key);
+  if (current &&
+      pub::ValueUtils::ConvertValueToLepusValue(*current).IsEqual(value)) {
+    return;
   }
+  // Cloned once and marked const, so that the snapshot can be shared by all
+  // the LynxViews without being converted or copied for each of them, and
+  // the modifications of the setter are not visible to the others.
+  lepus::Value shared_value = lepus::Value::Clone(value);
+  shared_value.MarkConst();
+  white_board_->SetGlobalSharedData(
+      key, std::make_shared<pub::ValueImplLepus>(std::move(shared_value)));
 }
 
 lepus::Value WhiteBoardDelegate::GetSessionStorageItem(const std::string& key) {
@@ -26,6 +26,10 @@ class DynamicUIOperationQueue {
 
   void Transfer(base::ThreadStrategyForRendering strategy);
   void EnqueueUIOperation(UIOperation operation);
+  template <typename F>
+  void EnqueueUIOperation(UIOperationKind kind, F&& operation) {
+    impl_->EnqueueUIOperation(kind, std::forward<F>(operation));
+  }
   void EnqueueHighPriorityUIOperation(UIOperation operation);
   void Destroy();
   void UpdateStatus(UIOperationStatus status);
@@ -179,7 +179,11 @@ void LynxShell::InitRuntimeWithRuntimeDisabled(
       nullptr, nullptr, instance_id_, enable_runtime_);
   tasm_mediator_->SetRuntimeActor(runtime_actor_);
   layout_mediator_->SetRuntimeActor(runtime_actor_);
-  timing_mediator_->SetRuntimeActor(runtime_actor_);
+  // The timing mediator is not created if the timing actor is set to the
+  // LynxShellBuilder.
+  if (timing_mediator_) {
+    timing_mediator_->SetRuntimeActor(runtime_actor_);
+  }
 }
 
 void LynxShell::InitRuntime(
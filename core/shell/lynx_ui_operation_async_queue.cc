@@ -14,12 +14,13 @@ namespace lynx {
 namespace shell {
 
 void LynxUIOperationAsyncQueue::EnqueueUIOperation(UIOperation operation) {
-  pending_operations_.Push(std::move(operation));
+  pending_operations_.Emplace(UIOperationKind::kGeneric, std::move(operation));
 }
 
 void LynxUIOperationAsyncQueue::EnqueueHighPriorityOperation(
     UIOperation operation) {
-  pending_high_priority_operations_.Push(std::move(operation));
+  pending_high_priority_operations_.Emplace(UIOperationKind::kGeneric,
+                                            std::move(operation));
 }
 
 void LynxUIOperationAsyncQueue::UpdateStatus(UIOperationStatus status) {
@@ -77,8 +78,8 @@ void LynxUIOperationAsyncQueue::FlushOnUIThread() {
 
 bool LynxUIOperationAsyncQueue::FlushPendingOperations() {
   std::lock_guard<std::mutex> flush_mutex(flush_mutex_);
-  operations_.Push(pending_operations_);
-  high_priority_operations_.Push(pending_high_priority_operations_);
+  operations_.Append(pending_operations_);
+  high_priority_operations_.Append(pending_high_priority_operations_);
   return operations_.Empty() && high_priority_operations_.Empty();
 }
 
@@ -126,9 +127,8 @@ void LynxUIOperationAsyncQueue::FlushInterval() {
       tasm::timing::kTaskNameLynxUIOperationAsyncQueueFlush);
   is_in_flush_ = true;
 
-  base::ConcurrentQueue<UIOperation>::IterableContainer
-      high_priority_operations;
-  base::ConcurrentQueue<UIOperation>::IterableContainer operations;
+  UIOperationBuffer high_priority_operations;
+  UIOperationBuffer operations;
   {
     // make sure that `operations_` is safe.
     std::lock_guard<std::mutex> flush_mutex(flush_mutex_);
@@ -27,6 +27,7 @@ class LynxUIOperationAsyncQueue
       fml::RefPtr<fml::TaskRunner> runner,
       int32_t instance_id = tasm::report::kUnknownInstanceId)
       : LynxUIOperationQueue(instance_id), runner_(std::move(runner)){};
+  using LynxUIOperationQueue::EnqueueUIOperation;
   virtual void EnqueueUIOperation(UIOperation operation) override;
   virtual void EnqueueHighPriorityOperation(UIOperation operation) override;
 
@@ -39,6 +40,15 @@ class LynxUIOperationAsyncQueue
   virtual bool IsInFlush() override { return is_in_flush_; }
   virtual bool FlushPendingOperations() override;
 
+ protected:
+  virtual ConcurrentUIOperationBuffer& PendingOperations() override {
+    return pending_operations_;
+  }
+  virtual ConcurrentUIOperationBuffer& PendingHighPriorityOperations()
+      override {
+    return pending_high_priority_operations_;
+  }
+
  private:
   void FlushOnTASMThread();
   void FlushOnUIThread();
@@ -49,8 +59,8 @@ class LynxUIOperationAsyncQueue
   // the tasm thread calls `Flush`, the |pending_operations_| will be moved to
   // |operations_|, then |operations_| will be eventually flush on the UI
   // thread.
-  base::ConcurrentQueue<UIOperation> pending_operations_;
-  base::ConcurrentQueue<UIOperation> pending_high_priority_operations_;
+  ConcurrentUIOperationBuffer pending_operations_;
+  ConcurrentUIOperationBuffer pending_high_priority_operations_;
 
   // These variables below are used for syncFlush that called from the platform
   // layer by the UI thread. It will wait for the tasm and layout finish to
@@ -4,6 +4,7 @@
 
 #include "core/shell/lynx_ui_operation_queue.h"
 
+#include <string>
 #include <utility>
 
 #include "base/include/debug/lynx_assert.h"
@@ -15,12 +16,32 @@
 namespace lynx {
 namespace shell {
 
+#if ENABLE_TRACE_PERFETTO
+namespace {
+
+void AddOperationCountsToTrace(const UIOperationBuffer& operations,
+                               lynx::perfetto::EventContext& ctx) {
+  ctx.event()->add_debug_annotations("count",
+                                     std::to_string(operations.size()));
+  for (size_t i = 0; i < operations.counts().size(); ++i) {
+    if (operations.counts()[i] > 0) {
+      ctx.event()->add_debug_annotations(
+          UIOperationKindName(static_cast<UIOperationKind>(i)),
+          std::to_string(operations.counts()[i]));
+    }
+  }
+}
+
+}  // namespace
+#endif
+
 void LynxUIOperationQueue::EnqueueUIOperation(UIOperation operation) {
-  operations_.Push(std::move(operation));
+  operations_.Emplace(UIOperationKind::kGeneric, std::move(operation));
 }
 
 void LynxUIOperationQueue::EnqueueHighPriorityOperation(UIOperation operation) {
-  high_priority_operations_.Push(std::move(operation));
+  high_priority_operations_.Emplace(UIOperationKind::kGeneric,
+                                    std::move(operation));
 }
 
 void LynxUIOperationQueue::Flush() {
@@ -43,21 +64,31 @@ void LynxUIOperationQueue::Destroy() { destroyed_ = true; }
 void LynxUIOperationQueue::ForceFlush() { Flush(); }
 
 void LynxUIOperationQueue::ConsumeOperations(
-    const base::ConcurrentQueue<UIOperation>::IterableContainer&
-        high_priority_operations,
-    const base::ConcurrentQueue<UIOperation>::IterableContainer& operations) {
+    UIOperationBuffer& high_priority_operations,
+    UIOperationBuffer& operations) {
   tasm::timing::LongTaskMonitor::Scope longTaskScope(
       instance_id_, tasm::timing::kUIOperationFlushTask,
       tasm::timing::kTaskNameLynxUIOperationQueueConsumeOperations);
-  for (auto& operation : high_priority_operations) {
+  for (size_t i = 0; i < flushed_operation_counts_.size(); ++i) {
+    flushed_operation_counts_[i] +=
+        high_priority_operations.counts()[i] + operations.counts()[i];
+  }
+  if (!high_priority_operations.empty()) {
     TRACE_EVENT(LYNX_TRACE_CATEGORY,
-                "LynxUIOperationQueue::ExecuteHighPriorityOperation");
-    operation();
+                "LynxUIOperationQueue::ExecuteHighPriorityOperations",
+                [&high_priority_operations](lynx::perfetto::EventContext ctx) {
+                  AddOperationCountsToTrace(high_priority_operations, ctx);
+                });
+    high_priority_operations.RunAll();
+    PendingHighPriorityOperations().Recycle(high_priority_operations);
   }
-
-  for (auto& operation : operations) {
-    TRACE_EVENT(LYNX_TRACE_CATEGORY, "LynxUIOperationQueue::ExecuteOperation");
-    operation();
+  if (!operations.empty()) {
+    TRACE_EVENT(LYNX_TRACE_CATEGORY, "LynxUIOperationQueue::ExecuteOperations",
+                [&operations](lynx::perfetto::EventContext ctx) {
+                  AddOperationCountsToTrace(operations, ctx);
+                });
+    operations.RunAll();
+    PendingOperations().Recycle(operations);
   }
 
   if (error_callback_ == nullptr) {
@@ -13,9 +13,9 @@
 #include <vector>
 
 #include "base/include/closure.h"
-#include "base/include/concurrent_queue.h"
 #include "core/renderer/utils/lynx_env.h"
 #include "core/services/event_report/event_tracker.h"
+#include "core/shell/ui_operation_buffer.h"
 
 namespace lynx {
 
@@ -45,6 +45,18 @@ class LynxUIOperationQueue {
   virtual void EnqueueUIOperation(UIOperation operation);
   virtual void EnqueueHighPriorityOperation(UIOperation operation);
 
+  // The operation is stored in the buffer as it is, without being wrapped
+  // into a UIOperation.
+  template <typename F>
+  void EnqueueUIOperation(UIOperationKind kind, F&& operation) {
+    PendingOperations().Emplace(kind, std::forward<F>(operation));
+  }
+
+  // Counts of the operations flushed by this queue by kind.
+  const UIOperationCounts& GetFlushedOperationCounts() const {
+    return flushed_operation_counts_;
+  }
+
   void Destroy();
   virtual void UpdateStatus(UIOperationStatus status) {}
   virtual void MarkDirty() {}
@@ -60,13 +72,22 @@ class LynxUIOperationQueue {
   virtual bool FlushPendingOperations() { return false; }
 
  protected:
-  void ConsumeOperations(
-      const base::ConcurrentQueue<UIOperation>::IterableContainer&
-          high_priority_operations,
-      const base::ConcurrentQueue<UIOperation>::IterableContainer& operations);
+  // The buffers which operations are enqueued to.
+  virtual ConcurrentUIOperationBuffer& PendingOperations() {
+    return operations_;
+  }
+  virtual ConcurrentUIOperationBuffer& PendingHighPriorityOperations() {
+    return high_priority_operations_;
+  }
+
+  // Runs the operations popped from |operations_| and
+  // |high_priority_operations_|, and gives their memory back for reuse.
+  void ConsumeOperations(UIOperationBuffer& high_priority_operations,
+                         UIOperationBuffer& operations);
 
-  base::ConcurrentQueue<UIOperation> operations_;
-  base::ConcurrentQueue<UIOperation> high_priority_operations_;
+  ConcurrentUIOperationBuffer operations_;
+  ConcurrentUIOperationBuffer high_priority_operations_;
+  UIOperationCounts flushed_operation_counts_{};
   std::atomic_bool destroyed_{false};
   bool enable_flush_{true};
   ErrorCallback error_callback_;
@@ -4,6 +4,8 @@
 
 #include "core/shell/lynx_ui_operation_queue.h"
 
+#include <vector>
+
 #include "base/include/debug/lynx_assert.h"
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
 
@@ -65,6 +67,25 @@ TEST_F(LynxUIOperationQueueTest, EnqueueUIOperationRepeatedly) {
   }
 }
 
+TEST_F(LynxUIOperationQueueTest, FlushTypedOperations) {
+  std::vector<int32_t> result;
+  LynxUIOperationQueue queue;
+
+  queue.EnqueueUIOperation(UIOperationKind::kCreateNode,
+                           [&result] { result.push_back(1); });
+  queue.EnqueueUIOperation([&result] { result.push_back(2); });
+  queue.EnqueueUIOperation(UIOperationKind::kInsertNode,
+                           [&result] { result.push_back(3); });
+  queue.EnqueueHighPriorityOperation([&result] { result.push_back(0); });
+  queue.Flush();
+
+  ASSERT_EQ(result, (std::vector<int32_t>{0, 1, 2, 3}));
+  const auto& counts = queue.GetFlushedOperationCounts();
+  ASSERT_EQ(counts[static_cast<size_t>(UIOperationKind::kGeneric)], 2u);
+  ASSERT_EQ(counts[static_cast<size_t>(UIOperationKind::kCreateNode)], 1u);
+  ASSERT_EQ(counts[static_cast<size_t>(UIOperationKind::kInsertNode)], 1u);
+}
+
 TEST_F(LynxUIOperationQueueTest, CheckException) {
   static const constexpr int32_t expect_error_code = 777;
   static const std::string expect_error_message = "MEGA";
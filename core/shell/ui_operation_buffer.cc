@@ -0,0 +1,189 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/shell/ui_operation_buffer.h"
+
+#include <algorithm>
+
+namespace lynx {
+namespace shell {
+
+const char* UIOperationKindName(UIOperationKind kind) {
+  switch (kind) {
+    case UIOperationKind::kGeneric:
+      return "generic";
+    case UIOperationKind::kCreateNode:
+      return "create_node";
+    case UIOperationKind::kInsertNode:
+      return "insert_node";
+    case UIOperationKind::kRemoveNode:
+      return "remove_node";
+    case UIOperationKind::kDestroyNode:
+      return "destroy_node";
+    case UIOperationKind::kUpdateProps:
+      return "update_props";
+    case UIOperationKind::kUpdateLayout:
+      return "update_layout";
+    case UIOperationKind::kUpdateExtraData:
+      return "update_extra_data";
+    case UIOperationKind::kPatching:
+      return "patching";
+    case UIOperationKind::kList:
+      return "list";
+    case UIOperationKind::kFinish:
+      return "finish";
+    case UIOperationKind::kCount:
+      break;
+  }
+  return "unknown";
+}
+
+UIOperationBuffer::Chunk::Chunk(size_t capacity)
+    : data(new std::byte[capacity]),
+      capacity(capacity) {}
+
+UIOperationBuffer::~UIOperationBuffer() { Clear(); }
+
+UIOperationBuffer::UIOperationBuffer(UIOperationBuffer&& other) noexcept
+    : chunks_(std::move(other.chunks_)),
+      spare_chunks_(std::move(other.spare_chunks_)),
+      size_(other.size_),
+      counts_(other.counts_) {
+  other.chunks_.clear();
+  other.spare_chunks_.clear();
+  other.size_ = 0;
+  other.counts_ = {};
+}
+
+UIOperationBuffer& UIOperationBuffer::operator=(
+    UIOperationBuffer&& other) noexcept {
+  if (this != &other) {
+    Clear();
+    chunks_ = std::move(other.chunks_);
+    spare_chunks_ = std::move(other.spare_chunks_);
+    size_ = other.size_;
+    counts_ = other.counts_;
+    other.chunks_.clear();
+    other.spare_chunks_.clear();
+    other.size_ = 0;
+    other.counts_ = {};
+  }
+  return *this;
+}
+
+void* UIOperationBuffer::Allocate(size_t size, UIOperationKind kind,
+                                  RunFunction run, DestroyFunction destroy) {
+  const size_t total_size =
+      (sizeof(OperationHeader) + size + kAlignment - 1) & ~(kAlignment - 1);
+  if (chunks_.empty() ||
+      chunks_.back()->capacity - chunks_.back()->used < total_size) {
+    if (!spare_chunks_.empty() && total_size <= kChunkSize) {
+      chunks_.emplace_back(std::move(spare_chunks_.back()));
+      spare_chunks_.pop_back();
+    } else {
+      // Operations larger than a chunk get a chunk of their own.
+      chunks_.emplace_back(
+          std::make_unique<Chunk>(std::max(kChunkSize, total_size)));
+    }
+  }
+  Chunk& chunk = *chunks_.back();
+  auto* header =
+      new (chunk.data.get() + chunk.used) OperationHeader{
+          run, destroy, static_cast<uint32_t>(total_size), kind};
+  chunk.used += total_size;
+  ++size_;
+  ++counts_[static_cast<size_t>(kind)];
+  return header + 1;
+}
+
+void UIOperationBuffer::Append(UIOperationBuffer& other) {
+  if (&other == this || other.chunks_.empty()) {
+    return;
+  }
+  // Operations are always added to the last chunk, so the order is kept even
+  // if the chunks before have room left.
+  chunks_.insert(chunks_.end(), std::make_move_iterator(other.chunks_.begin()),
+                 std::make_move_iterator(other.chunks_.end()));
+  other.chunks_.clear();
+  size_ += other.size_;
+  other.size_ = 0;
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  other.counts_ = {};
+}
+
+UIOperationBuffer UIOperationBuffer::TakeOperations() {
+  UIOperationBuffer result;
+  result.chunks_ = std::move(chunks_);
+  result.size_ = size_;
+  result.counts_ = counts_;
+  chunks_.clear();
+  size_ = 0;
+  counts_ = {};
+  return result;
+}
+
+void UIOperationBuffer::RunAll() { ReleaseChunks(true); }
+
+void UIOperationBuffer::Clear() { ReleaseChunks(false); }
+
+void UIOperationBuffer::ReleaseChunks(bool run) {
+  for (auto& chunk : chunks_) {
+    std::byte* data = chunk->data.get();
+    size_t offset = 0;
+    while (offset < chunk->used) {
+      auto* header = reinterpret_cast<OperationHeader*>(data + offset);
+      if (run) {
+        header->run_and_destroy(header + 1);
+      } else {
+        header->destroy(header + 1);
+      }
+      offset += header->size;
+    }
+    chunk->used = 0;
+    if (spare_chunks_.size() < kMaxSpareChunkCount &&
+        chunk->capacity == kChunkSize) {
+      spare_chunks_.emplace_back(std::move(chunk));
+    }
+  }
+  chunks_.clear();
+  size_ = 0;
+  counts_ = {};
+}
+
+void UIOperationBuffer::Recycle(UIOperationBuffer& other) {
+  while (!other.spare_chunks_.empty() &&
+         spare_chunks_.size() < kMaxSpareChunkCount) {
+    spare_chunks_.emplace_back(std::move(other.spare_chunks_.back()));
+    other.spare_chunks_.pop_back();
+  }
+}
+
+void ConcurrentUIOperationBuffer::Append(ConcurrentUIOperationBuffer& other) {
+  if (&other == this) {
+    return;
+  }
+  UIOperationBuffer operations = other.PopAll();
+  std::lock_guard<std::mutex> lock(mutex_);
+  buffer_.Append(operations);
+}
+
+UIOperationBuffer ConcurrentUIOperationBuffer::PopAll() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return buffer_.TakeOperations();
+}
+
+void ConcurrentUIOperationBuffer::Recycle(UIOperationBuffer& buffer) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  buffer_.Recycle(buffer);
+}
+
+bool ConcurrentUIOperationBuffer::Empty() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return buffer_.empty();
+}
+
+}  // namespace shell
+}  // namespace lynx
@@ -0,0 +1,166 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_SHELL_UI_OPERATION_BUFFER_H_
+#define CORE_SHELL_UI_OPERATION_BUFFER_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lynx {
+namespace shell {
+
+// Kinds of UI operations, only used for statistics. Operations enqueued as
+// base::closure are kGeneric.
+enum class UIOperationKind : uint8_t {
+  kGeneric = 0,
+  kCreateNode,
+  kInsertNode,
+  kRemoveNode,
+  kDestroyNode,
+  kUpdateProps,
+  kUpdateLayout,
+  kUpdateExtraData,
+  kPatching,
+  kList,
+  kFinish,
+  kCount,
+};
+
+const char* UIOperationKindName(UIOperationKind kind);
+
+using UIOperationCounts =
+    std::array<uint32_t, static_cast<size_t>(UIOperationKind::kCount)>;
+
+// Records UI operations into chunks of memory in order and runs them in a
+// batch. Each operation is a callable stored inline after a small header,
+// so that enqueueing it does not allocate until a chunk is full. The chunks
+// are kept after running and reused by the following operations. It is not
+// thread safe.
+class UIOperationBuffer {
+ public:
+  static constexpr size_t kChunkSize = 16 * 1024;
+  // Spare chunks kept for reuse, the others are freed after running.
+  static constexpr size_t kMaxSpareChunkCount = 16;
+
+  UIOperationBuffer() = default;
+  ~UIOperationBuffer();
+
+  UIOperationBuffer(UIOperationBuffer&& other) noexcept;
+  UIOperationBuffer& operator=(UIOperationBuffer&& other) noexcept;
+  UIOperationBuffer(const UIOperationBuffer&) = delete;
+  UIOperationBuffer& operator=(const UIOperationBuffer&) = delete;
+
+  template <typename F>
+  void Emplace(UIOperationKind kind, F&& operation) {
+    using Operation = std::decay_t<F>;
+    static_assert(alignof(Operation) <= kAlignment,
+                  "over-aligned UI operation");
+    void* storage =
+        Allocate(sizeof(Operation), kind, &RunAndDestroy<Operation>,
+                 &Destroy<Operation>);
+    new (storage) Operation(std::forward<F>(operation));
+  }
+
+  // Moves the operations of |other| to the end of this buffer.
+  void Append(UIOperationBuffer& other);
+
+  // Moves the operations out to a new buffer, keeping the spare chunks here.
+  UIOperationBuffer TakeOperations();
+
+  // Runs the operations in order and destroys them. Operations must not be
+  // added to this buffer while running.
+  void RunAll();
+
+  // Destroys the operations without running them.
+  void Clear();
+
+  // Takes the spare chunks of |other| for reuse.
+  void Recycle(UIOperationBuffer& other);
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+  const UIOperationCounts& counts() const { return counts_; }
+  size_t spare_chunk_count() const { return spare_chunks_.size(); }
+
+ private:
+  static constexpr size_t kAlignment = alignof(std::max_align_t);
+
+  using RunFunction = void (*)(void*);
+  using DestroyFunction = void (*)(void*);
+
+  struct alignas(kAlignment) OperationHeader {
+    RunFunction run_and_destroy;
+    DestroyFunction destroy;
+    // Size of the header and the operation, padded to kAlignment.
+    uint32_t size;
+    UIOperationKind kind;
+  };
+
+  struct Chunk {
+    explicit Chunk(size_t capacity);
+
+    std::unique_ptr<std::byte[]> data;
+    size_t capacity;
+    size_t used = 0;
+  };
+
+  template <typename Operation>
+  static void RunAndDestroy(void* storage) {
+    auto* operation = static_cast<Operation*>(storage);
+    (*operation)();
+    operation->~Operation();
+  }
+
+  template <typename Operation>
+  static void Destroy(void* storage) {
+    static_cast<Operation*>(storage)->~Operation();
+  }
+
+  void* Allocate(size_t size, UIOperationKind kind, RunFunction run,
+                 DestroyFunction destroy);
+  void ReleaseChunks(bool run);
+
+  std::vector<std::unique_ptr<Chunk>> chunks_;
+  std::vector<std::unique_ptr<Chunk>> spare_chunks_;
+  size_t size_ = 0;
+  UIOperationCounts counts_{};
+};
+
+// UIOperationBuffer guarded by a mutex, since UI operations are enqueued on
+// the engine and layout threads and run on the UI thread.
+class ConcurrentUIOperationBuffer {
+ public:
+  template <typename F>
+  void Emplace(UIOperationKind kind, F&& operation) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer_.Emplace(kind, std::forward<F>(operation));
+  }
+
+  // Moves the operations of |other| to the end of this buffer.
+  void Append(ConcurrentUIOperationBuffer& other);
+
+  UIOperationBuffer PopAll();
+
+  // Gives back the chunks of a buffer returned by PopAll() after running it.
+  void Recycle(UIOperationBuffer& buffer);
+
+  bool Empty();
+
+ private:
+  std::mutex mutex_;
+  UIOperationBuffer buffer_;
+};
+
+}  // namespace shell
+}  // namespace lynx
+
+#endif  // CORE_SHELL_UI_OPERATION_BUFFER_H_
@@ -0,0 +1,140 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/shell/ui_operation_buffer.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace shell {
+namespace testing {
+
+TEST(UIOperationBufferTest, RunInOrder) {
+  UIOperationBuffer buffer;
+  std::vector<int32_t> result;
+  for (int32_t i = 0; i < 10000; ++i) {
+    buffer.Emplace(i % 2 ? UIOperationKind::kInsertNode
+                         : UIOperationKind::kUpdateProps,
+                   [&result, i]() { result.push_back(i); });
+  }
+  EXPECT_EQ(buffer.size(), 10000u);
+  EXPECT_EQ(buffer.counts()[static_cast<size_t>(UIOperationKind::kInsertNode)],
+            5000u);
+  EXPECT_EQ(
+      buffer.counts()[static_cast<size_t>(UIOperationKind::kUpdateProps)],
+      5000u);
+
+  buffer.RunAll();
+  ASSERT_EQ(result.size(), 10000u);
+  for (int32_t i = 0; i < 10000; ++i) {
+    ASSERT_EQ(result[i], i);
+  }
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(buffer.counts()[static_cast<size_t>(UIOperationKind::kInsertNode)],
+            0u);
+}
+
+TEST(UIOperationBufferTest, ReuseChunks) {
+  UIOperationBuffer buffer;
+  int32_t result = 0;
+  for (int32_t i = 0; i < 5000; ++i) {
+    buffer.Emplace(UIOperationKind::kGeneric, [&result]() { ++result; });
+  }
+  buffer.RunAll();
+  EXPECT_EQ(result, 5000);
+  size_t spare_chunk_count = buffer.spare_chunk_count();
+  EXPECT_GT(spare_chunk_count, 1u);
+
+  // Runs again with the spare chunks, without allocating new ones.
+  for (int32_t i = 0; i < 5000; ++i) {
+    buffer.Emplace(UIOperationKind::kGeneric, [&result]() { ++result; });
+  }
+  EXPECT_EQ(buffer.spare_chunk_count(), 0u);
+  buffer.RunAll();
+  EXPECT_EQ(result, 10000);
+  EXPECT_EQ(buffer.spare_chunk_count(), spare_chunk_count);
+}
+
+TEST(UIOperationBufferTest, LargeOperation) {
+  UIOperationBuffer buffer;
+  std::array<int32_t, UIOperationBuffer::kChunkSize> data{};
+  data.back() = 42;
+  int32_t result = 0;
+  buffer.Emplace(UIOperationKind::kGeneric, [&result]() { ++result; });
+  buffer.Emplace(UIOperationKind::kGeneric,
+                 [&result, data]() { result += data.back(); });
+  buffer.Emplace(UIOperationKind::kGeneric, [&result]() { result *= 2; });
+  buffer.RunAll();
+  EXPECT_EQ(result, 86);
+  // The chunk of the large operation is freed.
+  EXPECT_EQ(buffer.spare_chunk_count(), 2u);
+}
+
+TEST(UIOperationBufferTest, AppendAndTake) {
+  UIOperationBuffer first;
+  UIOperationBuffer second;
+  std::vector<int32_t> result;
+  first.Emplace(UIOperationKind::kCreateNode,
+                [&result]() { result.push_back(1); });
+  second.Emplace(UIOperationKind::kFinish,
+                 [&result]() { result.push_back(2); });
+  first.Append(second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(first.size(), 2u);
+
+  UIOperationBuffer taken = first.TakeOperations();
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(taken.counts()[static_cast<size_t>(UIOperationKind::kFinish)], 1u);
+  taken.RunAll();
+  EXPECT_EQ(result, (std::vector<int32_t>{1, 2}));
+
+  first.Recycle(taken);
+  EXPECT_EQ(taken.spare_chunk_count(), 0u);
+  EXPECT_EQ(first.spare_chunk_count(), 2u);
+}
+
+TEST(UIOperationBufferTest, DestroyWithoutRunning) {
+  auto counter = std::make_shared<int32_t>(0);
+  bool executed = false;
+  {
+    UIOperationBuffer buffer;
+    buffer.Emplace(UIOperationKind::kGeneric,
+                   [counter, &executed]() { executed = true; });
+    EXPECT_EQ(counter.use_count(), 2);
+    buffer.Clear();
+    EXPECT_EQ(counter.use_count(), 1);
+
+    buffer.Emplace(UIOperationKind::kGeneric,
+                   [counter, &executed]() { executed = true; });
+    EXPECT_EQ(counter.use_count(), 2);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+  EXPECT_FALSE(executed);
+}
+
+TEST(UIOperationBufferTest, ConcurrentBuffer) {
+  ConcurrentUIOperationBuffer pending;
+  ConcurrentUIOperationBuffer operations;
+  int32_t result = 0;
+  pending.Emplace(UIOperationKind::kGeneric, [&result]() { ++result; });
+  EXPECT_TRUE(operations.Empty());
+  operations.Append(pending);
+  EXPECT_TRUE(pending.Empty());
+  EXPECT_FALSE(operations.Empty());
+
+  UIOperationBuffer popped = operations.PopAll();
+  EXPECT_TRUE(operations.Empty());
+  popped.RunAll();
+  EXPECT_EQ(result, 1);
+  operations.Recycle(popped);
+  EXPECT_EQ(popped.spare_chunk_count(), 0u);
+}
+
+}  // namespace testing
+}  // namespace shell
+}  // namespace lynx
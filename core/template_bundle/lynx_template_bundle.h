@@ -10,10 +10,10 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "base/include/concurrent_hash_map.h"
 #include "core/renderer/css/css_style_sheet_manager.h"
 #include "core/renderer/dom/element_bundle.h"
 #include "core/renderer/page_config.h"
@@ -32,33 +32,25 @@ namespace lynx {
 namespace tasm {
 class LepusChunkManager {
  public:
+  // Chunks are decoded by the async decoding thread and read by the tasm
+  // thread at the same time, so they are kept in sharded maps.
   using LepusChunkMap =
-      std::unordered_map<std::string, std::shared_ptr<lepus::ContextBundle>>;
+      base::ConcurrentHashMap<std::string,
+                              std::shared_ptr<lepus::ContextBundle>>;
 
   std::optional<std::shared_ptr<lepus::ContextBundle>> GetLepusChunk(
       const std::string &chunk_key) {
-    std::lock_guard<std::mutex> g_lock(lepus_chunk_mutex_);
-    decoded_lepus_chunks_.emplace(chunk_key);
-    auto iter = lepus_chunk_map_.find(chunk_key);
-    if (iter != lepus_chunk_map_.end()) {
-      return iter->second;
-    } else {
-      return std::nullopt;
-    }
+    decoded_lepus_chunks_.Emplace(chunk_key, true);
+    return lepus_chunk_map_.Find(chunk_key);
   }
 
   bool IsLepusChunkDecoded(const std::string &chunk_path) {
-    std::lock_guard<std::mutex> g_lock(lepus_chunk_mutex_);
-    if (decoded_lepus_chunks_.find(chunk_path) != decoded_lepus_chunks_.end()) {
-      return true;
-    }
-    return false;
+    return decoded_lepus_chunks_.Contains(chunk_path);
   }
 
   void AddLepusChunk(const std::string &chunk_key,
                      std::shared_ptr<lepus::ContextBundle> bundle) {
-    std::lock_guard<std::mutex> g_lock(lepus_chunk_mutex_);
-    lepus_chunk_map_.emplace(chunk_key, std::move(bundle));
+    lepus_chunk_map_.Emplace(chunk_key, std::move(bundle));
   }
 
   std::atomic_bool GetStopThread() const { return stop_thread_; }
@@ -66,10 +58,9 @@ class LepusChunkManager {
 
  private:
   LepusChunkMap lepus_chunk_map_{};
-  std::unordered_set<std::string> decoded_lepus_chunks_{};
+  base::ConcurrentHashMap<std::string, bool> decoded_lepus_chunks_{};
 
   volatile std::atomic_bool stop_thread_{false};
-  std::mutex lepus_chunk_mutex_;
 
   friend class TemplateBinaryReader;
   friend class LynxBinaryReader;
@@ -252,6 +243,7 @@ class LynxTemplateBundle final {
   // timing
   uint64_t decode_start_timestamp_{0};
   uint64_t decode_end_timestamp_{0};
+  std::vector<SectionDecodeTiming> section_decode_timings_;
 
   friend class LynxBinaryReader;
   friend class TemplateAssembler;
@@ -465,6 +465,11 @@ bool ElementBinaryReader::DecodeTemplates(ElementTemplateInfo& info) {
       return false;
     }
   }
+  // Flatten the template once, which is then instantiated for each use.
+  info.prototype_ = std::make_shared<ElementTemplatePrototype>(info.elements_);
+  // The elements are only read through the prototype from now on, so they are
+  // released instead of being kept for the lifetime of the template.
+  std::vector<ElementInfo>().swap(info.elements_);
   info.exist_ = true;
   return true;
 }
@@ -91,6 +91,12 @@ bool LynxBinaryBaseCSSReader::DecodeCSSFragment(SharedCSSFragment* fragment,
       fragment->SetEnableCSSInvalidation();
     }
     fragment->SetEnableCSSSelector();
+    // The selector programs are decoded after the rules, see
+    // TemplateBinaryWriter::EncodeCSSSelectorPrograms
+    if (Config::IsHigherOrEqual(compile_options_.target_sdk_version_,
+                                FEATURE_CSS_SELECTOR_PROGRAM)) {
+      fragment->rule_set()->SetCompileSelectors(false);
+    }
     DECODE_COMPACT_U32(selector_size);
     for (size_t i = 0; i < selector_size; i++) {
       DECODE_COMPACT_U32(flattened_size);
@@ -170,7 +176,28 @@ bool LynxBinaryBaseCSSReader::DecodeCSSFragment(SharedCSSFragment* fragment,
                                        std::move(token_list));
         }
         break;
+      case CSS_BINARY_SELECTOR_PROGRAM_TYPE: {
+        // The typed size is the byte size of the section.
+        DECODE_COMPACT_U32(program_size);
+        std::vector<css::SelectorProgram> programs;
+        // Each program takes at least one byte, so a malformed count does not
+        // reserve more than the rest of the stream.
+        programs.reserve(std::min<size_t>(
+            program_size, stream_->size() - stream_->offset()));
+        for (size_t i = 0; i < program_size; ++i) {
+          ERROR_UNLESS(DecodeCSSSelectorProgram(programs.emplace_back()));
+        }
+        if (fragment->rule_set()) {
+          fragment->rule_set()->SetSelectorPrograms(std::move(programs));
+        }
+        break;
+      }
       default:
+        // The types added after the font face are prefixed with their byte
+        // size, so that the unknown types can be skipped.
+        ERROR_UNLESS(CheckSize(static_cast<int>(typed_size),
+                               static_cast<uint32_t>(descriptor_end)));
+        Skip(typed_size);
         break;
     }
   }
@@ -179,6 +206,30 @@ bool LynxBinaryBaseCSSReader::DecodeCSSFragment(SharedCSSFragment* fragment,
   return true;
 }
 
+bool LynxBinaryBaseCSSReader::DecodeCSSSelectorProgram(
+    css::SelectorProgram& program) {
+  // No instructions if the selector is not compiled, see
+  // TemplateBinaryWriter::EncodeCSSSelectorProgram
+  DECODE_COMPACT_U32(instruction_size);
+  for (size_t i = 0; i < instruction_size; ++i) {
+    DECODE_U8(op);
+    DECODE_COMPACT_U32(operand);
+    ERROR_UNLESS(program.AddInstruction(op, operand));
+  }
+  DECODE_COMPACT_U32(string_size);
+  for (size_t i = 0; i < string_size; ++i) {
+    DECODE_STDSTR(str);
+    program.AddString(std::move(str));
+  }
+  DECODE_COMPACT_U32(hash_size);
+  for (size_t i = 0; i < hash_size; ++i) {
+    DECODE_U32(hash);
+    program.AddAncestorHash(hash);
+  }
+  ERROR_UNLESS(program.Verify());
+  return true;
+}
+
 bool LynxBinaryBaseCSSReader::DecodeCSSParseToken(CSSParseToken* token) {
   ERROR_UNLESS(DecodeCSSAttributes(token));
 
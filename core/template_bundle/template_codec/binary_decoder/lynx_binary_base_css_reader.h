@@ -10,6 +10,7 @@
 #include <utility>
 
 #include "core/renderer/css/css_value.h"
+#include "core/renderer/css/ng/matcher/selector_program.h"
 #include "core/renderer/css/shared_css_fragment.h"
 #include "core/runtime/vm/lepus/base_binary_reader.h"
 #include "core/template_bundle/template_codec/template_binary.h"
@@ -58,6 +59,7 @@ class LynxBinaryBaseCSSReader : public lepus::BaseBinaryReader {
                              const CSSParserConfigs&);
   bool DecodeCSSFontFaceToken(CSSFontFaceRule* token);
   bool DecodeCSSSelector(css::LynxCSSSelector* selector);
+  bool DecodeCSSSelectorProgram(css::SelectorProgram& program);
 
   bool DecodeCSSValue(tasm::CSSValue*);
   bool DecodeCSSValue(tasm::CSSValue* result, bool enable_css_parser,
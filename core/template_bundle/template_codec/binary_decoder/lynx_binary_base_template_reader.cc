@@ -422,11 +422,18 @@ bool LynxBinaryBaseTemplateReader::DecodeFlexibleTemplateBody() {
     }
 
     const auto &route = iter->second;
+    if (DispatchSection(route)) {
+      continue;
+    }
     stream_->Seek(route.start_offset_);
 
+    uint64_t start = base::CurrentSystemTimeMicroseconds();
     DECODE_U8(type);
     ERROR_UNLESS(DecodeSpecificSection(static_cast<BinarySection>(type)));
+    section_decode_timings_.push_back(
+        {s, start, base::CurrentSystemTimeMicroseconds()});
   }
+  ERROR_UNLESS(JoinDispatchedSections());
   return true;
 }
 
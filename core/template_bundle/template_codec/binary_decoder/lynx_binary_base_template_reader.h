@@ -9,6 +9,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "core/renderer/css/css_style_sheet_manager.h"
 #include "core/renderer/css/css_value.h"
@@ -92,6 +93,13 @@ class LynxBinaryBaseTemplateReader : public ElementBinaryReader {
   bool DecodeSpecificSection(const BinarySection& section);
   // For FlexibleTemplate
   bool DecodeFlexibleTemplateBody();
+  // Return true if the section has been dispatched to be decoded elsewhere, in
+  // which case it is skipped by DecodeFlexibleTemplateBody.
+  virtual bool DispatchSection(const TemplateBinary::SectionInfo& route) {
+    return false;
+  }
+  // Wait for all sections dispatched by DispatchSection and merge the results.
+  virtual bool JoinDispatchedSections() { return true; }
   // For NonFlexibleTemplate
   bool DeserializeSection();
   // JS section
@@ -193,6 +201,8 @@ class LynxBinaryBaseTemplateReader : public ElementBinaryReader {
 
   uint64_t decode_start_timestamp_{0};
   uint64_t decode_end_timestamp_{0};
+  // decode timing of each section of flexible template.
+  std::vector<SectionDecodeTiming> section_decode_timings_;
 };
 
 }  // namespace tasm
@@ -32,6 +32,12 @@ static constexpr const char* const kEnableAsyncDisplay = "enableAsyncDisplay";
 static constexpr const char* const kEnableImageDownsampling =
     "enableImageDownsampling";
 static constexpr const char* const kEnableFixedNew = "enableFixedNew";
+static constexpr const char* const kEnableParallelLayout =
+    "enableParallelLayout";
+static constexpr const char* const kEnableCSSFragmentPrefetch =
+    "enableCSSFragmentPrefetch";
+static constexpr const char* const kStyleSharingCandidateCount =
+    "styleSharingCandidateCount";
 static constexpr const char* const kEnableNewImage = "enableNewImage";
 static constexpr const char* const kLogBoxImageSizeWarningThreshold =
     "redBoxImageSizeWarningThreshold";
@@ -374,6 +380,24 @@ bool LynxBinaryConfigDecoder::DecodePageConfig(
     page_config.get()->SetEnableFixedNew(doc[kEnableFixedNew].GetBool());
   }
 
+  if (doc.HasMember(kEnableParallelLayout) &&
+      doc[kEnableParallelLayout].IsBool()) {
+    page_config.get()->SetEnableParallelLayout(
+        doc[kEnableParallelLayout].GetBool());
+  }
+
+  if (doc.HasMember(kEnableCSSFragmentPrefetch) &&
+      doc[kEnableCSSFragmentPrefetch].IsBool()) {
+    page_config.get()->SetEnableCSSFragmentPrefetch(
+        doc[kEnableCSSFragmentPrefetch].GetBool());
+  }
+
+  if (doc.HasMember(kStyleSharingCandidateCount) &&
+      doc[kStyleSharingCandidateCount].IsUint()) {
+    page_config.get()->SetStyleSharingCandidateCount(
+        doc[kStyleSharingCandidateCount].GetUint());
+  }
+
   if (doc.HasMember(kAbsoluteInContentBound) &&
       doc[kAbsoluteInContentBound].IsBool()) {
     page_config.get()->SetAbsoluteInContentBound(
@@ -55,6 +55,9 @@ class LynxBinaryLazyReaderDelegate : public LynxBinaryRecyclerDelegate {
 
   // css
   virtual bool DecodeCSSFragmentByIdInRender(int32_t fragment_id) = 0;
+  // Decode the fragment and its dependents on the css decoding thread ahead
+  // of DecodeCSSFragmentByIdInRender. Returns false if nothing is scheduled.
+  virtual bool PrefetchCSSFragmentByIdInRender(int32_t fragment_id) = 0;
 
   // element template
   virtual std::shared_ptr<ElementTemplateInfo> DecodeElementTemplateInRender(
@@ -4,9 +4,12 @@
 #include "core/template_bundle/template_codec/binary_decoder/lynx_binary_reader.h"
 
 #include <algorithm>
+#include <future>
 #include <string>
 #include <vector>
 
+#include "base/include/timer/time_utils.h"
+#include "core/base/threading/task_runner_manufactor.h"
 #include "core/renderer/utils/lynx_env.h"
 #include "core/runtime/vm/lepus/context.h"
 #include "core/runtime/vm/lepus/quick_context_pool.h"
@@ -37,6 +40,10 @@ bool LynxBinaryReader::DidDecodeHeader() {
         template_info_.GetProperty(kEnableConcurrentElement).Bool());
   }
 
+  enable_parallel_section_decode_ =
+      enable_parallel_section_decode_ ||
+      LynxEnv::GetInstance().EnableParallelSectionDecode();
+
   auto& tb = template_bundle();
   tb.total_size_ = total_size_;
   tb.is_lepusng_binary_ = is_lepusng_binary_;
@@ -111,7 +118,7 @@ bool LynxBinaryReader::GreedyDecodeCSSDescriptor(
                                    it->second.end + css_section_range_.start));
     fragment->SetEnableClassMerge(compile_options_.enable_css_class_merge_);
     auto fragment_id = fragment->id();
-    css_fragment_map.emplace(fragment_id, std::move(fragment));
+    css_fragment_map.Emplace(fragment_id, std::move(fragment));
   }
   stream_->Seek(css_section_range_.end);
   return true;
@@ -133,10 +140,12 @@ bool LynxBinaryReader::GreedyDecodeLepusChunk(
   for (auto it = start_offsets.begin(); it != start_offsets.end(); ++it) {
     stream_->Seek(lepus_chunk_route_.descriptor_offset_ + it->second);
 
-    chunk_map[it->first] = lepus::ContextBundle::Create(is_lepusng_binary_);
+    std::shared_ptr<lepus::ContextBundle> bundle =
+        lepus::ContextBundle::Create(is_lepusng_binary_);
+    chunk_map.InsertOrAssign(it->first, bundle);
 
-    ERROR_UNLESS(chunk_map[it->first]);
-    ERROR_UNLESS(DecodeContextBundle(chunk_map[it->first].get()));
+    ERROR_UNLESS(bundle);
+    ERROR_UNLESS(DecodeContextBundle(bundle.get()));
   }
   return true;
 }
@@ -258,6 +267,135 @@ bool LynxBinaryReader::GreedyDecodeElementTemplateSection() {
   return true;
 }
 
+bool LynxBinaryReader::IsSectionParallelDecodable(BinarySection section) {
+  switch (section) {
+    case BinarySection::CSS:
+    case BinarySection::JS:
+    case BinarySection::JS_BYTECODE:
+    case BinarySection::ROOT_LEPUS:
+    case BinarySection::LEPUS_CHUNK:
+    case BinarySection::CUSTOM_SECTIONS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::shared_ptr<LynxBinaryReader> LynxBinaryReader::CreateSectionReader() {
+  // The section reader shares the binary and the css / lepus chunk managers
+  // with this reader, other results are merged in MergeDispatchedSection.
+  std::shared_ptr<LynxBinaryReader> reader(
+      new LynxBinaryReader(stream_->DeriveInputStream()));
+  reader->compile_options_ = compile_options_;
+  reader->is_lepusng_binary_ = is_lepusng_binary_;
+  reader->enable_css_parser_ = enable_css_parser_;
+  reader->enable_css_variable_ = enable_css_variable_;
+  reader->enable_css_variable_multi_default_value_ =
+      enable_css_variable_multi_default_value_;
+  reader->enable_css_font_face_extension_ = enable_css_font_face_extension_;
+  reader->enable_pre_process_attributes_ = enable_pre_process_attributes_;
+
+  auto& tb = reader->template_bundle();
+  tb.compile_options_ = compile_options_;
+  tb.is_lepusng_binary_ = is_lepusng_binary_;
+  tb.SetCSSStyleManager(template_bundle().GetCSSStyleManager());
+  tb.SetLepusChunkManager(template_bundle().GetLepusChunkManager());
+  return reader;
+}
+
+bool LynxBinaryReader::DecodeDispatchedSection(BinarySection section) {
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, "DecodeDispatchedSection",
+              [section](lynx::perfetto::EventContext ctx) {
+                ctx.event()->add_debug_annotations(
+                    "section", std::to_string(static_cast<int>(section)));
+              });
+  uint64_t start = base::CurrentSystemTimeMicroseconds();
+  DECODE_U8(type);
+  ERROR_UNLESS(DecodeSpecificSection(static_cast<BinarySection>(type)));
+  section_decode_timings_.push_back(
+      {section, start, base::CurrentSystemTimeMicroseconds()});
+  return true;
+}
+
+bool LynxBinaryReader::DispatchSection(
+    const TemplateBinary::SectionInfo& route) {
+  if (!enable_parallel_section_decode_ ||
+      !IsSectionParallelDecodable(route.type_)) {
+    return false;
+  }
+
+  auto reader = CreateSectionReader();
+  reader->stream_->Seek(route.start_offset_);
+
+  std::promise<bool> promise;
+  std::future<bool> future = promise.get_future();
+  auto task = fml::MakeRefCounted<base::OnceTask<bool>>(
+      [reader, section = route.type_,
+       promise = std::move(promise)]() mutable {
+        promise.set_value(reader->DecodeDispatchedSection(section));
+      },
+      std::move(future));
+  base::TaskRunnerManufactor::PostTaskToConcurrentLoop(
+      [task]() { task->Run(); }, base::ConcurrentTaskType::HIGH_PRIORITY);
+  dispatched_sections_.push_back({route.type_, std::move(reader), task});
+  return true;
+}
+
+bool LynxBinaryReader::JoinDispatchedSections() {
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, "JoinDispatchedSections");
+  auto dispatched_sections = std::move(dispatched_sections_);
+  dispatched_sections_.clear();
+  bool result = true;
+  // Join in dispatch order, so that the results are merged in the same order
+  // as serial decoding. Tasks not yet started by the concurrent loop are run
+  // on the current thread.
+  for (auto& dispatched : dispatched_sections) {
+    dispatched.task->Run();
+    if (!dispatched.task->GetFuture().get()) {
+      if (result) {
+        error_message_ = dispatched.reader->error_message_;
+        result = false;
+      }
+      continue;
+    }
+    MergeDispatchedSection(dispatched.section, *dispatched.reader);
+    section_decode_timings_.insert(
+        section_decode_timings_.end(),
+        dispatched.reader->section_decode_timings_.begin(),
+        dispatched.reader->section_decode_timings_.end());
+  }
+  return result;
+}
+
+void LynxBinaryReader::MergeDispatchedSection(BinarySection section,
+                                              LynxBinaryReader& reader) {
+  auto& tb = template_bundle();
+  auto& reader_tb = reader.template_bundle();
+  switch (section) {
+    case BinarySection::CSS:
+      css_section_range_ = reader.css_section_range_;
+      break;
+    case BinarySection::JS:
+    case BinarySection::JS_BYTECODE:
+      for (const auto& [path, content] : reader.js_bundle_.GetAllJsFiles()) {
+        js_bundle_.AddJsContent(path, content);
+      }
+      break;
+    case BinarySection::ROOT_LEPUS:
+      tb.context_bundle_ = std::move(reader_tb.context_bundle_);
+      break;
+    case BinarySection::LEPUS_CHUNK:
+      lepus_chunk_route_ = std::move(reader.lepus_chunk_route_);
+      lepus_chunk_range_ = reader.lepus_chunk_range_;
+      break;
+    case BinarySection::CUSTOM_SECTIONS:
+      tb.custom_sections_ = std::move(reader_tb.custom_sections_);
+      break;
+    default:
+      break;
+  }
+}
+
 void LynxBinaryReader::RecordBinary() {
   template_bundle().SetBinary(
       std::vector<uint8_t>{stream_->begin(), stream_->end()});
@@ -275,6 +413,18 @@ LynxBinaryReader LynxBinaryReader::CreateLynxBinaryReader(
   return reader;
 }
 
+LynxBinaryReader LynxBinaryReader::CreateLynxBinaryReader(
+    std::shared_ptr<lepus::MappedBuffer> binary) {
+  auto input_stream =
+      std::make_unique<lynx::lepus::MappedInputStream>(std::move(binary));
+  auto reader = LynxBinaryReader{std::move(input_stream)};
+  if (tasm::LynxEnv::GetInstance().IsDevToolEnabled()) {
+    // record the original binary for debug if devtool is enabled
+    reader.RecordBinary();
+  }
+  return reader;
+}
+
 std::vector<base::String>& LynxBinaryReader::string_list() {
   // use the string_list of template_bundle, so that there is no need to move it
   return template_bundle().string_list();
@@ -287,6 +437,7 @@ LynxTemplateBundle& LynxBinaryReader::template_bundle() {
 LynxTemplateBundle LynxBinaryReader::GetTemplateBundle() {
   template_bundle().decode_start_timestamp_ = decode_start_timestamp_;
   template_bundle().decode_end_timestamp_ = decode_end_timestamp_;
+  template_bundle().section_decode_timings_ = section_decode_timings_;
   return std::move(template_bundle());
 }
 
@@ -13,6 +13,7 @@
 
 #include "base/trace/native/trace_event.h"
 #include "core/base/lynx_trace_categories.h"
+#include "core/base/thread/once_task.h"
 #include "core/renderer/template_themed.h"
 #include "core/template_bundle/lynx_template_bundle.h"
 #include "core/template_bundle/template_codec/binary_decoder/lynx_binary_base_template_reader.h"
@@ -32,9 +33,23 @@ class LynxBinaryReader : public LynxBinaryBaseTemplateReader {
   LynxBinaryReader& operator=(LynxBinaryReader&&) = default;
 
   static LynxBinaryReader CreateLynxBinaryReader(std::vector<uint8_t> binary);
+  // Decode directly from a read-only mapping or borrowed buffer without
+  // copying the whole binary.
+  static LynxBinaryReader CreateLynxBinaryReader(
+      std::shared_ptr<lepus::MappedBuffer> binary);
 
   LynxTemplateBundle GetTemplateBundle();
 
+  // Opt-in: decode independent sections of a flexible template on the
+  // concurrent loop and join them before DidDecodeTemplate.
+  void SetEnableParallelSectionDecode(bool enable) {
+    enable_parallel_section_decode_ = enable;
+  }
+
+  const std::vector<SectionDecodeTiming>& GetSectionDecodeTimings() const {
+    return section_decode_timings_;
+  }
+
  protected:
   LynxBinaryReader(std::unique_ptr<lepus::InputStream> stream)
       : LynxBinaryBaseTemplateReader(std::move(stream)) {
@@ -87,11 +102,31 @@ class LynxBinaryReader : public LynxBinaryBaseTemplateReader {
 
   virtual LynxTemplateBundle& template_bundle();
 
+  // parallel section decode
+  bool DispatchSection(const TemplateBinary::SectionInfo& route) override;
+  bool JoinDispatchedSections() override;
+  // Sections whose decoding result can be merged back from another reader.
+  virtual bool IsSectionParallelDecodable(BinarySection section);
+  virtual void MergeDispatchedSection(BinarySection section,
+                                      LynxBinaryReader& reader);
+
   StringKeyRouter lepus_chunk_route_;
   Range lepus_chunk_range_;
 
+  bool enable_parallel_section_decode_{false};
+
  private:
+  struct DispatchedSection {
+    BinarySection section;
+    std::shared_ptr<LynxBinaryReader> reader;
+    base::OnceTaskRefptr<bool> task;
+  };
+
   void RecordBinary();
+  std::shared_ptr<LynxBinaryReader> CreateSectionReader();
+  bool DecodeDispatchedSection(BinarySection section);
+
+  std::vector<DispatchedSection> dispatched_sections_;
 
   LynxTemplateBundle template_bundle_;
 };
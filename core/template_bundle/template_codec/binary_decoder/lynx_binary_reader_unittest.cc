@@ -0,0 +1,187 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#define private public
+#define protected public
+
+#include "core/template_bundle/template_codec/binary_decoder/lynx_binary_reader.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/runtime/vm/lepus/binary_input_stream.h"
+#include "core/runtime/vm/lepus/output_stream.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace test {
+
+namespace {
+
+using JsFiles = std::vector<std::pair<std::string, std::string>>;
+using Section = std::pair<BinarySection, std::vector<uint8_t>>;
+
+void WriteU8(lepus::OutputStream& stream, uint8_t value) {
+  stream.WriteData(&value, sizeof(value));
+}
+
+void WriteU32(lepus::OutputStream& stream, uint32_t value) {
+  stream.WriteData(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+}
+
+void WriteString(lepus::OutputStream& stream, const std::string& str) {
+  stream.WriteCompactU32(static_cast<uint32_t>(str.size()));
+  stream.WriteData(reinterpret_cast<const uint8_t*>(str.data()), str.size());
+}
+
+Section EncodeJSSection(const JsFiles& files) {
+  lepus::ByteArrayOutputStream stream;
+  WriteU8(stream, BinarySection::JS);
+  WriteU32(stream, static_cast<uint32_t>(files.size()));
+  for (const auto& [path, content] : files) {
+    WriteString(stream, path);
+    WriteString(stream, content);
+  }
+  return {BinarySection::JS, stream.byte_array()};
+}
+
+Section EncodeJSBytecodeSection(const JsFiles& files,
+                                piper::JSRuntimeType engine) {
+  lepus::ByteArrayOutputStream stream;
+  WriteU8(stream, BinarySection::JS_BYTECODE);
+  WriteU32(stream, static_cast<uint32_t>(engine));
+  WriteU32(stream, static_cast<uint32_t>(files.size()));
+  for (const auto& [path, content] : files) {
+    WriteString(stream, path);
+    stream.WriteCompactU64(content.size());
+    stream.WriteData(reinterpret_cast<const uint8_t*>(content.data()),
+                     content.size());
+  }
+  return {BinarySection::JS_BYTECODE, stream.byte_array()};
+}
+
+// The body of a flexible template: the section route followed by the
+// sections.
+std::vector<uint8_t> EncodeFlexibleTemplateBody(
+    const std::vector<Section>& sections) {
+  lepus::ByteArrayOutputStream stream;
+  WriteU8(stream, BinarySection::SECTION_ROUTE);
+  stream.WriteCompactU32(static_cast<uint32_t>(sections.size()));
+  uint32_t offset = 0;
+  for (const auto& [type, data] : sections) {
+    WriteU8(stream, type);
+    stream.WriteCompactU32(offset);
+    offset += static_cast<uint32_t>(data.size());
+    stream.WriteCompactU32(offset);
+  }
+  for (const auto& section : sections) {
+    stream.WriteData(section.second.data(), section.second.size());
+  }
+  return stream.byte_array();
+}
+
+std::unique_ptr<LynxBinaryReader> CreateReader(std::vector<uint8_t> binary,
+                                               bool parallel) {
+  std::unique_ptr<LynxBinaryReader> reader(new LynxBinaryReader(
+      std::make_unique<lepus::ByteArrayInputStream>(std::move(binary))));
+  reader->SetEnableParallelSectionDecode(parallel);
+  return reader;
+}
+
+// Content and whether it is bytecode, by path.
+std::map<std::string, std::pair<std::string, bool>> DumpJsFiles(
+    const piper::JsBundle& bundle) {
+  std::map<std::string, std::pair<std::string, bool>> files;
+  for (const auto& [path, content] : bundle.GetAllJsFiles()) {
+    const auto& buffer = content.GetBuffer();
+    files[path] = {
+        std::string(reinterpret_cast<const char*>(buffer->data()),
+                    buffer->size()),
+        content.IsByteCode()};
+  }
+  return files;
+}
+
+std::set<BinarySection> DecodedSections(const LynxBinaryReader& reader) {
+  std::set<BinarySection> sections;
+  for (const auto& timing : reader.GetSectionDecodeTimings()) {
+    sections.insert(timing.section);
+  }
+  return sections;
+}
+
+}  // namespace
+
+class LynxBinaryReaderParallelDecodeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    body_ = EncodeFlexibleTemplateBody({
+        EncodeJSSection({{"/app-service.js", "console.log('app');"},
+                         {"/card.js", "console.log('card');"}}),
+        EncodeJSBytecodeSection({{"/lazy.js", std::string("\x01\x00\x02", 3)}},
+                                piper::JSRuntimeType::quickjs),
+    });
+  }
+
+  std::vector<uint8_t> body_;
+};
+
+TEST_F(LynxBinaryReaderParallelDecodeTest, SameResultAsSerialDecode) {
+  auto serial = CreateReader(body_, false);
+  ASSERT_TRUE(serial->DecodeFlexibleTemplateBody());
+  EXPECT_TRUE(serial->dispatched_sections_.empty());
+
+  auto parallel = CreateReader(body_, true);
+  ASSERT_TRUE(parallel->DecodeFlexibleTemplateBody());
+  EXPECT_TRUE(parallel->dispatched_sections_.empty());
+
+  const auto files = DumpJsFiles(serial->js_bundle_);
+  ASSERT_EQ(files.size(), 3u);
+  EXPECT_EQ(files.at("/card.js"),
+            std::make_pair(std::string("console.log('card');"), false));
+  EXPECT_EQ(files.at("/lazy.js"),
+            std::make_pair(std::string("\x01\x00\x02", 3), true));
+  EXPECT_EQ(DumpJsFiles(parallel->js_bundle_), files);
+
+  const std::set<BinarySection> sections{BinarySection::JS,
+                                         BinarySection::JS_BYTECODE};
+  EXPECT_EQ(DecodedSections(*serial), sections);
+  EXPECT_EQ(DecodedSections(*parallel), sections);
+}
+
+TEST_F(LynxBinaryReaderParallelDecodeTest, TruncatedSection) {
+  // Cut the end of the bytecode section, which is the last one.
+  body_.resize(body_.size() - 2);
+  for (bool parallel : {false, true}) {
+    auto reader = CreateReader(body_, parallel);
+    EXPECT_FALSE(reader->DecodeFlexibleTemplateBody()) << parallel;
+    EXPECT_TRUE(reader->dispatched_sections_.empty()) << parallel;
+  }
+}
+
+TEST_F(LynxBinaryReaderParallelDecodeTest, MalformedSection) {
+  // Bytecode of an unsupported engine.
+  body_ = EncodeFlexibleTemplateBody({
+      EncodeJSSection({{"/app-service.js", "console.log('app');"}}),
+      EncodeJSBytecodeSection({{"/lazy.js", "bytecode"}},
+                              piper::JSRuntimeType::v8),
+  });
+  auto serial = CreateReader(body_, false);
+  EXPECT_FALSE(serial->DecodeFlexibleTemplateBody());
+
+  auto parallel = CreateReader(body_, true);
+  EXPECT_FALSE(parallel->DecodeFlexibleTemplateBody());
+  EXPECT_TRUE(parallel->dispatched_sections_.empty());
+  // The results of the failed section are not merged.
+  EXPECT_FALSE(parallel->js_bundle_.GetJsContent("/lazy.js").has_value());
+}
+
+}  // namespace test
+}  // namespace tasm
+}  // namespace lynx
@@ -58,7 +58,8 @@ bool TemplateBinaryReader::DecodeCSSDescriptor() {
   if (enable_css_async_decode) {
     TRACE_EVENT(LYNX_TRACE_CATEGORY, "DecodeCSSDescriptorWithThread");
     const int length = css_section_range_.end - css_section_range_.start;
-    auto css_reader = TemplateBinaryReader::Create(stream_->cursor(), length);
+    auto css_reader = TemplateBinaryReader::Create(
+        stream_->DeriveSubInputStream(stream_->offset(), length));
     css_reader->CopyForCSSAsyncDecode(*this);
 
     base::TaskRunnerManufactor::PostTaskToConcurrentLoop(
@@ -74,9 +75,7 @@ bool TemplateBinaryReader::DecodeCSSDescriptor() {
 }
 
 std::unique_ptr<TemplateBinaryReader> TemplateBinaryReader::Create(
-    const uint8_t* begin, size_t size) {
-  auto binary_stream =
-      std::make_unique<lepus::ByteArrayInputStream>(begin, size);
+    std::unique_ptr<lepus::InputStream> binary_stream) {
   auto reader = std::make_unique<TemplateBinaryReader>(
       nullptr, nullptr, std::move(binary_stream));
   return reader;
@@ -157,6 +156,77 @@ bool TemplateBinaryReader::DecodeCSSFragmentByIdInRender(int32_t id) {
   return true;
 }
 
+bool TemplateBinaryReader::PrefetchCSSFragmentByIdInRender(int32_t id) {
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, "PrefetchCSSFragment");
+  const auto& manager = template_bundle().GetCSSStyleManager();
+  if (manager->route_.fragment_ranges.find(id) ==
+      manager->route_.fragment_ranges.end()) {
+    return false;
+  }
+  auto cancelled = manager->StartCSSFragmentPrefetch(id);
+  if (!cancelled) {
+    return false;
+  }
+  // The derived stream shares the binary, only the offset is its own.
+  auto css_reader = TemplateBinaryReader::Create(stream_->DeriveInputStream());
+  css_reader->CopyForCSSAsyncDecode(*this);
+  base::TaskRunnerManufactor::PostTaskToConcurrentLoop(
+      [css_reader = std::move(css_reader), manager, id,
+       cancelled = std::move(cancelled)]() mutable {
+        css_reader->PrefetchCSSFragmentAsync(std::move(manager), id,
+                                             *cancelled);
+      },
+      base::ConcurrentTaskType::NORMAL_PRIORITY);
+  return true;
+}
+
+bool TemplateBinaryReader::PrefetchCSSFragmentAsync(
+    std::shared_ptr<CSSStyleSheetManager> manager, int32_t id,
+    const std::atomic_bool& cancelled) {
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, "PrefetchCSSFragmentAsync");
+  const auto& fragment_ranges = manager->route_.fragment_ranges;
+  std::vector<int32_t> pending_ids{id};
+  std::unordered_set<int32_t> visited_ids{id};
+  while (!pending_ids.empty()) {
+    if (manager->IsCSSFragmentPrefetchCancelled(cancelled)) {
+      break;
+    }
+    int32_t current_id = pending_ids.back();
+    pending_ids.pop_back();
+    auto it = fragment_ranges.find(current_id);
+    if (it == fragment_ranges.end()) {
+      continue;
+    }
+    // The fragment may have been decoded on the tasm thread, its dependents
+    // are still prefetched.
+    std::vector<int32_t> dependent_ids;
+    bool decoded = manager->GetCSSFragmentMap()->Visit(
+        current_id, [&dependent_ids](const auto& fragment) {
+          dependent_ids = fragment->dependent_ids();
+        });
+    if (!decoded) {
+      auto fragment = std::make_unique<SharedCSSFragment>(manager.get());
+      stream_->Seek(css_section_range_.start + it->second.start);
+      ERROR_UNLESS(DecodeCSSFragment(
+          fragment.get(), it->second.end + css_section_range_.start));
+      fragment->SetEnableClassMerge(compile_options_.enable_css_class_merge_);
+      dependent_ids = fragment->dependent_ids();
+      // Keeps the fragment decoded on the tasm thread if there is one.
+      manager->AddSharedCSSFragment(std::move(fragment));
+    }
+    for (int32_t dependent_id : dependent_ids) {
+      if (visited_ids.insert(dependent_id).second) {
+        pending_ids.push_back(dependent_id);
+      }
+    }
+  }
+  return true;
+}
+
+bool TemplateBinaryReader::IsSectionParallelDecodable(BinarySection section) {
+  return section == BinarySection::JS || section == BinarySection::JS_BYTECODE;
+}
+
 bool TemplateBinaryReader::DidDecodeTemplate() {
   ERROR_UNLESS(LynxBinaryReader::DidDecodeTemplate());
   // when we construct a TemplateBinaryReader outside of loadTemplate
@@ -231,8 +301,8 @@ bool TemplateBinaryReader::DecodeLepusChunk() {
   if (enable_lepus_chunk_async) {
     // decode lepus chunk async
     const int length = lepus_chunk_range_.end - lepus_chunk_range_.start;
-    auto lepus_chunk_reader =
-        TemplateBinaryReader::Create(stream_->cursor(), length);
+    auto lepus_chunk_reader = TemplateBinaryReader::Create(
+        stream_->DeriveSubInputStream(stream_->offset(), length));
     lepus_chunk_reader->CopyForCSSAsyncDecode(*this);
 
     auto& lepus_chunk_manager = template_bundle().GetLepusChunkManager();
@@ -281,9 +351,8 @@ LynxTemplateBundle& TemplateBinaryReader::template_bundle() {
 std::unique_ptr<LynxBinaryRecyclerDelegate>
 TemplateBinaryReader::CreateRecycler() {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, "CompleteDecode");
-  // 0. copy the binary the template bundle
-  auto recycler =
-      TemplateBinaryReader::Create(stream_->begin(), stream_->size());
+  // 0. share the binary with the recycler and copy the template bundle
+  auto recycler = TemplateBinaryReader::Create(stream_->DeriveInputStream());
   recycler->template_bundle() = template_bundle();
 
   // 1. copy css settings
@@ -5,6 +5,7 @@
 #ifndef CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_BINARY_DECODER_TEMPLATE_BINARY_READER_H_
 #define CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_BINARY_DECODER_TEMPLATE_BINARY_READER_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -60,6 +61,7 @@ class TemplateBinaryReader : public LynxBinaryReader,
 
   // lazy reader delegate;
   bool DecodeCSSFragmentByIdInRender(int32_t fragment_id) override;
+  bool PrefetchCSSFragmentByIdInRender(int32_t fragment_id) override;
   std::shared_ptr<ElementTemplateInfo> DecodeElementTemplateInRender(
       const std::string& key) override;
   const std::shared_ptr<ParsedStyles>& GetParsedStylesInRender(
@@ -83,12 +85,18 @@ class TemplateBinaryReader : public LynxBinaryReader,
   // Async CSS Descriptor
   virtual bool DecodeCSSDescriptor() override;
   bool DecodeCSSFragmentAsync(std::shared_ptr<CSSStyleSheetManager> manager);
+  bool PrefetchCSSFragmentAsync(std::shared_ptr<CSSStyleSheetManager> manager,
+                                int32_t id, const std::atomic_bool& cancelled);
   bool GetCSSLazyDecode();
   bool GetCSSAsyncDecode();
 
   // At runtime decoding, no need to prepare context
   void PrepareContext() override {}
 
+  // CSS, lepus and element templates may be lazily decoded by the recycler at
+  // runtime, only self-contained sections are decoded in parallel.
+  bool IsSectionParallelDecodable(BinarySection section) override;
+
   virtual bool DidDecodeTemplate() override;
 
   // parsed styles
@@ -107,9 +115,10 @@ class TemplateBinaryReader : public LynxBinaryReader,
   TemplateEntry* entry_;
 
  private:
-  // create a new template binary reader from binary
-  static std::unique_ptr<TemplateBinaryReader> Create(const uint8_t* begin,
-                                                      size_t size);
+  // create a new template binary reader from a derived stream, the derived
+  // stream shares the binary with the original one when possible
+  static std::unique_ptr<TemplateBinaryReader> Create(
+      std::unique_ptr<lepus::InputStream> binary_stream);
 
   void CopyForCSSAsyncDecode(const TemplateBinaryReader& other);
 };
@@ -18,6 +18,8 @@
 #include <utility>
 
 #include "base/include/sorted_for_each.h"
+#include "core/renderer/css/ng/matcher/selector_program.h"
+#include "core/renderer/css/ng/selector/lynx_css_selector_list.h"
 #include "core/renderer/utils/base/tasm_constants.h"
 #include "core/renderer/utils/value_utils.h"
 #include "core/runtime/jscache/quickjs/bytecode/quickjs_bytecode_provider.h"
@@ -358,6 +360,66 @@ void TemplateBinaryWriter::EncodeCSSFragment(
                             });
     }
   }
+
+  // The decoders before FEATURE_CSS_SELECTOR_PROGRAM can not skip unknown
+  // types, so the selector programs are only encoded for the versions that
+  // know them. They save compiling the selectors at each load of the bundle,
+  // which is still done by css::RuleSet for the bundles without them.
+  if (compile_options_.enable_css_selector_ &&
+      lynx::tasm::Config::IsHigherOrEqual(compile_options_.target_sdk_version_,
+                                          FEATURE_CSS_SELECTOR_PROGRAM)) {
+    EncodeCSSSelectorPrograms(fragment);
+  }
+}
+
+void TemplateBinaryWriter::EncodeCSSSelectorPrograms(
+    encoder::SharedCSSFragment* fragment) {
+  // One program for each selector in the selector lists, in the same order as
+  // the rules added to css::RuleSet by the decoder.
+  std::vector<css::SelectorProgram> programs;
+  for (const auto& it : fragment->selector_tuple()) {
+    if (it.flattened_size == 0 || !it.selector_arr) {
+      continue;
+    }
+    for (const css::LynxCSSSelector* selector = it.selector_arr.get();
+         selector; selector = css::LynxCSSSelectorList::Next(*selector)) {
+      programs.emplace_back(css::SelectorProgram::Compile(*selector));
+    }
+  }
+  if (programs.empty()) {
+    return;
+  }
+  WriteU8(CSS_BINARY_SELECTOR_PROGRAM_TYPE);
+  // Unlike the font face, the typed size is the byte size of the section, so
+  // that the decoders not knowing the type can skip it.
+  uint32_t section_start = static_cast<uint32_t>(stream()->size());
+  WriteCompactU32(programs.size());
+  for (const auto& program : programs) {
+    EncodeCSSSelectorProgram(program);
+  }
+  uint32_t size_start = static_cast<uint32_t>(stream()->size());
+  WriteCompactU32(size_start - section_start);
+  stream_->Move(section_start, size_start,
+                static_cast<uint32_t>(stream()->size()) - size_start);
+}
+
+void TemplateBinaryWriter::EncodeCSSSelectorProgram(
+    const css::SelectorProgram& program) {
+  // No instructions if the selector is not compiled, which is matched by
+  // css::SelectorMatcher.
+  WriteCompactU32(program.instructions().size());
+  for (const auto& instruction : program.instructions()) {
+    WriteU8(instruction.op);
+    WriteCompactU32(instruction.operand);
+  }
+  WriteCompactU32(program.strings().size());
+  for (const auto& str : program.strings()) {
+    EncodeUtf8Str(str.c_str(), str.length());
+  }
+  WriteCompactU32(program.ancestor_hashes().size());
+  for (uint32_t hash : program.ancestor_hashes()) {
+    WriteU32(hash);
+  }
 }
 
 bool TemplateBinaryWriter::EncodeCSSParseToken(CSSParseToken* token) {
@@ -25,6 +25,10 @@
 #include "core/template_bundle/template_codec/ttml_constant.h"
 
 namespace lynx {
+namespace css {
+class SelectorProgram;
+}  // namespace css
+
 namespace tasm {
 
 class CSSParseToken;
@@ -124,6 +128,8 @@ class TemplateBinaryWriter : public CSRElementBinaryWriter {
   bool EncodeLynxCSSSelectorTuple(
       const encoder::LynxCSSSelectorTuple& selector_tuple);
   bool EncodeCSSSelector(const css::LynxCSSSelector* selector);
+  void EncodeCSSSelectorPrograms(encoder::SharedCSSFragment* fragment);
+  void EncodeCSSSelectorProgram(const css::SelectorProgram& program);
 
   // JS section
   void SerializeJSSource();
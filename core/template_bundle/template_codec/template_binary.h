@@ -92,6 +92,13 @@ struct Range {
   }
 };
 
+// Start and end timestamps (in microseconds) of decoding one section.
+struct SectionDecodeTiming {
+  BinarySection section;
+  uint64_t start;
+  uint64_t end;
+};
+
 typedef Range PageRange;
 struct PageRoute {
   std::unordered_map<int, PageRange> page_ranges;
@@ -35,8 +35,10 @@ void LynxGlobalDevToolMediator::RecordingStart(
     const Json::Value& message) {
   LOGI("start recording");
   int64_t id = message["id"].asInt64();
+  bool binary_format = message["params"]["recordFormat"].asString() == "binary";
   if (ui_task_runner_) {
-    RunOnTaskRunner(ui_task_runner_, [] {
+    RunOnTaskRunner(ui_task_runner_, [binary_format] {
+      lynx::tasm::recorder::RecorderController::SetBinaryFormat(binary_format);
       lynx::tasm::recorder::RecorderController::StartRecord();
     });
   } else {
@@ -74,6 +76,7 @@ void LynxGlobalDevToolMediator::RecordingEnd(
             msg["params"]["stream"] = handlers;
             msg["params"]["filenames"] = filenames;
             msg["params"]["sessionIDs"] = session_ids;
+            // The binary records are converted to json at EndRecord.
             msg["params"]["recordFormat"] = "json";
             sender->SendMessage("CDP", msg);
           });
@@ -158,4 +158,14 @@ public class LayoutNode {
       mCustomMeasureFunc.align(param, context);
     }
   }
+
+  /**
+   * Returns a key identifying the measured content, with which the native layout shares the
+   * results of trying measures among nodes. Nodes with the same key must measure the same under
+   * the same constraints and font scale. Returns 0 if the results should not be shared.
+   */
+  @CalledByNative
+  public long getMeasureCacheKey() {
+    return 0;
+  }
 }
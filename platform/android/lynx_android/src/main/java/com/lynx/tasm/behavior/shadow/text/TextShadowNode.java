@@ -68,6 +68,8 @@ public class TextShadowNode extends BaseTextShadowNode implements CustomMeasureF
 
   protected int mEllipsisCount = 0;
 
+  private long mMeasureCacheKey = 0;
+
   public TextShadowNode() {
     initMeasureFunction();
   }
@@ -84,9 +86,37 @@ public class TextShadowNode extends BaseTextShadowNode implements CustomMeasureF
       mRenderer = null;
       mTruncationSpannableString = null;
       prepareSpan();
+      mMeasureCacheKey = computeMeasureCacheKey();
     }
   }
 
+  @Override
+  public long getMeasureCacheKey() {
+    return mMeasureCacheKey;
+  }
+
+  private long computeMeasureCacheKey() {
+    // Subclasses may measure differently. Inline views and images are measured by their own nodes
+    // and the truncation by the truncation node, neither of which is a part of the span.
+    TextAttributes attributes = getTextAttributes();
+    if (getClass() != TextShadowNode.class || mSpannableString == null
+        || mTruncationShadowNode != null || attributes.hasInlineViewSpan()
+        || attributes.hasImageSpan()) {
+      return 0;
+    }
+    // The same as the hash of TextRendererKey except for the constraints, which are a part of the
+    // native key.
+    final int prime = 31;
+    int result = attributes.hashCode();
+    result = result * prime + mWordBreakStrategy;
+    result = result * prime + (mEnableTailColorConvert ? 1 : 0);
+    result = result * prime + (isTextRefactorEnabled() ? 1 : 0);
+    result = result * prime + (isTextBoringLayoutEnabled() ? 1 : 0);
+    long key = ((long) mSpannableString.hashCode() << 32) | (result & 0xFFFFFFFFL);
+    // 0 disables the sharing.
+    return key == 0 ? 1 : key;
+  }
+
   protected boolean isBoringSpan() {
     return ((getChildCount() == 1 && getChildAt(0) instanceof RawTextShadowNode)
                || (getChildCount() == 0 && mText != null))
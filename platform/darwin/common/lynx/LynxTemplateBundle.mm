@@ -7,7 +7,6 @@
 #import "LynxTemplateBundle+Converter.h"
 #include "core/renderer/dom/ios/lepus_value_converter.h"
 #include "core/runtime/jscache/js_cache_manager_facade.h"
-#import "core/shell/ios/data_utils.h"
 #include "core/template_bundle/template_codec/binary_decoder/lynx_binary_reader.h"
 
 @implementation LynxTemplateBundle {
@@ -29,7 +28,13 @@
         return self;
       }
     }
-    auto source = ConvertNSBinary(tem);
+    // Decode from the bytes of an immutable copy of `tem` directly, the copy is
+    // retained by the buffer, so the binary is not copied into a vector.
+    NSData* binary = [tem copy];
+    std::shared_ptr<void> owner((__bridge_retained void*)binary,
+                                [](void* data) { CFRelease(data); });
+    auto source = lynx::lepus::MappedBuffer::Borrow(static_cast<const uint8_t*>(binary.bytes),
+                                                    binary.length, std::move(owner));
     auto decoder = lynx::tasm::LynxBinaryReader::CreateLynxBinaryReader(std::move(source));
     if (decoder.Decode()) {
       // decode success.
@@ -0,0 +1,95 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "base/include/concurrent_hash_map.h"
+#include "third_party/benchmark/include/benchmark/benchmark.h"
+
+namespace lynx {
+namespace base {
+
+// These tests compare ConcurrentHashMap with an unordered_map guarded by
+// a single mutex, which is how CSSStyleSheetManager and LepusChunkManager
+// used to share decoded results between the async decoding thread and the
+// tasm thread. Each thread mostly reads and occasionally writes.
+
+namespace {
+
+constexpr int32_t kKeyCount = 1024;
+// One write every kWriteInterval operations.
+constexpr int32_t kWriteInterval = 8;
+
+class MutexHashMap {
+ public:
+  void InsertOrAssign(int32_t key, int32_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+
+  bool Contains(int32_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.find(key) != map_.end();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<int32_t, int32_t> map_;
+};
+
+template <typename Map>
+void RunMixedOperations(benchmark::State& state, Map& map) {
+  int32_t key = static_cast<int32_t>(state.thread_index()) * 131;
+  int32_t op = 0;
+  for (auto _ : state) {
+    key = (key + 1) % kKeyCount;
+    if (++op % kWriteInterval == 0) {
+      map.InsertOrAssign(key, op);
+    } else {
+      benchmark::DoNotOptimize(map.Contains(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+static void BM_MutexHashMap_Mixed(benchmark::State& state) {
+  static MutexHashMap* map = nullptr;
+  if (state.thread_index() == 0) {
+    map = new MutexHashMap();
+    for (int32_t i = 0; i < kKeyCount; i += 2) {
+      map->InsertOrAssign(i, i);
+    }
+  }
+  RunMixedOperations(state, *map);
+  if (state.thread_index() == 0) {
+    delete map;
+    map = nullptr;
+  }
+}
+
+static void BM_ConcurrentHashMap_Mixed(benchmark::State& state) {
+  using Map = ConcurrentHashMap<int32_t, int32_t>;
+  static Map* map = nullptr;
+  if (state.thread_index() == 0) {
+    map = new Map();
+    for (int32_t i = 0; i < kKeyCount; i += 2) {
+      map->InsertOrAssign(i, i);
+    }
+  }
+  RunMixedOperations(state, *map);
+  if (state.thread_index() == 0) {
+    delete map;
+    map = nullptr;
+  }
+}
+
+BENCHMARK(BM_MutexHashMap_Mixed)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ConcurrentHashMap_Mixed)->ThreadRange(1, 8)->UseRealTime();
+
+}  // namespace base
+}  // namespace lynx
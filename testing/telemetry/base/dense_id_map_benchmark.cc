@@ -0,0 +1,154 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "base/include/dense_id_map.h"
+#include "third_party/benchmark/include/benchmark/benchmark.h"
+
+namespace lynx {
+namespace base {
+
+// These tests compare DenseIdMap with std::unordered_map as the id to node
+// registry of pages with 10k to 100k nodes. Ids start from kInitialImplId
+// and are allocated one by one, the same as ElementManager does.
+
+namespace {
+
+constexpr int32_t kFirstId = 10;
+
+struct FakeNode {
+  int32_t id;
+};
+
+std::vector<int32_t> ShuffledIds(int32_t count) {
+  std::vector<int32_t> ids(count);
+  for (int32_t i = 0; i < count; ++i) {
+    ids[i] = kFirstId + i;
+  }
+  std::shuffle(ids.begin(), ids.end(), std::mt19937(42));
+  return ids;
+}
+
+std::vector<FakeNode> MakeNodes(int32_t count) {
+  std::vector<FakeNode> nodes(count);
+  for (int32_t i = 0; i < count; ++i) {
+    nodes[i].id = kFirstId + i;
+  }
+  return nodes;
+}
+
+}  // namespace
+
+static void BM_UnorderedMap_Record(benchmark::State& state) {
+  auto nodes = MakeNodes(static_cast<int32_t>(state.range(0)));
+  for (auto _ : state) {
+    std::unordered_map<int, FakeNode*> map;
+    for (auto& node : nodes) {
+      map[node.id] = &node;
+    }
+    benchmark::DoNotOptimize(map);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_DenseIdMap_Record(benchmark::State& state) {
+  auto nodes = MakeNodes(static_cast<int32_t>(state.range(0)));
+  for (auto _ : state) {
+    DenseIdMap<FakeNode*> map;
+    for (auto& node : nodes) {
+      map[node.id] = &node;
+    }
+    benchmark::DoNotOptimize(map);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_UnorderedMap_Get(benchmark::State& state) {
+  auto count = static_cast<int32_t>(state.range(0));
+  auto nodes = MakeNodes(count);
+  auto ids = ShuffledIds(count);
+  std::unordered_map<int, FakeNode*> map;
+  for (auto& node : nodes) {
+    map[node.id] = &node;
+  }
+  for (auto _ : state) {
+    for (auto id : ids) {
+      auto it = map.find(id);
+      benchmark::DoNotOptimize(it != map.end() ? it->second : nullptr);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_DenseIdMap_Get(benchmark::State& state) {
+  auto count = static_cast<int32_t>(state.range(0));
+  auto nodes = MakeNodes(count);
+  auto ids = ShuffledIds(count);
+  DenseIdMap<FakeNode*> map;
+  for (auto& node : nodes) {
+    map[node.id] = &node;
+  }
+  for (auto _ : state) {
+    for (auto id : ids) {
+      auto node = map.Find(id);
+      benchmark::DoNotOptimize(node != nullptr ? *node : nullptr);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Removes and re-creates half of the nodes, like a list recycling its items.
+static void BM_UnorderedMap_Churn(benchmark::State& state) {
+  auto count = static_cast<int32_t>(state.range(0));
+  auto nodes = MakeNodes(count * 2);
+  std::unordered_map<int, FakeNode*> map;
+  for (int32_t i = 0; i < count; ++i) {
+    map[nodes[i].id] = &nodes[i];
+  }
+  for (auto _ : state) {
+    for (int32_t i = 0; i < count / 2; ++i) {
+      map.erase(nodes[i].id);
+      map[nodes[i + count].id] = &nodes[i + count];
+    }
+    for (int32_t i = 0; i < count / 2; ++i) {
+      map.erase(nodes[i + count].id);
+      map[nodes[i].id] = &nodes[i];
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count * 2);
+}
+
+static void BM_DenseIdMap_Churn(benchmark::State& state) {
+  auto count = static_cast<int32_t>(state.range(0));
+  auto nodes = MakeNodes(count * 2);
+  DenseIdMap<FakeNode*> map;
+  for (int32_t i = 0; i < count; ++i) {
+    map[nodes[i].id] = &nodes[i];
+  }
+  for (auto _ : state) {
+    for (int32_t i = 0; i < count / 2; ++i) {
+      map.Erase(nodes[i].id);
+      map[nodes[i + count].id] = &nodes[i + count];
+    }
+    for (int32_t i = 0; i < count / 2; ++i) {
+      map.Erase(nodes[i + count].id);
+      map[nodes[i].id] = &nodes[i];
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count * 2);
+}
+
+BENCHMARK(BM_UnorderedMap_Record)->RangeMultiplier(10)->Range(10000, 100000);
+BENCHMARK(BM_DenseIdMap_Record)->RangeMultiplier(10)->Range(10000, 100000);
+BENCHMARK(BM_UnorderedMap_Get)->RangeMultiplier(10)->Range(10000, 100000);
+BENCHMARK(BM_DenseIdMap_Get)->RangeMultiplier(10)->Range(10000, 100000);
+BENCHMARK(BM_UnorderedMap_Churn)->RangeMultiplier(10)->Range(10000, 100000);
+BENCHMARK(BM_DenseIdMap_Churn)->RangeMultiplier(10)->Range(10000, 100000);
+
+}  // namespace base
+}  // namespace lynx
@@ -3,6 +3,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <string>
+#include <vector>
 
 #include "core/renderer/utils/value_utils.h"
 #include "core/runtime/bindings/lepus/renderer_functions.h"
@@ -11,6 +12,7 @@
 #include "core/runtime/vm/lepus/json_parser.h"
 #include "core/runtime/vm/lepus/jsvalue_helper.h"
 #include "core/runtime/vm/lepus/lepus_value.h"
+#include "core/runtime/vm/lepus/path_parser.h"
 #include "core/runtime/vm/lepus/quick_context.h"
 #include "third_party/benchmark/include/benchmark/benchmark.h"
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
@@ -656,6 +658,66 @@ static void BM_TableSetValueEmplaceKeyConflict(benchmark::State& state) {
   }
 }
 
+// Objects in data of pages mostly have no more than 8 properties, which are
+// stored and searched linearly by Dictionary.
+static void BM_TableSmallObjectSetGet(benchmark::State& state) {
+  std::vector<base::String> keys;
+  for (int64_t i = 0; i < state.range(0); i++) {
+    keys.emplace_back("prop_" + std::to_string(i));
+  }
+
+  for (auto _ : state) {
+    auto dict = lepus::Dictionary::Create();
+    for (size_t i = 0; i < keys.size(); i++) {
+      dict->SetValue(keys[i], static_cast<int32_t>(i));
+    }
+    for (const auto& key : keys) {
+      benchmark::DoNotOptimize(dict->GetValue(key));
+    }
+  }
+}
+
+static void BM_TableSmallObjectClone(benchmark::State& state) {
+  std::vector<lepus::Value> items;
+  for (int i = 0; i < 1000; i++) {
+    auto dict = lepus::Dictionary::Create();
+    for (int64_t j = 0; j < state.range(0); j++) {
+      dict->SetValue(base::String("prop_" + std::to_string(j)), i);
+    }
+    items.emplace_back(std::move(dict));
+  }
+
+  for (auto _ : state) {
+    for (const auto& item : items) {
+      benchmark::DoNotOptimize(lepus::Value::Clone(item));
+    }
+  }
+}
+
+// Updates one item of a list after the data is snapshotted by ShallowCopy(),
+// like setData with a path on a page keeping pre data.
+static void BM_UpdateValueByPathAfterShallowCopy(benchmark::State& state) {
+  auto list = lepus::CArray::Create();
+  for (int64_t i = 0; i < state.range(0); i++) {
+    list->emplace_back(lepus::Dictionary::Create({
+        {base::String("title"), lepus::Value(std::to_string(i))},
+        {base::String("index"), lepus::Value(static_cast<int32_t>(i))},
+    }));
+  }
+  lepus::Value data(lepus::Dictionary::Create({
+      {base::String("list"), lepus::Value(std::move(list))},
+  }));
+  auto path = lepus::ParseValuePath("list[" +
+                                    std::to_string(state.range(0) / 2) +
+                                    "].title");
+
+  for (auto _ : state) {
+    lepus::Value pre_data = lepus::Value::ShallowCopy(data);
+    lepus::Value::UpdateValueByPath(data, lepus::Value("new"), path);
+    benchmark::DoNotOptimize(pre_data);
+  }
+}
+
 BENCHMARK(BM_ShadowEqualSameStringTable);
 BENCHMARK(BM_ShadowEqualSameIntTable);
 BENCHMARK(BM_ShadowEqualDiffSameStringTable);
@@ -688,5 +750,10 @@ BENCHMARK(BM_TableSetValueNoEmplace);
 BENCHMARK(BM_TableSetValueEmplace);
 BENCHMARK(BM_TableSetValueNoEmplaceKeyConflict);
 BENCHMARK(BM_TableSetValueEmplaceKeyConflict);
+BENCHMARK(BM_TableSmallObjectSetGet)->DenseRange(1, 8)->Arg(16)->Arg(64);
+BENCHMARK(BM_TableSmallObjectClone)->DenseRange(1, 8)->Arg(16)->Arg(64);
+BENCHMARK(BM_UpdateValueByPathAfterShallowCopy)
+    ->RangeMultiplier(10)
+    ->Range(100, 10000);
 }  // namespace lepusbenchmark
 }  // namespace lynx
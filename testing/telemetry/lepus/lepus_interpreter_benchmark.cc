@@ -0,0 +1,97 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <string>
+
+#include "core/runtime/vm/lepus/builtin.h"
+#include "core/runtime/vm/lepus/bytecode_generator.h"
+#include "core/runtime/vm/lepus/function.h"
+#include "core/runtime/vm/lepus/json_parser.h"
+#include "core/runtime/vm/lepus/vm_context.h"
+#include "third_party/benchmark/include/benchmark/benchmark.h"
+
+namespace lynx {
+namespace lepusbenchmark {
+
+// These tests run the lepus test scripts copied to benchmark_test_files on
+// VMContext. Arg 0 runs the bytecode as generated, and arg 1 runs it with
+// super instructions fused as a decoded template does. The label tells
+// whether threaded dispatch is compiled in, which is turned on by the gn arg
+// enable_lepus_threaded_dispatch.
+
+namespace {
+
+lepus::Value EmptyFunction(lepus::Context* context) { return lepus::Value(); }
+
+void FuseSuperInstructions(const fml::RefPtr<lepus::Function>& function) {
+  function->FuseSuperInstructions();
+  for (const auto& child : function->GetChildFunction()) {
+    FuseSuperInstructions(child);
+  }
+}
+
+}  // namespace
+
+static void BM_LepusInterpreter(benchmark::State& state,
+                                const char* file_name) {
+  const bool fuse = state.range(0) != 0;
+  const std::string path = std::string("./benchmark_test_files/") + file_name;
+  const std::string source = lepus::readFile(path.c_str());
+  if (source.empty()) {
+    state.SkipWithError("failed to read the script");
+    return;
+  }
+  for (auto _ : state) {
+    state.PauseTiming();
+    lepus::VMContext ctx;
+    ctx.Initialize();
+    ctx.SetClosureFix(true);
+    // The assertions of the test scripts are not checked here.
+    lepus::RegisterCFunction(&ctx, "Assert", EmptyFunction);
+    lepus::RegisterCFunction(&ctx, "print", EmptyFunction);
+    lepus::BytecodeGenerator::GenerateBytecode(&ctx, source, "2.6");
+    if (fuse) {
+      FuseSuperInstructions(ctx.GetRootFunction());
+    }
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(ctx.Execute());
+  }
+#if ENABLE_LEPUS_THREADED_DISPATCH && (defined(__GNUC__) || defined(__clang__))
+  state.SetLabel(fuse ? "threaded,super" : "threaded");
+#else
+  state.SetLabel(fuse ? "switch,super" : "switch");
+#endif
+}
+
+BENCHMARK_CAPTURE(BM_LepusInterpreter, BigObject, "big_object.js")
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK_CAPTURE(BM_LepusInterpreter, Closure, "closure.js")->Arg(0)->Arg(1);
+BENCHMARK_CAPTURE(BM_LepusInterpreter, AssignmentArgs, "assignment_args.js")
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK_CAPTURE(BM_LepusInterpreter, ArraySlice, "array.prototype.slice.js")
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK_CAPTURE(BM_LepusInterpreter, ArrayPrototype,
+                  "array_prototype_test.js")
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK_CAPTURE(BM_LepusInterpreter, ObjectAssign, "object.assign.js")
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK_CAPTURE(BM_LepusInterpreter, LogicalOperators,
+                  "logical_AND_and_logical_Or.js")
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK_CAPTURE(BM_LepusInterpreter, StringReplace,
+                  "string.prototype.replace.js")
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK_CAPTURE(BM_LepusInterpreter, ForStatement, "for_statement_test.js")
+    ->Arg(0)
+    ->Arg(1);
+
+}  // namespace lepusbenchmark
+}  // namespace lynx
@@ -0,0 +1,149 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/renderer/utils/diff_algorithm.h"
+#include "third_party/benchmark/include/benchmark/benchmark.h"
+
+namespace lynx {
+namespace tasm {
+
+// These tests diff lists of items with unique item-keys, the same as list
+// items diffed by ListNode::MyersDiff(), with the following patterns:
+// - Insert: 10 items are inserted at random positions.
+// - Remove: 10 items are removed from random positions.
+// - Shuffle: 1% of items are moved to random positions.
+// - Append: a page of 1/10 more items is appended, e.g. loading more.
+// 1% of the remaining items have their data changed in all patterns.
+
+namespace {
+
+struct Item {
+  std::string key;
+  int data;
+
+  friend bool operator==(const Item& lhs, const Item& rhs) {
+    return lhs.key == rhs.key && lhs.data == rhs.data;
+  }
+};
+
+enum Pattern { kInsert, kRemove, kShuffle, kAppend };
+
+std::pair<std::vector<Item>, std::vector<Item>> MakeLists(Pattern pattern,
+                                                          size_t size) {
+  std::mt19937 random(42);
+  std::vector<Item> list_old;
+  list_old.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    list_old.push_back({"item-" + std::to_string(i), 0});
+  }
+  auto list_new = list_old;
+  switch (pattern) {
+    case kInsert:
+      for (size_t i = 0; i < 10; ++i) {
+        list_new.insert(list_new.begin() + random() % list_new.size(),
+                        {"new-" + std::to_string(i), 0});
+      }
+      break;
+    case kRemove:
+      for (size_t i = 0; i < 10; ++i) {
+        list_new.erase(list_new.begin() + random() % list_new.size());
+      }
+      break;
+    case kShuffle:
+      for (size_t i = 0; i < size / 100; ++i) {
+        auto item = list_new[random() % list_new.size()];
+        list_new.erase(std::find(list_new.begin(), list_new.end(), item));
+        list_new.insert(list_new.begin() + random() % list_new.size(), item);
+      }
+      break;
+    case kAppend:
+      for (size_t i = 0; i < size / 10; ++i) {
+        list_new.push_back({"new-" + std::to_string(i), 0});
+      }
+      break;
+  }
+  for (size_t i = 0; i < size / 100; ++i) {
+    list_new[random() % list_new.size()].data = 1;
+  }
+  return {list_old, list_new};
+}
+
+auto SameKind = [](const Item& lhs, const Item& rhs) {
+  return lhs.key == rhs.key;
+};
+auto Same = [](const Item& lhs, const Item& rhs) { return lhs == rhs; };
+// Keys of list items are base::String which are not copied or hashed again.
+auto Key = [](const Item& item) { return std::string_view(item.key); };
+
+void RunMyersDiff(benchmark::State& state, Pattern pattern) {
+  auto lists = MakeLists(pattern, state.range(0));
+  for (auto _ : state) {
+    auto result = myers_diff::MyersDiff(
+        true, lists.first.begin(), lists.first.end(), lists.second.begin(),
+        lists.second.end(), SameKind, Same);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void RunKeyedDiff(benchmark::State& state, Pattern pattern) {
+  auto lists = MakeLists(pattern, state.range(0));
+  for (auto _ : state) {
+    myers_diff::DiffResult result;
+    bool success = myers_diff::KeyedDiff(
+        true, lists.first.begin(), lists.first.end(), lists.second.begin(),
+        lists.second.end(), Key, Same, result);
+    benchmark::DoNotOptimize(success);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+static void BM_MyersDiff_Insert(benchmark::State& state) {
+  RunMyersDiff(state, kInsert);
+}
+static void BM_KeyedDiff_Insert(benchmark::State& state) {
+  RunKeyedDiff(state, kInsert);
+}
+static void BM_MyersDiff_Remove(benchmark::State& state) {
+  RunMyersDiff(state, kRemove);
+}
+static void BM_KeyedDiff_Remove(benchmark::State& state) {
+  RunKeyedDiff(state, kRemove);
+}
+static void BM_MyersDiff_Shuffle(benchmark::State& state) {
+  RunMyersDiff(state, kShuffle);
+}
+static void BM_KeyedDiff_Shuffle(benchmark::State& state) {
+  RunKeyedDiff(state, kShuffle);
+}
+static void BM_MyersDiff_Append(benchmark::State& state) {
+  RunMyersDiff(state, kAppend);
+}
+static void BM_KeyedDiff_Append(benchmark::State& state) {
+  RunKeyedDiff(state, kAppend);
+}
+
+BENCHMARK(BM_MyersDiff_Insert)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(BM_KeyedDiff_Insert)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(BM_MyersDiff_Remove)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(BM_KeyedDiff_Remove)->RangeMultiplier(10)->Range(1000, 100000);
+// Moving items costs MyersDiff O(n*d) time, which takes seconds for 100k items.
+BENCHMARK(BM_MyersDiff_Shuffle)->RangeMultiplier(10)->Range(1000, 10000);
+BENCHMARK(BM_KeyedDiff_Shuffle)->RangeMultiplier(10)->Range(1000, 100000);
+// Appending n/10 items costs MyersDiff O(n^2) time, which takes seconds for
+// 100k items.
+BENCHMARK(BM_MyersDiff_Append)->RangeMultiplier(10)->Range(1000, 10000);
+BENCHMARK(BM_KeyedDiff_Append)->RangeMultiplier(10)->Range(1000, 100000);
+
+}  // namespace tasm
+}  // namespace lynx
@@ -0,0 +1,168 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "core/renderer/signal/computation.h"
+#include "core/renderer/signal/lynx_signal.h"
+#include "core/renderer/signal/memo.h"
+#include "core/renderer/signal/scope.h"
+#include "core/renderer/signal/signal_context.h"
+#include "core/runtime/vm/lepus/vm_context.h"
+#include "third_party/benchmark/include/benchmark/benchmark.h"
+
+namespace lynx {
+namespace tasm {
+
+// These tests set the signals of generated graphs in one batch, and report the
+// number of the computations run by each batch. The diamond graph is made of
+// separate diamonds, each with a signal read by two memos which are read by a
+// third one. The fan-out graph is a signal read by all the memos, which are
+// read by an effect.
+
+namespace {
+
+class Graph {
+ public:
+  Graph() {
+    current_ = this;
+    vm_context_.Initialize();
+    scope_ = fml::MakeRefCounted<Scope>(&signal_context_, &vm_context_,
+                                        lepus::Value(EmptyClosure));
+    signal_context_.PushScope(scope_.get());
+  }
+
+  ~Graph() {
+    signal_context_.PopScope();
+    scope_->CleanUp();
+    current_ = nullptr;
+  }
+
+  Signal* AddSignal(double value) {
+    signals_.emplace_back(
+        fml::MakeRefCounted<Signal>(&signal_context_, lepus::Value(value)));
+    return signals_.back().get();
+  }
+
+  // The value of the memo is the sum of the inputs and the offset.
+  Memo* AddMemo(std::vector<Signal*> inputs, double offset) {
+    pending_node_ = {std::move(inputs), offset};
+    memos_.emplace_back(fml::MakeRefCounted<Memo>(
+        &signal_context_, &vm_context_, lepus::Value(NodeClosure),
+        lepus::Value()));
+    return memos_.back().get();
+  }
+
+  void AddEffect(std::vector<Signal*> inputs) {
+    pending_node_ = {std::move(inputs), 0};
+    fml::MakeRefCounted<Computation>(&signal_context_, &vm_context_,
+                                     lepus::Value(NodeClosure), lepus::Value(),
+                                     true, nullptr);
+  }
+
+  void RunUpdates(std::function<void()>&& func) {
+    signal_context_.RunUpdates(std::move(func));
+  }
+
+  size_t run_count() const { return run_count_; }
+
+ private:
+  struct Node {
+    std::vector<Signal*> inputs;
+    double offset;
+  };
+
+  static lepus::Value EmptyClosure(lepus::Context* context) {
+    return lepus::Value();
+  }
+
+  // Computations run for the first time while they are constructed, which is
+  // when they are bound to the pending node.
+  static lepus::Value NodeClosure(lepus::Context* context) {
+    Graph* graph = current_;
+    const Computation* computation =
+        graph->signal_context_.GetTopComputation();
+    auto it = graph->nodes_.find(computation);
+    if (it == graph->nodes_.end()) {
+      it = graph->nodes_.emplace(computation, std::move(graph->pending_node_))
+               .first;
+    }
+    ++graph->run_count_;
+    double value = it->second.offset;
+    for (Signal* input : it->second.inputs) {
+      value += input->GetValue().Number();
+    }
+    return lepus::Value(value);
+  }
+
+  static inline Graph* current_ = nullptr;
+
+  lepus::VMContext vm_context_;
+  SignalContext signal_context_;
+  fml::RefPtr<Scope> scope_;
+  std::vector<fml::RefPtr<Signal>> signals_;
+  std::vector<fml::RefPtr<Memo>> memos_;
+  std::unordered_map<const Computation*, Node> nodes_;
+  Node pending_node_;
+  size_t run_count_ = 0;
+};
+
+void ReportRunCount(benchmark::State& state, const Graph& graph,
+                    size_t initial_run_count) {
+  state.counters["runs"] =
+      benchmark::Counter(static_cast<double>(graph.run_count() -
+                                             initial_run_count),
+                         benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace
+
+static void BM_SignalDiamond(benchmark::State& state) {
+  Graph graph;
+  std::vector<Signal*> sources;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    Signal* source = graph.AddSignal(0);
+    Memo* left = graph.AddMemo({source}, 1);
+    Memo* right = graph.AddMemo({source}, 2);
+    graph.AddMemo({left, right}, 0);
+    sources.push_back(source);
+  }
+  const size_t initial_run_count = graph.run_count();
+  double value = 0;
+  for (auto _ : state) {
+    value += 1;
+    graph.RunUpdates([&sources, value]() {
+      for (Signal* source : sources) {
+        source->SetValue(lepus::Value(value));
+      }
+    });
+  }
+  ReportRunCount(state, graph, initial_run_count);
+}
+
+static void BM_SignalFanOut(benchmark::State& state) {
+  Graph graph;
+  Signal* source = graph.AddSignal(0);
+  std::vector<Signal*> memos;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    memos.push_back(graph.AddMemo({source}, static_cast<double>(i)));
+  }
+  graph.AddEffect(std::move(memos));
+  const size_t initial_run_count = graph.run_count();
+  double value = 0;
+  for (auto _ : state) {
+    value += 1;
+    source->SetValue(lepus::Value(value));
+  }
+  ReportRunCount(state, graph, initial_run_count);
+}
+
+BENCHMARK(BM_SignalDiamond)->RangeMultiplier(10)->Range(100, 10000);
+BENCHMARK(BM_SignalFanOut)->RangeMultiplier(10)->Range(100, 10000);
+
+}  // namespace tasm
+}  // namespace lynx
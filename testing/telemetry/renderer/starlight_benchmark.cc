@@ -0,0 +1,357 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "core/services/starlight_standalone/core/include/starlight.h"
+#include "third_party/benchmark/include/benchmark/benchmark.h"
+
+namespace starlight {
+
+// These tests lay out generated trees with the standalone starlight API. Each
+// tree is a column of sections laid out by the algorithm under test, each
+// with a few fixed-size items, so the algorithms can be compared at the same
+// node count. There are three kinds of tests:
+// - FullLayout: all the items are marked dirty before each layout.
+// - IncrementalRelayout: one item is resized before each layout.
+// - CacheHit: only the root is marked dirty before each layout, so all the
+//   sections should be skipped with their cached results.
+// The BuildTree tests compare building a flex tree and reading back the
+// layout results with one call per node and property, and with the batch API.
+
+namespace {
+
+constexpr int32_t kScreenWidth = 1080;
+constexpr int32_t kScreenHeight = 1920;
+constexpr int32_t kItemCountPerSection = 10;
+constexpr int32_t kItemCountPerRelativeRow = 5;
+
+enum class Algorithm : int64_t {
+  kFlex = 0,
+  kGrid,
+  kLinear,
+  kRelative,
+  kStaggeredGrid,
+  kCount,
+};
+
+const char* AlgorithmName(Algorithm algorithm) {
+  switch (algorithm) {
+    case Algorithm::kFlex:
+      return "flex";
+    case Algorithm::kGrid:
+      return "grid";
+    case Algorithm::kLinear:
+      return "linear";
+    case Algorithm::kRelative:
+      return "relative";
+    case Algorithm::kStaggeredGrid:
+      return "staggered-grid";
+    default:
+      return "";
+  }
+}
+
+class GeneratedTree {
+ public:
+  GeneratedTree(Algorithm algorithm, int64_t node_count) {
+    const LayoutConfig config(kScreenWidth, kScreenHeight);
+    root_ = CreateNode(config);
+    SetWidth(root_, SLLength(kScreenWidth, kSLLengthPPX));
+    SetDisplay(root_, kSLDisplayTypeFlex);
+    SetFlexDirection(root_, kSLFlexDirectionColumn);
+
+    const int64_t section_count =
+        std::max<int64_t>(1, (node_count - 1) / (kItemCountPerSection + 1));
+    for (int64_t i = 0; i < section_count; ++i) {
+      SLNodeRef section = CreateNode(config);
+      InsertChild(root_, section);
+      SetupSection(algorithm, section);
+      for (int32_t j = 0; j < kItemCountPerSection; ++j) {
+        SLNodeRef item = CreateNode(config);
+        InsertChild(section, item);
+        SetupItem(algorithm, item, j);
+        items_.push_back(item);
+      }
+    }
+  }
+
+  ~GeneratedTree() {
+    // Children are freed before their parents.
+    while (!nodes_.empty()) {
+      Free(nodes_.back());
+      nodes_.pop_back();
+    }
+  }
+
+  SLNodeRef root() const { return root_; }
+  const std::vector<SLNodeRef>& items() const { return items_; }
+  size_t size() const { return nodes_.size(); }
+
+ private:
+  SLNodeRef CreateNode(const LayoutConfig& config) {
+    SLNodeRef node = CreateWithConfig(config);
+    nodes_.push_back(node);
+    return node;
+  }
+
+  static void SetupSection(Algorithm algorithm, SLNodeRef section) {
+    SetMarginTop(section, SLLength(8.f, kSLLengthPPX));
+    SetPadding(section, SLLength(4.f, kSLLengthPPX));
+    switch (algorithm) {
+      case Algorithm::kFlex:
+        SetDisplay(section, kSLDisplayTypeFlex);
+        SetFlexDirection(section, kSLFlexDirectionRow);
+        SetFlexWrap(section, kSLFlexWrapTypeWrap);
+        break;
+      case Algorithm::kGrid:
+        SetDisplay(section, kSLDisplayTypeGrid);
+        SetStyle(section, "grid-template-columns", "1fr 2fr 100px 1fr");
+        SetStyle(section, "grid-column-gap", "4px");
+        break;
+      case Algorithm::kLinear:
+        SetDisplay(section, kSLDisplayTypeLinear);
+        SetStyle(section, "linear-orientation", "horizontal");
+        break;
+      case Algorithm::kRelative:
+        SetDisplay(section, kSLDisplayTypeRelative);
+        break;
+      case Algorithm::kStaggeredGrid:
+        SetDisplay(section, kSLDisplayTypeLinear);
+        SetColumnCount(section, 2);
+        break;
+      default:
+        break;
+    }
+  }
+
+  static void SetupItem(Algorithm algorithm, SLNodeRef item, int32_t index) {
+    SetHeight(item, SLLength(40.f + index % 3 * 20.f, kSLLengthPPX));
+    switch (algorithm) {
+      case Algorithm::kFlex:
+        SetWidth(item, SLLength(200.f, kSLLengthPPX));
+        SetFlexGrow(item, 1.f + index % 2);
+        SetMarginLeft(item, SLLength(4.f, kSLLengthPPX));
+        break;
+      case Algorithm::kGrid:
+        SetMarginTop(item, SLLength(4.f, kSLLengthPPX));
+        break;
+      case Algorithm::kLinear:
+        SetStyle(item, "linear-weight", std::to_string(1 + index % 2));
+        break;
+      case Algorithm::kRelative:
+        SetWidth(item, SLLength(200.f, kSLLengthPPX));
+        SetStyle(item, "relative-id", std::to_string(index + 1));
+        if (index % kItemCountPerRelativeRow != 0) {
+          SetStyle(item, "relative-right-of", std::to_string(index));
+        }
+        if (index >= kItemCountPerRelativeRow) {
+          SetStyle(item, "relative-bottom-of",
+                   std::to_string(index + 1 - kItemCountPerRelativeRow));
+        }
+        break;
+      case Algorithm::kStaggeredGrid:
+        SetMarginBottom(item, SLLength(4.f, kSLLengthPPX));
+        break;
+      default:
+        break;
+    }
+  }
+
+  SLNodeRef root_ = nullptr;
+  std::vector<SLNodeRef> nodes_;
+  std::vector<SLNodeRef> items_;
+};
+
+// A flex tree of sections with kItemCountPerSection items each.
+void GenerateFlexTree(int64_t node_count, std::vector<int32_t>& parent_indices,
+                      std::vector<SLStyleValue>& styles,
+                      std::vector<uint32_t>& style_offsets) {
+  parent_indices.push_back(-1);
+  style_offsets.push_back(0);
+  styles.emplace_back(kSLStylePropertyWidth, kScreenWidth);
+  styles.emplace_back(kSLStylePropertyFlexDirection, kSLFlexDirectionColumn);
+  style_offsets.push_back(styles.size());
+  while (static_cast<int64_t>(parent_indices.size()) < node_count) {
+    const int32_t section = static_cast<int32_t>(parent_indices.size());
+    parent_indices.push_back(0);
+    styles.emplace_back(kSLStylePropertyFlexDirection, kSLFlexDirectionRow);
+    styles.emplace_back(kSLStylePropertyFlexWrap, kSLFlexWrapTypeWrap);
+    styles.emplace_back(kSLStylePropertyMarginTop, 8.f);
+    style_offsets.push_back(styles.size());
+    for (int32_t i = 0; i < kItemCountPerSection; ++i) {
+      parent_indices.push_back(section);
+      styles.emplace_back(kSLStylePropertyWidth, 200.f);
+      styles.emplace_back(kSLStylePropertyHeight, 40.f + i % 3 * 20.f);
+      styles.emplace_back(kSLStylePropertyFlexGrow, 1.f + i % 2);
+      style_offsets.push_back(styles.size());
+    }
+  }
+}
+
+void GenerateArguments(benchmark::internal::Benchmark* benchmark) {
+  for (int64_t algorithm = 0;
+       algorithm < static_cast<int64_t>(Algorithm::kCount); ++algorithm) {
+    for (int64_t node_count : {100, 1000, 10000, 50000}) {
+      benchmark->Args({algorithm, node_count});
+    }
+  }
+}
+
+}  // namespace
+
+static void BM_StarlightFullLayout(benchmark::State& state) {
+  const Algorithm algorithm = static_cast<Algorithm>(state.range(0));
+  GeneratedTree tree(algorithm, state.range(1));
+  CalculateLayout(tree.root());
+  for (auto _ : state) {
+    for (SLNodeRef item : tree.items()) {
+      MarkDirty(item);
+    }
+    CalculateLayout(tree.root());
+  }
+  state.SetItemsProcessed(state.iterations() * tree.size());
+  state.SetLabel(AlgorithmName(algorithm));
+}
+
+static void BM_StarlightIncrementalRelayout(benchmark::State& state) {
+  const Algorithm algorithm = static_cast<Algorithm>(state.range(0));
+  GeneratedTree tree(algorithm, state.range(1));
+  CalculateLayout(tree.root());
+  // Resizes the items in the middle of the tree in turn.
+  const std::vector<SLNodeRef>& items = tree.items();
+  size_t index = items.size() / 2;
+  float height = 30.f;
+  for (auto _ : state) {
+    SetHeight(items[index], SLLength(height, kSLLengthPPX));
+    CalculateLayout(tree.root());
+    index = (index + 1) % items.size();
+    height = height == 30.f ? 50.f : 30.f;
+  }
+  state.SetItemsProcessed(state.iterations() * tree.size());
+  state.SetLabel(AlgorithmName(algorithm));
+}
+
+static void BM_StarlightCacheHit(benchmark::State& state) {
+  const Algorithm algorithm = static_cast<Algorithm>(state.range(0));
+  GeneratedTree tree(algorithm, state.range(1));
+  CalculateLayout(tree.root());
+  for (auto _ : state) {
+    MarkDirty(tree.root());
+    CalculateLayout(tree.root());
+  }
+  state.SetItemsProcessed(state.iterations() * tree.size());
+  state.SetLabel(AlgorithmName(algorithm));
+}
+
+static void BM_StarlightBuildTreeWithSetters(benchmark::State& state) {
+  std::vector<int32_t> parent_indices;
+  std::vector<SLStyleValue> styles;
+  std::vector<uint32_t> style_offsets;
+  GenerateFlexTree(state.range(0), parent_indices, styles, style_offsets);
+  const size_t node_count = parent_indices.size();
+  const LayoutConfig config(kScreenWidth, kScreenHeight);
+  std::vector<SLNodeRef> nodes(node_count);
+  std::vector<float> results(node_count * kSLLayoutResultCount);
+  for (auto _ : state) {
+    for (size_t i = 0; i < node_count; ++i) {
+      nodes[i] = CreateWithConfig(config);
+      SetDisplay(nodes[i], kSLDisplayTypeFlex);
+      for (uint32_t j = style_offsets[i]; j < style_offsets[i + 1]; ++j) {
+        const SLStyleValue& style = styles[j];
+        switch (style.property_) {
+          case kSLStylePropertyFlexDirection:
+            SetFlexDirection(nodes[i],
+                             static_cast<SLFlexDirection>(style.value_));
+            break;
+          case kSLStylePropertyFlexWrap:
+            SetFlexWrap(nodes[i], static_cast<SLFlexWrapType>(style.value_));
+            break;
+          case kSLStylePropertyFlexGrow:
+            SetFlexGrow(nodes[i], style.value_);
+            break;
+          case kSLStylePropertyWidth:
+            SetWidth(nodes[i], SLLength(style.value_, style.type_));
+            break;
+          case kSLStylePropertyHeight:
+            SetHeight(nodes[i], SLLength(style.value_, style.type_));
+            break;
+          case kSLStylePropertyMarginTop:
+            SetMarginTop(nodes[i], SLLength(style.value_, style.type_));
+            break;
+          default:
+            break;
+        }
+      }
+      if (parent_indices[i] >= 0) {
+        InsertChild(nodes[parent_indices[i]], nodes[i]);
+      }
+    }
+    CalculateLayout(nodes[0]);
+    for (size_t i = 0; i < node_count; ++i) {
+      const SLPoint offset = GetLayoutOffset(nodes[i]);
+      const SLSize size = GetLayoutSize(nodes[i]);
+      float* node_results = &results[i * kSLLayoutResultCount];
+      node_results[kSLLayoutResultLeft] = offset.x_;
+      node_results[kSLLayoutResultTop] = offset.y_;
+      node_results[kSLLayoutResultWidth] = size.width_;
+      node_results[kSLLayoutResultHeight] = size.height_;
+    }
+    benchmark::DoNotOptimize(results.data());
+    state.PauseTiming();
+    for (size_t i = node_count; i > 0; --i) {
+      Free(nodes[i - 1]);
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * node_count);
+}
+
+static void BM_StarlightBuildTreeWithBatchAPI(benchmark::State& state) {
+  std::vector<int32_t> parent_indices;
+  std::vector<SLStyleValue> styles;
+  std::vector<uint32_t> style_offsets;
+  GenerateFlexTree(state.range(0), parent_indices, styles, style_offsets);
+  // Display is the same as the setters test, set as a part of the blob.
+  std::vector<SLStyleValue> blob;
+  std::vector<uint32_t> blob_offsets;
+  blob_offsets.push_back(0);
+  for (size_t i = 0; i < parent_indices.size(); ++i) {
+    blob.emplace_back(kSLStylePropertyDisplay, kSLDisplayTypeFlex);
+    blob.insert(blob.end(), styles.begin() + style_offsets[i],
+                styles.begin() + style_offsets[i + 1]);
+    blob_offsets.push_back(blob.size());
+  }
+  const size_t node_count = parent_indices.size();
+  const LayoutConfig config(kScreenWidth, kScreenHeight);
+  std::vector<SLNodeRef> nodes(node_count);
+  std::vector<float> results(node_count * kSLLayoutResultCount);
+  for (auto _ : state) {
+    CreateTree(config, parent_indices.data(), node_count, blob.data(),
+               blob_offsets.data(), nodes.data());
+    CalculateLayout(nodes[0]);
+    GetLayoutResults(nodes.data(), node_count, results.data());
+    benchmark::DoNotOptimize(results.data());
+    state.PauseTiming();
+    for (size_t i = node_count; i > 0; --i) {
+      Free(nodes[i - 1]);
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * node_count);
+}
+
+BENCHMARK(BM_StarlightFullLayout)->Apply(GenerateArguments);
+BENCHMARK(BM_StarlightIncrementalRelayout)->Apply(GenerateArguments);
+BENCHMARK(BM_StarlightCacheHit)->Apply(GenerateArguments);
+BENCHMARK(BM_StarlightBuildTreeWithSetters)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000);
+BENCHMARK(BM_StarlightBuildTreeWithBatchAPI)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000);
+
+}  // namespace starlight
@@ -0,0 +1,160 @@
+// Copyright 2025 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <memory>
+#include <vector>
+
+#include "base/include/fml/concurrent_message_loop.h"
+#include "core/renderer/css/computed_css_style.h"
+#include "core/renderer/starlight/layout/layout_object.h"
+#include "core/renderer/starlight/types/layout_configs.h"
+#include "third_party/benchmark/include/benchmark/benchmark.h"
+
+namespace lynx {
+namespace starlight {
+
+// These tests lay out a wide tree, a wrapping row of fixed-size cards like a
+// feed, each with rows of flex items. All the leaves are marked dirty before
+// each layout. The serial tests lay out the tree with ReLayout() only, and the
+// parallel tests lay out the cards on a ConcurrentMessageLoop first, the same
+// as LayoutContext with enableParallelLayout.
+
+namespace {
+
+constexpr int32_t kRowCountPerCard = 8;
+constexpr int32_t kItemCountPerRow = 4;
+
+class Node {
+ public:
+  Node()
+      : css_style_(std::make_unique<ComputedCSSStyle>(1.f, 1.f)),
+        layout_object_(std::make_unique<LayoutObject>(
+            LayoutConfigs(), css_style_->GetLayoutComputedStyle())) {}
+
+  ~Node() {
+    if (layout_object_->parent()) {
+      layout_object_->parent()->RemoveChild(layout_object_.get());
+    }
+  }
+
+  void SetLength(tasm::CSSPropertyID id, float value,
+                 tasm::CSSValuePattern pattern = tasm::CSSValuePattern::PX) {
+    css_style_->SetValue(id, tasm::CSSValue(lepus::Value(value), pattern));
+  }
+
+  void SetEnum(tasm::CSSPropertyID id, int value) {
+    css_style_->SetValue(id, tasm::CSSValue::MakeEnum(value));
+  }
+
+  LayoutObject* layout_object() { return layout_object_.get(); }
+
+ private:
+  std::unique_ptr<ComputedCSSStyle> css_style_;
+  std::unique_ptr<LayoutObject> layout_object_;
+};
+
+class WideTree {
+ public:
+  explicit WideTree(int64_t card_count) {
+    Node* root = CreateNode(nullptr);
+    root->SetLength(tasm::kPropertyIDWidth, 1080.f);
+    root->SetEnum(tasm::kPropertyIDDisplay,
+                  static_cast<int>(DisplayType::kFlex));
+    root->SetEnum(tasm::kPropertyIDFlexWrap,
+                  static_cast<int>(FlexWrapType::kWrap));
+    for (int64_t i = 0; i < card_count; ++i) {
+      Node* card = CreateNode(root);
+      card->SetLength(tasm::kPropertyIDWidth, 340.f);
+      card->SetLength(tasm::kPropertyIDHeight, 480.f);
+      card->SetLength(tasm::kPropertyIDMarginLeft, 10.f);
+      card->SetLength(tasm::kPropertyIDPaddingTop, 8.f);
+      card->SetLength(tasm::kPropertyIDFlexShrink, 0.f,
+                      tasm::CSSValuePattern::NUMBER);
+      for (int32_t j = 0; j < kRowCountPerCard; ++j) {
+        Node* row = CreateNode(card);
+        row->SetEnum(tasm::kPropertyIDDisplay,
+                     static_cast<int>(DisplayType::kFlex));
+        row->SetLength(tasm::kPropertyIDMarginTop, 4.f);
+        for (int32_t k = 0; k < kItemCountPerRow; ++k) {
+          Node* item = CreateNode(row);
+          item->SetLength(tasm::kPropertyIDFlexGrow, 1.f + k,
+                          tasm::CSSValuePattern::NUMBER);
+          item->SetLength(tasm::kPropertyIDHeight, 20.f + j);
+          item->SetLength(tasm::kPropertyIDPaddingLeft, 10.f,
+                          tasm::CSSValuePattern::PERCENT);
+          leaves_.push_back(item->layout_object());
+        }
+      }
+    }
+  }
+
+  ~WideTree() {
+    // Children are destroyed before their parents.
+    while (!nodes_.empty()) {
+      nodes_.pop_back();
+    }
+  }
+
+  void MarkLeavesDirty() {
+    for (LayoutObject* leaf : leaves_) {
+      leaf->MarkDirty();
+    }
+  }
+
+  void MarkUpdated() {
+    for (auto& node : nodes_) {
+      node->layout_object()->MarkUpdated();
+    }
+  }
+
+  LayoutObject* root() { return nodes_.front()->layout_object(); }
+
+ private:
+  Node* CreateNode(Node* parent) {
+    nodes_.emplace_back(std::make_unique<Node>());
+    Node* node = nodes_.back().get();
+    if (parent) {
+      parent->layout_object()->AppendChild(node->layout_object());
+    }
+    return node;
+  }
+
+  std::vector<std::unique_ptr<Node>> nodes_;
+  std::vector<LayoutObject*> leaves_;
+};
+
+}  // namespace
+
+static void BM_StarlightLayout_Serial(benchmark::State& state) {
+  WideTree tree(state.range(0));
+  for (auto _ : state) {
+    tree.MarkLeavesDirty();
+    tree.root()->ReLayout();
+    tree.MarkUpdated();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_StarlightLayout_Parallel(benchmark::State& state) {
+  WideTree tree(state.range(0));
+  auto loop = fml::ConcurrentMessageLoop::Create();
+  std::vector<LayoutObject*> boundaries;
+  for (auto _ : state) {
+    tree.MarkLeavesDirty();
+    boundaries.clear();
+    tree.root()->CollectDirtyLayoutBoundaries(boundaries);
+    loop->ParallelFor(boundaries.size(), [&boundaries](size_t index) {
+      boundaries[index]->LayoutAsBoundary();
+    });
+    tree.root()->ReLayout();
+    tree.MarkUpdated();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_StarlightLayout_Serial)->RangeMultiplier(10)->Range(10, 1000);
+BENCHMARK(BM_StarlightLayout_Parallel)->RangeMultiplier(10)->Range(10, 1000);
+
+}  // namespace starlight
+}  // namespace lynx